@@ -4,19 +4,29 @@
 #define NUM_DIR_LIGHTS 1
 #define NUM_POINT_LIGHTS 1
 #define NUM_SPOT_LIGHTS 1
+#define NUM_CASCADES 4
 
-#define MAX_SHADOW_DSV_COUNT (NUM_DIR_LIGHTS + NUM_SPOT_LIGHTS + 6 * NUM_POINT_LIGHTS)
+#define MAX_SHADOW_DSV_COUNT (NUM_CASCADES * NUM_DIR_LIGHTS + NUM_SPOT_LIGHTS + 6 * NUM_POINT_LIGHTS)
 #define SHADOW_MAP_WIDTH 2048
 #define SHADOW_MAP_HEIGHT 2048
 
 static const float INV_SHADOW_MAP_WIDTH = 1.0f / SHADOW_MAP_WIDTH;
 static const float INV_SHADOW_MAP_HEIGHT = 1.0f / SHADOW_MAP_HEIGHT;;
 
+#define SHADOW_ATLAS_SIZE 4096
+static const float INV_SHADOW_ATLAS_SIZE = 1.0f / SHADOW_ATLAS_SIZE;
+
+// Clustered lighting (LightClusterGrid.h)
+#define CLUSTER_GRID_X 16
+#define CLUSTER_GRID_Y 9
+#define CLUSTER_GRID_Z 24
+#define CLUSTER_COUNT (CLUSTER_GRID_X * CLUSTER_GRID_Y * CLUSTER_GRID_Z)
+
 
 struct Light
 {
     float3 Position;
-    float _pad0;
+    float Range;            // influence radius (0 = directional)
 
     float3 Direction;
     float _pad1;
@@ -27,11 +37,28 @@ struct Light
     float InnerCutoffAngle;
     float OuterCutoffAngle;
     int ShadowCastingEnabled;
-    float _pad3;
+    int ShadowMapIndex;     // first face in ShadowMapViewProj (-1 = no slot)
 
     float Constant;
     float Linear;
     float Quadratic;
     int Type;
 
-};
\ No newline at end of file
+};
+
+
+// Compact vertex decode (VertexCompression.h, CompactMeshVertex)
+// position: UNORM16 relative to the mesh AABB, p = q * scale + bias
+float3 DecodeCompactPosition(float4 q, float4 positionScale, float4 positionBias)
+{
+    return q.xyz * positionScale.xyz + positionBias.xyz;
+}
+
+// normal / tangent: octahedral SNORM16
+float3 OctDecode(float2 e)
+{
+    float3 n = float3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += n.xy >= 0.0 ? -t : t;
+    return normalize(n);
+}
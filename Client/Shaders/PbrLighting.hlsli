@@ -7,7 +7,10 @@ static const float3 F_DIELECTRIC = float3(0.04, 0.04, 0.04);
 
 // 0=Albedo, 1=Normal, 2=Metallic, 3=Roughness
 //  ϳ ؽ R, G, B, A äη  ϵ ؾ
+#ifndef BINDLESS_MATERIALS
 Texture2D<float4> textureHeap[4] : register(t0, space0);
+#define MATERIAL_TEXTURE(slot) textureHeap[slot]
+#endif
 
 // Sampler
 SamplerState linearWrapSampler : register(s0);
@@ -20,9 +23,13 @@ Texture2D<float2> brdfLut : register(t6, space0);
 
 
 // Shadow depth maps
-Texture2D<float> shadowDepthMap[MAX_SHADOW_DSV_COUNT] : register(t7, space0);
+Texture2D<float> shadowAtlas : register(t7, space0);       //  Ʈ  Ÿ ϳ (ShadowAtlasRects)
 SamplerComparisonState shadowMapSampler : register(s2);    // ̺񱳿 ÷
 
+// Ŭ  (LightClusterGrid): directional  տ  ü Ʈ  + Ŭͺ ε 
+StructuredBuffer<Light> clusterLights : register(t8, space0);
+StructuredBuffer<uint> clusterData : register(t9, space0);     // [2c] = , [2c+1] = ,  ڷ Ʈ ε
+
 
 struct MaterialPBR
 {
@@ -43,17 +50,64 @@ struct MaterialPBR
 cbuffer CB_MVP : register(b0)
 {
     float4x4 model, view, projection, modelInvTranspose;
+    float4 positionScale;       // compact ؽ  (COMPACT_VERTEX)
+    float4 positionBias;
 };
 cbuffer CB_Lighting : register(b1)
 {
     float3 cameraWorld;
     float _padL;
     Light lights[MAX_LIGHTS];
+
+    uint clusterLightCount;
+    uint directionalLightCount;     // clusterLights պκ,  ȼ 
+    float clusterDepthScale;        // ̽ = log(viewZ) * scale + bias
+    float clusterDepthBias;
+    float2 clusterTileSize;         // Ŭ Ÿ  ĭ ȼ ũ
+    float2 _padC;
+};
+#ifdef BINDLESS_MATERIALS
+// Bindless: Ʈ   Ƽ  + ؽĺ  ε
+struct MaterialData
+{
+    float3 baseColor;
+    float metallic;
+
+    float specular;
+    float roughness;
+    float ambientOcclusion;
+    float emissiveIntensity;
+
+    float3 emissiveColor;
+    uint flags;
+
+    uint4 textureIndices;   // 0=Albedo, 1=Normal, 2=Metallic, 3=Roughness
 };
+
+StructuredBuffer<MaterialData> materialTable : register(t0, space1);
+Texture2D<float4> bindlessTextures[] : register(t0, space2);
+
+cbuffer CB_DrawConstants : register(b2)
+{
+    uint materialIndex;
+};
+
+MaterialData GetMaterial()
+{
+    return materialTable[materialIndex];
+}
+#define MATERIAL_TEXTURE(slot) bindlessTextures[GetMaterial().textureIndices[slot]]
+#else
 cbuffer CB_Material : register(b2)
 {
     MaterialPBR material;
 };
+
+MaterialPBR GetMaterial()
+{
+    return material;
+}
+#endif
 cbuffer CB_Global : register(b3)
 {
     float time;
@@ -63,6 +117,10 @@ cbuffer CB_Global : register(b3)
 cbuffer CB_ShadowMapViewProj : register(b4)
 {
     float4x4 ShadowMapViewProj[MAX_SHADOW_DSV_COUNT];
+    float4 ShadowAtlasRects[MAX_SHADOW_DSV_COUNT];  // xy = , zw =  (Ʋ UV), 0 = Ÿ 
+    float4 CascadeSplits;       // ĳ̵ i  far Ÿ ( )
+    float3 CameraForward;
+    float CascadeCount;
 };
 
 // Map flags
@@ -71,25 +129,37 @@ static const uint USE_NORMAL_MAP = (1 << 1);
 static const uint USE_METALLIC_MAP = (1 << 2);
 static const uint USE_ROUGHNESS_MAP = (1 << 3);
 
+// MATERIAL_FEATURES:   Ǵ ۹̼ Ű (USE_*_MAP mask)
+//  ʴ ؽ б ʹ  ܰ迡 
+#ifdef MATERIAL_FEATURES
 bool HasMap(uint flag)
 {
-    return (material.flags & flag) != 0;
+    return (MATERIAL_FEATURES & flag) != 0;
 }
+#else
+bool HasMap(uint flag)
+{
+    return (GetMaterial().flags & flag) != 0;
+}
+#endif
 
 float3 SampleAlbedo(float2 uv)
 {
     if (HasMap(USE_ALBEDO_MAP))
     {
-        return textureHeap[0].Sample(linearWrapSampler, uv).rgb * material.baseColor;
+        return MATERIAL_TEXTURE(0).Sample(linearWrapSampler, uv).rgb * GetMaterial().baseColor;
     }
-    return material.baseColor;
+    return GetMaterial().baseColor;
 }
 
 float3 SampleNormal(float2 uv)
 {
     if (HasMap(USE_NORMAL_MAP))
     {
-        float3 n = textureHeap[1].Sample(linearWrapSampler, uv).rgb * 2 - 1;
+        // BC5  xy  ϹǷ z   ͷ  (RGBA8 ָʿ  )
+        float3 n;
+        n.xy = MATERIAL_TEXTURE(1).Sample(linearWrapSampler, uv).rg * 2 - 1;
+        n.z = sqrt(saturate(1 - dot(n.xy, n.xy)));
         return normalize(n);
     }
     return float3(0, 0, 1);
@@ -97,28 +167,28 @@ float3 SampleNormal(float2 uv)
 
 float SampleMetallic(float2 uv)
 {
-    float m = material.metallic;
+    float m = GetMaterial().metallic;
     if (HasMap(USE_METALLIC_MAP))
     {
-        // Flight Asset  alpha äο Roughness ؽĸ ־. 
-        m *= textureHeap[2].Sample(linearWrapSampler, uv).a;
+        // Flight Asset  metallic  alpha äο . ε  r  ű (BC4 ŷ / WIC  )
+        m *= MATERIAL_TEXTURE(2).Sample(linearWrapSampler, uv).r;
     }
     return saturate(m);
 }
 
 float SampleRoughness(float2 uv)
 {
-    float r = material.roughness;
+    float r = GetMaterial().roughness;
     if (HasMap(USE_ROUGHNESS_MAP))
     {
-        r *= textureHeap[3].Sample(linearWrapSampler, uv).r;
+        r *= MATERIAL_TEXTURE(3).Sample(linearWrapSampler, uv).r;
     }
     return saturate(r);
 }
 
 float SampleAO()
 {
-    return saturate(material.ambientOcclusion);
+    return saturate(GetMaterial().ambientOcclusion);
 }
 
 // Fresnel-Schlick
@@ -264,6 +334,15 @@ float3 ComputePBR(float3 worldPos, float3 worldNormal, float2 uv)
 
 
 
+//  UV -> Ʋ UV. PCF  Ÿ   ʵ clamp
+float2 ShadowAtlasUV(int idx, float2 faceUV, float border)
+{
+    float4 rect = ShadowAtlasRects[idx];
+    float2 margin = border / (rect.xy * SHADOW_ATLAS_SIZE);
+    return clamp(faceUV, margin, 1.0f - margin) * rect.xy + rect.zw;
+}
+
+
 // 33 PCF ø
 float SampleShadowMapPCF(int idx, float4 posLightSpace)
 {
@@ -271,7 +350,8 @@ float SampleShadowMapPCF(int idx, float4 posLightSpace)
     float2 uv = float2(ndc.x, -ndc.y) * 0.5f + 0.5f;      // y  ٿ
     float depth = ndc.z;
 
-    if (uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f)
+    if (ShadowAtlasRects[idx].x == 0.0f ||
+        uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f)
     {
         return 1.0f;
     }
@@ -282,6 +362,8 @@ float SampleShadowMapPCF(int idx, float4 posLightSpace)
         return 1.0f; // ü   ׸  ó
     }
     
+    float2 atlasUV = ShadowAtlasUV(idx, uv, 1.5f);
+    
     float sum = 0.0f;
     [unroll]
     for (int y = -1; y <= 1; ++y)
@@ -290,8 +372,8 @@ float SampleShadowMapPCF(int idx, float4 posLightSpace)
         for (int x = -1; x <= 1; ++x)
         {
             float bias = 1.5f * INV_SHADOW_MAP_HEIGHT;
-            float2 offset = float2(x * INV_SHADOW_MAP_WIDTH, y * INV_SHADOW_MAP_HEIGHT);
-            sum += shadowDepthMap[idx].SampleCmp(shadowMapSampler, uv + offset, depth - bias);
+            float2 offset = float2(x, y) * INV_SHADOW_ATLAS_SIZE;
+            sum += shadowAtlas.SampleCmp(shadowMapSampler, atlasUV + offset, depth - bias);
         }
     }
     
@@ -306,7 +388,8 @@ float SampleShadowMapHard(int idx, float4 posLightSpace)
     float2 uv = float2(ndc.x, -ndc.y) * 0.5f + 0.5f; // y  ٿ
     float depth = ndc.z;
 
-    if (uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f)
+    if (ShadowAtlasRects[idx].x == 0.0f ||
+        uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f)
     {
         return 1.0f;
     }
@@ -319,7 +402,7 @@ float SampleShadowMapHard(int idx, float4 posLightSpace)
     
     
     float bias = 1.5f * INV_SHADOW_MAP_HEIGHT;
-    return shadowDepthMap[idx].SampleCmp(shadowMapSampler, uv, depth - bias);
+    return shadowAtlas.SampleCmp(shadowMapSampler, ShadowAtlasUV(idx, uv, 0.5f), depth - bias);
 }
 
 float3 SampleShadowMapDebug(int idx, float4 posLightSpace)
@@ -330,7 +413,8 @@ float3 SampleShadowMapDebug(int idx, float4 posLightSpace)
     float depth = ndc.z;
     
 
-    if (uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f ||
+    if (ShadowAtlasRects[idx].x == 0.0f ||
+        uv.x < 0.0f || uv.x > 1.0f || uv.y < 0.0f || uv.y > 1.0f ||
         abs(ndc.x) > 1.0f || abs(ndc.y) > 1.0f || depth < 0.0f || depth > 1.0f)
     {
         return float4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -340,7 +424,7 @@ float3 SampleShadowMapDebug(int idx, float4 posLightSpace)
     float bias = 1.5f * INV_SHADOW_MAP_HEIGHT;
     
     // raw map depth (R ä)
-    float mapDepth = shadowDepthMap[idx].Sample(linearClampSampler, uv).r;
+    float mapDepth = shadowAtlas.Sample(linearClampSampler, ShadowAtlasUV(idx, uv, 0.5f)).r;
     float refDepth = depth - bias;
     float cmpMask = (mapDepth <= refDepth) ? 0.0f : 1.0f;
     
@@ -349,104 +433,191 @@ float3 SampleShadowMapDebug(int idx, float4 posLightSpace)
 }
 
 
-float3 ComputePBRWithShadow(float3 worldPos, float3 worldNormal, float2 uv)
+// lightToPixel   ť , PointLight   (+X, -X, +Y, -Y, +Z, -Z)
+// C++  CubeShadowFace::Select (Lights/CubeShadowFace.h)   Ģ̹Ƿ Բ ĥ 
+int CubeShadowFace(float3 lightToPixel)
 {
-    float3 N = normalize(worldNormal);
-    float3 V = normalize(cameraWorld- worldPos);
-    
-    float3 albedo = SampleAlbedo(uv);
-    float metal = SampleMetallic(uv);
-    float rough = SampleRoughness(uv);
-    float ao = SampleAO();
+    float3 a = abs(lightToPixel);
+    if (a.x >= a.y && a.x >= a.z)
+        return lightToPixel.x >= 0.0f ? 0 : 1;
+    if (a.y >= a.z)
+        return lightToPixel.y >= 0.0f ? 2 : 3;
+    return lightToPixel.z >= 0.0f ? 4 : 5;
+}
 
-    float3 F0 = lerp(F_DIELECTRIC, albedo, metal);
-    float3 accumulatedLight = float3(0, 0, 0);
-    
-    
-    int shadowMapIdx = 0;
 
-    [unroll]
-    for (uint i = 0; i < MAX_LIGHTS; ++i)
+// +-0.5 ؼ ġ   4 ( ϵ 2x2 PCF,  3x3 )
+float SampleShadowMapCmp4(int idx, float4 posLightSpace)
+{
+    float3 ndc = posLightSpace.xyz / posLightSpace.w;
+    float2 uv = float2(ndc.x, -ndc.y) * 0.5f + 0.5f;
+    float depth = ndc.z;
+
+    if (ShadowAtlasRects[idx].x == 0.0f || ndc.z < 0.0f || ndc.z > 1.0f)
     {
-        Light currentLight = lights[i];
-        
-        int faceCount = (currentLight.Type == 1) ? 6 : 1;     // Point=6 (ť), =1
+        return 1.0f;
+    }
 
-        if (all(currentLight.Color * currentLight.Strength == 0))
+    //   ׻ ȼ ϹǷ Ÿ  clamp  
+    float2 atlasUV = ShadowAtlasUV(idx, saturate(uv), 1.0f);
+    float compareDepth = depth - 1.5f * INV_SHADOW_MAP_HEIGHT;
+    float2 halfTexel = 0.5f * INV_SHADOW_ATLAS_SIZE;
+
+    float sum = 0.0f;
+    sum += shadowAtlas.SampleCmpLevelZero(shadowMapSampler, atlasUV + float2(-halfTexel.x, -halfTexel.y), compareDepth);
+    sum += shadowAtlas.SampleCmpLevelZero(shadowMapSampler, atlasUV + float2( halfTexel.x, -halfTexel.y), compareDepth);
+    sum += shadowAtlas.SampleCmpLevelZero(shadowMapSampler, atlasUV + float2(-halfTexel.x,  halfTexel.y), compareDepth);
+    sum += shadowAtlas.SampleCmpLevelZero(shadowMapSampler, atlasUV + float2( halfTexel.x,  halfTexel.y), compareDepth);
+    return sum * 0.25f;
+}
+
+
+//  ȼ Ŭ (froxel): SV_Position.xy  ȭ Ÿ,  (SV_Position.w)   ̽
+uint ClusterIndexFromPosition(float4 svPosition)
+{
+    uint2 tile = min(uint2(svPosition.xy / clusterTileSize), uint2(CLUSTER_GRID_X - 1, CLUSTER_GRID_Y - 1));
+    uint slice = (uint) clamp(log(svPosition.w) * clusterDepthScale + clusterDepthBias, 0.0f, CLUSTER_GRID_Z - 1);
+    return (slice * CLUSTER_GRID_Y + tile.y) * CLUSTER_GRID_X + tile.x;
+}
+
+
+// Ʈ ϳ  (׸ )
+float3 EvaluateLight(Light light, float3 worldPos, float3 N, float3 V, float3 albedo, float3 F0, float metal, float rough)
+{
+    float3 L;       // L = lightDirection
+    float attenuation = 1.0f;
+
+    if (light.Type == 0)  // Directional
+    {
+        L = normalize(-light.Direction);
+    }
+    else
+    {
+        float3 toLight = light.Position - worldPos;
+        float dist = length(toLight);
+        L = toLight / dist;
+
+        // Ÿ 
+        attenuation = 1.0f / (light.Constant + light.Linear * dist + light.Quadratic * dist * dist);
+
+        // Range  0  ǵ  (Ŭ 迡    ʰ)
+        if (light.Range > 0.0f)
         {
-            shadowMapIdx += faceCount;
-            continue;
+            float ratio = dist / light.Range;
+            float window = saturate(1.0f - ratio * ratio * ratio * ratio);
+            attenuation *= window * window;
         }
-        
-        if (currentLight.ShadowCastingEnabled == 0)
+
+        // Spot 
+        if (light.Type == 2)
         {
-            shadowMapIdx += faceCount;
-            continue;
+            float cosTheta = dot(L, normalize(-light.Direction));
+            float innerCos = cos(light.InnerCutoffAngle);
+            float outerCos = cos(light.OuterCutoffAngle);
+            float spotAttenuation = saturate((cosTheta - outerCos) / (innerCos - outerCos));
+            attenuation *= spotAttenuation;
         }
+    }
 
-        //  PBR ó Radiance 
-        float3 L;       // L = lightDirection
-        float attenuation = 1.0f;
+    float NdotL = max(dot(N, L), 0.0f);
+    float3 radiance = light.Color * light.Strength * attenuation;
 
-        if (currentLight.Type == 0)  // Directional
+    float3 specular = BRDF_Specular(N, V, L, F0, rough);
+    float3 diffuse = BRDF_Diffuse(albedo, N, V, L, F0, metal);
+
+    return (diffuse + specular) * radiance * NdotL;
+}
+
+
+// 0 = ׸, 1 =  .    Ʈ ׻ 1
+float ComputeLightShadow(Light light, float3 worldPos)
+{
+    int shadowMapIdx = light.ShadowMapIndex;
+    if (light.ShadowCastingEnabled == 0 || shadowMapIdx < 0)
+    {
+        return 1.0f;
+    }
+
+    float lightFactor = 0.0f;
+
+    if (light.Type == 0)
+    {
+        // ĳ̵:  ̷ ĳ̵ ϳ ,  Һ ָ ׸ 
+        float viewDepth = dot(worldPos - cameraWorld, CameraForward);
+        int cascade = 0;
+        [unroll]
+        for (int c = 0; c < NUM_CASCADES - 1; ++c)
         {
-            L = normalize(-currentLight.Direction);
+            cascade += (viewDepth > CascadeSplits[c]) ? 1 : 0;
         }
-        else
+
+        if (viewDepth > CascadeSplits[NUM_CASCADES - 1])
         {
-            float3 toLight = currentLight.Position - worldPos;
-            float dist = length(toLight);
-            L = toLight / dist;
+            return 1.0f;
+        }
 
-            // Ÿ 
-            attenuation = 1.0f / (currentLight.Constant + currentLight.Linear * dist + currentLight.Quadratic * dist * dist);
+        float4 posLightSpace = mul(float4(worldPos, 1), ShadowMapViewProj[shadowMapIdx + cascade]);
+        lightFactor = SampleShadowMapPCF(shadowMapIdx + cascade, posLightSpace);
+    }
+    else if (light.Type == 1)
+    {
+        // Ʈ: ȼ  ť  ϳ 
+        int face = shadowMapIdx + CubeShadowFace(worldPos - light.Position);
+        float4 posLightSpace = mul(float4(worldPos, 1), ShadowMapViewProj[face]);
+        lightFactor = SampleShadowMapCmp4(face, posLightSpace);
+    }
+    else
+    {
+        float4 posLightSpace = mul(float4(worldPos, 1), ShadowMapViewProj[shadowMapIdx]);
+        lightFactor = SampleShadowMapPCF(shadowMapIdx, posLightSpace);
+    }
 
-            // Spot 
-            if (currentLight.Type == 2)
-            {
-                float cosTheta = dot(L, normalize(-currentLight.Direction));
-                float innerCos = cos(currentLight.InnerCutoffAngle);
-                float outerCos = cos(currentLight.OuterCutoffAngle);
-                float spotAttenuation = saturate((cosTheta - outerCos) / (innerCos - outerCos));
-                attenuation *= spotAttenuation;
-            }
-        }
+    // ׸ڰ  ϰ ̵ 
+    return pow(lightFactor, 2.0f);
+}
 
-        float NdotL = max(dot(N, L), 0.0f);
-        float3 radiance = currentLight.Color * currentLight.Strength * attenuation;
 
-        float3 specular = BRDF_Specular(N, V, L, F0, rough);
-        float3 diffuse = BRDF_Diffuse(albedo, N, V, L, F0, metal);
+// Ŭ : directional   ȼ, Ʈ /   ȼ Ŭ Ͽ
+float3 ComputePBRWithShadow(float3 worldPos, float3 worldNormal, float2 uv, float4 svPosition)
+{
+    float3 N = normalize(worldNormal);
+    float3 V = normalize(cameraWorld - worldPos);
+
+    float3 albedo = SampleAlbedo(uv);
+    float metal = SampleMetallic(uv);
+    float rough = SampleRoughness(uv);
+    float ao = SampleAO();
 
-        float3 lightContribute = (diffuse + specular) * radiance * NdotL;
-        
-        float lightFactor = 0.0f; // 0 = ׸,  1 = lit
+    float3 F0 = lerp(F_DIELECTRIC, albedo, metal);
+    float3 accumulatedLight = float3(0, 0, 0);
 
-        [unroll]
-        for (int f = 0; f < faceCount; ++f)
-        {
-            float4 posLightSpace = mul(float4(worldPos, 1), ShadowMapViewProj[shadowMapIdx + f]);
-            lightFactor += SampleShadowMapPCF(shadowMapIdx + f, posLightSpace);
-        }
-        
-        shadowMapIdx += faceCount;
-        
-        // 6鿡  ׸  
-        lightFactor /= faceCount;
-        
-        float3 shadowColor = float3(0.0f, 0.0f, 0.0f);
-        
-        //  = 3.0  
-        // ׸    ̰ ϱ 
-        lightFactor = pow(lightFactor, 2.0f);
-        
-        //  ⿩  litColor shadowColor ̸ 
-        float3 shadedContribution = lerp(shadowColor, lightContribute, lightFactor);
-
-        accumulatedLight += shadedContribution;
+    // 1) directional Ʈ (clusterLights պκ)
+    for (uint i = 0; i < directionalLightCount; ++i)
+    {
+        Light currentLight = clusterLights[i];
+        if (all(currentLight.Color * currentLight.Strength == 0))
+            continue;
+
+        accumulatedLight += EvaluateLight(currentLight, worldPos, N, V, albedo, F0, metal, rough)
+                          * ComputeLightShadow(currentLight, worldPos);
+    }
+
+    // 2)  ŬͿ  Ʈ /  Ʈ
+    uint cluster = ClusterIndexFromPosition(svPosition);
+    uint listOffset = clusterData[cluster * 2 + 0];
+    uint listCount = clusterData[cluster * 2 + 1];
+
+    for (uint j = 0; j < listCount; ++j)
+    {
+        Light currentLight = clusterLights[clusterData[listOffset + j]];
+        if (all(currentLight.Color * currentLight.Strength == 0))
+            continue;
+
+        accumulatedLight += EvaluateLight(currentLight, worldPos, N, V, albedo, F0, metal, rough)
+                          * ComputeLightShadow(currentLight, worldPos);
     }
 
-    // Ambient(IBL)  ׸   
+    // Ambient (IBL)  ׸  
     float3 ambient = IBL_Diffuse(albedo, N) * ao
                    + IBL_Specular(F0, N, V, rough);
 
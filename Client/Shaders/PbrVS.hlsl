@@ -2,10 +2,17 @@
 
 struct VSInput
 {
+#if COMPACT_VERTEX
+    float4 position : POSITION;     // UNORM16, mesh AABB relative (w = tangent sign)
+    float2 normal : NORMAL;         // octahedral SNORM16
+    float2 tangent : TANGENT;       // octahedral SNORM16
+    float2 uv : TEXCOORD;           // FLOAT16
+#else
     float3 position : POSITION;
     float3 normal : NORMAL;
     float3 tangent : TANGENT;
     float2 uv : TEXCOORD;
+#endif
 };
 
 struct VSOutput
@@ -21,14 +28,22 @@ VSOutput VSMain(VSInput input)
 {
     VSOutput output;
 
+#if COMPACT_VERTEX
+    float4 localPosition = float4(DecodeCompactPosition(input.position, positionScale, positionBias), 1.0);
+    float3 localNormal = OctDecode(input.normal);
+    float3 localTangent = OctDecode(input.tangent);
+#else
     float4 localPosition = float4(input.position, 1.0);
+    float3 localNormal = input.normal;
+    float3 localTangent = input.tangent;
+#endif
     float4 worldPosition = mul(localPosition, model);
     float4 viewPosition = mul(worldPosition, view);
 
     output.positionClip = mul(viewPosition, projection);
     output.positionWorld = worldPosition.xyz;
-    output.normalWorld = normalize(mul(input.normal, (float3x3)modelInvTranspose));
-    output.tangentWorld = normalize(mul(input.tangent, (float3x3)model));
+    output.normalWorld = normalize(mul(localNormal, (float3x3)modelInvTranspose));
+    output.tangentWorld = normalize(mul(localTangent, (float3x3)model));
     output.uv = input.uv;
 
     return output;
@@ -25,7 +25,9 @@ float4 PSMain(PSInput input) : SV_Target
         albedoColor *= materialData.diffuse;
 
     // Normal map
-    float3 normalTS = normalMap.Sample(samplerState, input.uv).xyz * 2.0 - 1.0;
+    float3 normalTS;
+    normalTS.xy = normalMap.Sample(samplerState, input.uv).xy * 2.0 - 1.0;
+    normalTS.z = sqrt(saturate(1.0 - dot(normalTS.xy, normalTS.xy)));   // BC5  xy  ϹǷ z 
     if (materialData.useNormalMap == 0)
         normalTS = float3(0, 0, 1);
 
@@ -0,0 +1,66 @@
+#include "Common.hlsli"
+
+// ĳʹ ο 1 Ʈ   : νϽ n  faceMask  n ° set bit  ,
+// SV_ViewportArrayIndex    Ʋ ŸϿ ׷ (viewport/scissor 迭 Ʈ )
+
+cbuffer CB_MVP : register(b0)
+{
+    float4x4 model;
+    float4x4 view;
+    float4x4 projection;
+    float4x4 modelInvTranspose;
+    float4 positionScale;       // compact  ڵ (COMPACT_VERTEX)
+    float4 positionBias;
+};
+
+cbuffer CB_ShadowMapViewProj : register(b1)
+{
+    float4x4 ShadowMapViewProj[MAX_SHADOW_DSV_COUNT];
+};
+
+cbuffer CB_ShadowFaces : register(b2)
+{
+    uint faceMask;      // bit i =  (firstFace + i)   ĳ͸ ׸
+    uint firstFace;     // Ʈ ù  ε
+};
+
+struct VSInput
+{
+#if COMPACT_VERTEX
+    float4 position : POSITION;     // UNORM16, ޽ AABB   ġ
+#else
+    float3 position : POSITION;
+#endif
+};
+
+struct VSOutput
+{
+    float4 position : SV_POSITION;
+    uint viewport : SV_ViewportArrayIndex;
+};
+
+VSOutput VSMain(VSInput input, uint instanceID : SV_InstanceID)
+{
+    // Ʒ set bit  instanceID     Ʈ  νϽ 
+    uint mask = faceMask;
+    for (uint i = 0; i < instanceID; ++i)
+    {
+        mask &= mask - 1;
+    }
+    uint face = firstbitlow(mask);
+
+    VSOutput output;
+#if COMPACT_VERTEX
+    float3 localPos = DecodeCompactPosition(input.position, positionScale, positionBias);
+#else
+    float3 localPos = input.position;
+#endif
+    float4 worldPos = mul(float4(localPos, 1.0f), model);
+    output.position = mul(worldPos, ShadowMapViewProj[firstFace + face]);
+    output.viewport = face;
+    return output;
+}
+
+void PSMain(VSOutput input)
+{
+}
@@ -1,12 +1,20 @@
+#include "Common.hlsli"
+
 cbuffer CB_ShadowMapPass : register(b0)
 {
     float4x4 worldMatrix;
     float4x4 lightViewProjMatrix;
+    float4 positionScale;       // compact vertex decode (COMPACT_VERTEX)
+    float4 positionBias;
 };
 
 struct VSInput
 {
+#if COMPACT_VERTEX
+    float4 position : POSITION;     // UNORM16, mesh AABB relative
+#else
     float3 position : POSITION;
+#endif
 };
 
 struct VSOutput
@@ -17,7 +25,12 @@ struct VSOutput
 VSOutput VSMain(VSInput input)
 {
     VSOutput output;
-    float4 worldPos = mul(float4(input.position, 1.0f), worldMatrix);
+#if COMPACT_VERTEX
+    float3 localPos = DecodeCompactPosition(input.position, positionScale, positionBias);
+#else
+    float3 localPos = input.position;
+#endif
+    float4 worldPos = mul(float4(localPos, 1.0f), worldMatrix);
     output.position = mul(worldPos, lightViewProjMatrix);
     return output;
 }
@@ -0,0 +1,18 @@
+//  ĳ ̾ Ÿ    Ʋ Ÿ  
+//  ҽ CopyTextureRegion  Ϻ    Ƿ
+// viewport/scissor  ŸϿ ߰ Ǯũ ﰢ SV_Depth  Ѵ
+
+Texture2D<float> StaticDepth : register(t0);
+
+float4 VSMain(uint vertexId : SV_VertexID) : SV_POSITION
+{
+    //    Ǯũ ﰢ (viewport  Ÿ ũ ߶ )
+    float2 uv = float2((vertexId << 1) & 2, vertexId & 2);
+    return float4(uv * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);
+}
+
+float PSMain(float4 position : SV_POSITION) : SV_Depth
+{
+    //  Ʋ󽺴 Ÿ ġ Ƿ  ȼ ǥ ״ 
+    return StaticDepth.Load(int3(position.xy, 0));
+}
@@ -0,0 +1,262 @@
+#include "AssetLoader.h"
+#include "Renderer.h"
+#include "Texture.h"
+#include "TextureManager.h"
+#include "TextureStreamer.h"
+#include "ModelLoader.h"
+#include "DebugManager.h"
+#include <DirectXTex.h>
+#include <objbase.h>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+namespace
+{
+    // WIC 디코드는 호출 스레드에 COM 이 초기화되어 있어야 함 (로더 작업마다 초기화 / 해제)
+    class ScopedComInit
+    {
+    public:
+        ScopedComInit() : result(CoInitializeEx(nullptr, COINIT_MULTITHREADED)) {}
+        ~ScopedComInit() { if (SUCCEEDED(result)) CoUninitialize(); }
+
+    private:
+        HRESULT result;
+    };
+}
+
+AssetLoader::AssetLoader(Renderer* renderer_, size_t threadCount)
+    : renderer(renderer_)
+    , loaderPool(std::make_unique<ThreadPool>(threadCount))
+{
+}
+
+AssetLoader::~AssetLoader()
+{
+    // 큐에 남은 작업은 cancelled 를 보고 바로 끝나고, join 이후에는 completed 에 아무도 쓰지 않음
+    cancelled = true;
+    loaderPool.reset();
+}
+
+AssetHandle<Texture> AssetLoader::LoadTextureAsync(const std::wstring& filePath, bool generateMips)
+{
+    return LoadTextureAsyncInternal(filePath, generateMips, false);
+}
+
+AssetHandle<Texture> AssetLoader::LoadCubeMapAsync(const std::wstring& filePath, bool generateMips)
+{
+    return LoadTextureAsyncInternal(filePath, generateMips, true);
+}
+
+AssetHandle<Texture> AssetLoader::LoadTextureAsyncInternal(const std::wstring& filePath, bool generateMips, bool isCubeMap)
+{
+    AssetHandle<Texture> handle;
+
+    // 1) 로드 중인 같은 경로면 상태 공유
+    if (auto it = pendingTextures.find(filePath); it != pendingTextures.end()) {
+        handle.state = it->second;
+        return handle;
+    }
+
+    bool created = false;
+    std::shared_ptr<Texture> texture = renderer->GetTextureManager()->AcquirePending(filePath, isCubeMap, created);
+
+    handle.state = std::make_shared<AssetHandle<Texture>::State>();
+    handle.state->asset = texture;
+
+    // 2) 이미 캐시에 있던 텍스쳐 (리소스가 없으면 이전 비동기 로드가 실패한 것)
+    if (!created) {
+        handle.state->state = texture->IsLoaded() ? AssetState::Ready : AssetState::Failed;
+        return handle;
+    }
+
+    pendingTextures[filePath] = handle.state;
+    ++pendingCount;
+
+    SubmitTextureLoad(filePath, generateMips, isCubeMap, !isCubeMap && renderer->IsTextureStreamingEnabled());
+    return handle;
+}
+
+void AssetLoader::SubmitTextureLoad(const std::wstring& filePath, bool generateMips, bool isCubeMap, bool streamed)
+{
+    loaderPool->Submit([this, filePath, generateMips, isCubeMap, streamed]() {
+        if (cancelled)
+            return;
+
+        // 3) 스트리밍: 픽셀 전체를 디코드하지 않고 DDS 헤더 + 밉 tail 만 읽음
+        //    렌더 스레드에서 등록하지 못하면 (밉 1개, 전체가 tail 등) 전체 디코드로 다시 제출
+        if (streamed) {
+            auto source = std::make_shared<TextureStreamer::Source>();
+            if (TextureStreamer::ReadSource(filePath, *source)) {
+                PushCompleted([this, filePath, generateMips, source]() {
+                    auto it = pendingTextures.find(filePath);
+                    if (it == pendingTextures.end())
+                        return;
+
+                    if (renderer->IsTextureStreamingEnabled()
+                        && renderer->GetTextureManager()->CompleteStreamed(filePath, it->second->asset, *source))
+                        FinishTexture(filePath, true);
+                    else
+                        SubmitTextureLoad(filePath, generateMips, false, false);
+                });
+                return;
+            }
+        }
+
+        // 4) 디코드 + 밉 생성 (ScratchImage 는 move-only 라 shared_ptr 로 넘김)
+        auto image = std::make_shared<DirectX::ScratchImage>();
+        bool decoded = false;
+        {
+            ScopedComInit com;
+            decoded = isCubeMap
+                ? Texture::DecodeCubeMapFile(filePath, generateMips, *image)
+                : Texture::DecodeFile(filePath, *image);
+        }
+
+        // 5) 렌더 스레드: 업로드 + 전용 SRV 로 교체
+        PushCompleted([this, filePath, isCubeMap, image, decoded]() {
+            auto it = pendingTextures.find(filePath);
+            if (it == pendingTextures.end())
+                return;
+
+            FinishTexture(filePath, decoded
+                && renderer->GetTextureManager()->CompletePending(filePath, it->second->asset, image, isCubeMap));
+        });
+    });
+}
+
+void AssetLoader::FinishTexture(const std::wstring& filePath, bool loaded)
+{
+    auto it = pendingTextures.find(filePath);
+    auto state = it->second;
+    pendingTextures.erase(it);
+    --pendingCount;
+
+    state->state = loaded ? AssetState::Ready : AssetState::Failed;
+    if (!loaded) {
+        DebugManager::GetInstance().LogMessage(std::format(L"[Asset] Failed to load texture {}", filePath));
+    }
+}
+
+AssetHandle<Mesh> AssetLoader::LoadMeshAsync(const std::string& filePath,
+    std::function<void(const std::shared_ptr<Mesh>&)> onReady)
+{
+    AssetHandle<Mesh> handle;
+
+    // 1) 로드 중인 같은 경로면 상태를 공유하고 onReady 만 추가
+    if (auto it = pendingMeshes.find(filePath); it != pendingMeshes.end()) {
+        if (onReady)
+            it->second.onReady.push_back(std::move(onReady));
+        handle.state = it->second.state;
+        return handle;
+    }
+
+    handle.state = std::make_shared<AssetHandle<Mesh>::State>();
+
+    PendingMesh& pending = pendingMeshes[filePath];
+    pending.state = handle.state;
+    if (onReady)
+        pending.onReady.push_back(std::move(onReady));
+    ++pendingCount;
+
+    // 2) 로더 스레드: 캐시 읽기 또는 Assimp 임포트 (Importer 는 스레드 간 공유 불가라 작업마다 ModelLoader 생성)
+    loaderPool->Submit([this, filePath]() {
+        if (cancelled)
+            return;
+
+        auto data = std::make_shared<ModelLoader::MeshData>();
+        bool imported = false;
+        {
+            ModelLoader loader;
+            // 풀 작업 안에서 같은 풀을 Wait 하면 교착되므로 탄젠트는 이 스레드에서 순차 생성
+            imported = loader.LoadMeshData(filePath, nullptr, *data);
+        }
+
+        // 3) 렌더 스레드: 버퍼 업로드 후 요청마다 onReady
+        PushCompleted([this, filePath, data, imported]() {
+            auto it = pendingMeshes.find(filePath);
+            if (it == pendingMeshes.end())
+                return;
+
+            PendingMesh pending = std::move(it->second);
+            pendingMeshes.erase(it);
+            --pendingCount;
+
+            const auto& state = pending.state;
+            std::shared_ptr<Mesh> mesh = imported ? ModelLoader::CreateMesh(renderer, *data) : nullptr;
+            if (!mesh) {
+                state->state = AssetState::Failed;
+                DebugManager::GetInstance().LogMessage(std::format(L"[Asset] Failed to load mesh {}",
+                    std::filesystem::path(filePath).wstring()));
+                return;
+            }
+
+            state->asset = mesh;
+            state->state = AssetState::Ready;
+            for (const auto& onReady : pending.onReady)
+                onReady(mesh);
+        });
+    });
+
+    return handle;
+}
+
+void AssetLoader::ReadFileAsync(const std::filesystem::path& path, uint64_t offset, uint64_t size,
+    std::function<void(std::vector<uint8_t>&& bytes)> onRead)
+{
+    loaderPool->Submit([this, path, offset, size, onRead = std::move(onRead)]() mutable {
+        if (cancelled)
+            return;
+
+        auto bytes = std::make_shared<std::vector<uint8_t>>();
+        if (!ReadFileRange(path, offset, size, *bytes))
+            bytes->clear();
+
+        std::lock_guard<std::mutex> lock(completedMutex);
+        completedReads.push_back([onRead = std::move(onRead), bytes]() { onRead(std::move(*bytes)); });
+    });
+}
+
+bool AssetLoader::ReadFileRange(const std::filesystem::path& path, uint64_t offset, uint64_t size, std::vector<uint8_t>& outBytes)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    outBytes.resize(static_cast<size_t>(size));
+    file.seekg(static_cast<std::streamoff>(offset));
+    file.read(reinterpret_cast<char*>(outBytes.data()), static_cast<std::streamsize>(size));
+    return bool(file);
+}
+
+void AssetLoader::PushCompleted(std::function<void()> finalize)
+{
+    std::lock_guard<std::mutex> lock(completedMutex);
+    completed.push_back(std::move(finalize));
+}
+
+void AssetLoader::ProcessCompleted()
+{
+    // 읽기 완료는 업로드를 기록만 하고 기다리지 않으므로 전부 처리
+    std::vector<std::function<void()>> reads;
+    {
+        std::lock_guard<std::mutex> lock(completedMutex);
+        reads.swap(completedReads);
+    }
+    for (const auto& onRead : reads)
+        onRead();
+
+    // 업로드는 Copy 큐 완료까지 기다리므로 프레임당 개수를 제한해 나머지는 다음 프레임으로 미룸
+    for (size_t i = 0; i < MaxUploadsPerFrame; ++i)
+    {
+        std::function<void()> finalize;
+        {
+            std::lock_guard<std::mutex> lock(completedMutex);
+            if (completed.empty())
+                return;
+            finalize = std::move(completed.front());
+            completed.pop_front();
+        }
+        finalize();
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include "ThreadPool.h"
+
+class Renderer;
+class Texture;
+class Mesh;
+
+enum class AssetState : uint8_t
+{
+    Loading,
+    Ready,
+    Failed,
+};
+
+// ---------------------------------------------------------------------------
+// 비동기 로드 결과 (future 형태 핸들)
+//   - 상태는 렌더 스레드의 AssetLoader::ProcessCompleted() 에서만 바뀐다 (메인 스레드에서 조회)
+//   - Get(): 텍스쳐는 요청 즉시 자리표시자 SRV 를 가리키는 Texture, 메시는 준비되기 전까지 nullptr
+// ---------------------------------------------------------------------------
+template <typename T>
+class AssetHandle
+{
+public:
+    AssetHandle() = default;
+
+    bool IsValid() const { return state != nullptr; }
+    AssetState GetState() const { return state ? state->state : AssetState::Failed; }
+    bool IsReady() const { return GetState() == AssetState::Ready; }
+    bool IsFailed() const { return GetState() == AssetState::Failed; }
+
+    std::shared_ptr<T> Get() const { return state ? state->asset : nullptr; }
+
+private:
+    friend class AssetLoader;
+
+    struct State
+    {
+        AssetState state = AssetState::Loading;
+        std::shared_ptr<T> asset;
+    };
+    std::shared_ptr<State> state;
+};
+
+// ---------------------------------------------------------------------------
+// AssetLoader
+// 모델 / 텍스쳐 로드를 CPU 단계와 GPU 단계로 나눠 처리
+//   1) 로더 스레드: Assimp 임포트 (또는 메시 캐시 읽기), WIC/DDS 디코드 + 밉 생성
+//      스트리밍할 2D 텍스쳐는 디코드 없이 DDS 헤더와 밉 tail 만 읽음 (TextureStreamer::ReadSource)
+//   2) 렌더 스레드: Renderer::Update 의 프레임 시작 지점에서 업로드 + SRV 생성 (프레임당 개수 제한)
+// 렌더러의 ThreadPool 은 멀티스레드 렌더링 워커가 barrier 로 전부 점유하므로 전용 풀을 쓴다
+// ---------------------------------------------------------------------------
+class AssetLoader
+{
+public:
+    // 한 프레임에 GPU 업로드까지 마치는 최대 에셋 수 (Copy 큐 대기가 프레임을 길게 막지 않도록)
+    static constexpr size_t MaxUploadsPerFrame = 2;
+
+    explicit AssetLoader(Renderer* renderer, size_t threadCount = 2);
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // 같은 경로는 TextureManager 캐시의 Texture 를 공유 (로드 중이면 같은 핸들 상태를 공유)
+    AssetHandle<Texture> LoadTextureAsync(const std::wstring& filePath, bool generateMips = false);
+    AssetHandle<Texture> LoadCubeMapAsync(const std::wstring& filePath, bool generateMips = false);
+
+    // onReady: 업로드가 끝난 프레임에 렌더 스레드에서 호출 (GameObject::SetMesh 등)
+    // 로드 중인 같은 경로는 임포트를 한 번만 하고 핸들 상태 / 완성된 Mesh 를 공유 (onReady 는 요청마다 호출)
+    AssetHandle<Mesh> LoadMeshAsync(const std::string& filePath,
+        std::function<void(const std::shared_ptr<Mesh>&)> onReady = {});
+
+    // 파일의 [offset, offset + size) 를 로더 스레드에서 읽고 onRead 는 렌더 스레드의 ProcessCompleted 에서 호출
+    // (TextureStreamer 의 밉 읽기, 업로드 개수 제한과 별개로 매 프레임 전부 넘김) 읽지 못하면 bytes 가 비어 있음
+    void ReadFileAsync(const std::filesystem::path& path, uint64_t offset, uint64_t size,
+        std::function<void(std::vector<uint8_t>&& bytes)> onRead);
+
+    // 파일 구간 하나만 읽음 (호출 스레드에서 바로, 로더 작업용)
+    static bool ReadFileRange(const std::filesystem::path& path, uint64_t offset, uint64_t size, std::vector<uint8_t>& outBytes);
+
+    // 렌더 스레드 안전 지점에서 호출: 완료된 CPU 작업의 GPU 단계를 처리
+    void ProcessCompleted();
+
+    // 요청했지만 아직 Ready/Failed 가 아닌 에셋 수 (로딩 화면 / 레벨 전환 판단용)
+    size_t GetPendingCount() const { return pendingCount; }
+
+private:
+    AssetHandle<Texture> LoadTextureAsyncInternal(const std::wstring& filePath, bool generateMips, bool isCubeMap);
+
+    // 로더 작업 제출: streamed 면 헤더 / tail 만 읽고, 스트리밍할 수 없으면 전체 디코드로 다시 제출
+    void SubmitTextureLoad(const std::wstring& filePath, bool generateMips, bool isCubeMap, bool streamed);
+    void FinishTexture(const std::wstring& filePath, bool loaded);
+
+    // 로더 스레드 → 렌더 스레드로 넘기는 GPU 단계
+    void PushCompleted(std::function<void()> finalize);
+
+    Renderer* renderer = nullptr;
+
+    // 로드 중인 텍스쳐의 핸들 상태 (경로 → 상태, 렌더 스레드 전용)
+    std::unordered_map<std::wstring, std::shared_ptr<AssetHandle<Texture>::State>> pendingTextures;
+
+    // 로드 중인 메시 (경로 → 상태 + 요청별 onReady, 렌더 스레드 전용)
+    // 같은 경로를 동시에 임포트하면 MeshCache::Write 의 임시 파일을 서로 덮어쓰므로 한 작업으로 합친다
+    struct PendingMesh
+    {
+        std::shared_ptr<AssetHandle<Mesh>::State> state;
+        std::vector<std::function<void(const std::shared_ptr<Mesh>&)>> onReady;
+    };
+    std::unordered_map<std::string, PendingMesh> pendingMeshes;
+
+    std::mutex completedMutex;
+    std::deque<std::function<void()>> completed;
+    std::vector<std::function<void()>> completedReads;     // ReadFileAsync (개수 제한 없음)
+
+    size_t pendingCount = 0;
+
+    // 종료 시 아직 시작하지 않은 작업은 디코드 없이 버림
+    std::atomic<bool> cancelled{ false };
+
+    // 마지막에 선언: 소멸 시 가장 먼저 join 되어 작업이 위 멤버를 건드리지 않음
+    std::unique_ptr<ThreadPool> loaderPool;
+};
@@ -53,12 +53,24 @@ XMVECTOR Camera::GetRotationQuat() const {
     return rotationQuat;
 }
 
-void Camera::SetOrthographic(float width, float height, float nearZ, float farZ) {
-    projectionMatrix = XMMatrixOrthographicLH(width, height, nearZ, farZ);
+void Camera::SetOrthographic(float width, float height, float nearZ_, float farZ_) {
+    projectionMatrix = XMMatrixOrthographicLH(width, height, nearZ_, farZ_);
+
+    perspective = false;
+    fovY = 0.0f;
+    aspectRatio = width / height;
+    nearZ = nearZ_;
+    farZ = farZ_;
 }
 
-void Camera::SetPerspective(float fovY, float aspectRatio, float nearZ, float farZ) {
-    projectionMatrix = XMMatrixPerspectiveFovLH(fovY, aspectRatio, nearZ, farZ);
+void Camera::SetPerspective(float fovY_, float aspectRatio_, float nearZ_, float farZ_) {
+    projectionMatrix = XMMatrixPerspectiveFovLH(fovY_, aspectRatio_, nearZ_, farZ_);
+
+    perspective = true;
+    fovY = fovY_;
+    aspectRatio = aspectRatio_;
+    nearZ = nearZ_;
+    farZ = farZ_;
 }
 
 void Camera::UpdateViewMatrix() {
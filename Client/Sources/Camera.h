@@ -22,6 +22,13 @@ public:
     XMMATRIX GetViewMatrix() const;
     XMMATRIX GetProjectionMatrix() const;
 
+    // 투영 파라미터 (섀도우 캐스케이드 분할/피팅용)
+    bool  IsPerspective() const { return perspective; }
+    float GetFovY() const { return fovY; }
+    float GetAspectRatio() const { return aspectRatio; }
+    float GetNearZ() const { return nearZ; }
+    float GetFarZ() const { return farZ; }
+
     XMFLOAT3 GetForwardVector() const;
     XMFLOAT3 GetUpVector() const;
 
@@ -34,4 +41,10 @@ private:
 
     XMMATRIX viewMatrix;
     XMMATRIX projectionMatrix;
+
+    bool  perspective = false;
+    float fovY = 0.0f;
+    float aspectRatio = 1.0f;
+    float nearZ = 0.0f;
+    float farZ = 1.0f;
 };
@@ -14,13 +14,25 @@ struct CB_MVP
     XMFLOAT4X4 view;
     XMFLOAT4X4 projection;
     XMFLOAT4X4 modelInvTranspose;
+
+    // Compact 정점 위치 디코드: p = q * scale + bias (Full 메시는 사용 안 함)
+    XMFLOAT4 positionScale;
+    XMFLOAT4 positionBias;
 };
 
 struct CB_Lighting
 {
     XMFLOAT3 cameraWorld;
     float padding; // align 16 bytes
-    LightData lights[MAX_LIGHTS];
+    LightData lights[MAX_LIGHTS];     // Phong 경로용 (앞쪽 MAX_LIGHTS 개)
+
+    // 클러스터드 라이팅 (PBR): 라이트는 t8, 클러스터 목록은 t9
+    uint32_t clusterLightCount;
+    uint32_t directionalLightCount;     // t8 앞쪽 Directional 수 (클러스터 목록 밖에서 모든 픽셀 적용)
+    float    clusterDepthScale;         // slice = log(viewZ) * scale + bias
+    float    clusterDepthBias;
+    XMFLOAT2 clusterTileSize;           // 타일 한 칸의 픽셀 크기
+    float    clusterPadding[2];
 };
 
 
@@ -47,6 +59,10 @@ static constexpr uint32_t USE_NORMAL_MAP = 1 << 1;
 static constexpr uint32_t USE_METALLIC_MAP = 1 << 2;
 static constexpr uint32_t USE_ROUGHNESS_MAP = 1 << 3;
 
+// 셰이더 퍼뮤테이션 키 (MATERIAL_FEATURES define) 로 쓰이는 비트들
+static constexpr uint32_t MATERIAL_FEATURE_MASK = USE_ALBEDO_MAP | USE_NORMAL_MAP | USE_METALLIC_MAP | USE_ROUGHNESS_MAP;
+static constexpr uint32_t MATERIAL_FEATURE_PERMUTATION_COUNT = MATERIAL_FEATURE_MASK + 1;
+
 
 // PBR 전용 (16B 정렬)
 struct CB_MaterialPBR
@@ -65,6 +81,24 @@ struct CB_MaterialPBR
     float    padding[4];
 };
 
+// Bindless 머티리얼 테이블 한 줄 (StructuredBuffer, PbrLighting.hlsli 의 MaterialData 와 동일)
+// CB_MaterialPBR 의 padding 자리에 텍스쳐 heap index 를 넣은 형태
+struct MaterialGpuData
+{
+    XMFLOAT3 baseColor;
+    float    metallic;
+
+    float    specular;
+    float    roughness;
+    float    ambientOcclusion;
+    float    emissiveIntensity;
+
+    XMFLOAT3 emissiveColor;
+    uint32_t flags;
+
+    uint32_t textureIndices[4];     // 0=Albedo, 1=Normal, 2=Metallic, 3=Roughness
+};
+
 struct CB_Global {
     float time;
     float padding[3]; // 16바이트 정렬
@@ -93,11 +127,18 @@ struct CB_ToneMapping
 struct CB_ShadowMapPass {
     XMFLOAT4X4 modelWorld;
     XMFLOAT4X4 lightViewProj;
+    XMFLOAT4 positionScale;     // CB_MVP 와 동일
+    XMFLOAT4 positionBias;
 };
 
 struct CB_ShadowMapViewProj {
     XMFLOAT4X4 ShadowMapViewProj[MAX_SHADOW_DSV_COUNT];
+    XMFLOAT4   shadowAtlasRects[MAX_SHADOW_DSV_COUNT];  // xy: scale, zw: offset (아틀라스 UV)
+    XMFLOAT4   cascadeSplits;       // 캐스케이드 i 의 far 뷰 깊이
+    XMFLOAT3   cameraForward;
+    float      cascadeCount;
 };
+static_assert(NUM_CASCADES == 4, "cascadeSplits 는 float4 로 전달");
 
 
 struct CB_CloudParameters {
@@ -0,0 +1,104 @@
+#include "DescriptorAllocator.h"
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+
+void DescriptorAllocator::Reset(uint32_t newCapacity)
+{
+    capacity = newCapacity;
+    nextFreeIndex = 0;
+    freeRanges.clear();
+    pendingFrees.clear();
+}
+
+uint32_t DescriptorAllocator::Allocate(uint32_t count)
+{
+    // 1) free list first-fit
+    for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it)
+    {
+        if (it->second < count)
+            continue;
+
+        const uint32_t index = it->first;
+        const uint32_t remaining = it->second - count;
+        freeRanges.erase(it);
+        if (remaining > 0)
+            freeRanges.emplace(index + count, remaining);
+        return index;
+    }
+
+    // 2) bump
+    if (nextFreeIndex + count > capacity)
+        throw std::runtime_error("DescriptorAllocator: heap exhausted");
+
+    const uint32_t index = nextFreeIndex;
+    nextFreeIndex += count;
+    return index;
+}
+
+void DescriptorAllocator::Release(uint32_t index, uint32_t count)
+{
+    assert(index + count <= nextFreeIndex && "DescriptorAllocator: invalid free range");
+
+    uint32_t begin = index;
+    uint32_t end = index + count;
+
+    // 앞 구간과 병합
+    auto next = freeRanges.lower_bound(begin);
+    if (next != freeRanges.begin())
+    {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == begin)
+        {
+            begin = prev->first;
+            freeRanges.erase(prev);
+        }
+    }
+
+    // 뒤 구간과 병합
+    if (next != freeRanges.end() && next->first == end)
+    {
+        end = next->first + next->second;
+        freeRanges.erase(next);
+    }
+
+    // bump 포인터 바로 앞이면 free list 대신 포인터를 되돌린다
+    if (end == nextFreeIndex)
+    {
+        nextFreeIndex = begin;
+        return;
+    }
+
+    freeRanges.emplace(begin, end - begin);
+}
+
+void DescriptorAllocator::Free(uint32_t index, uint32_t count, uint64_t fenceValue)
+{
+    if (count == 0)
+        return;
+
+    pendingFrees.push_back({ index, count, fenceValue });
+}
+
+void DescriptorAllocator::ProcessDeferredFrees(uint64_t completedFenceValue)
+{
+    // 완료된 것은 반환하고 남은 것만 앞으로 당긴다 (하나씩 erase 하면 보류 목록이 길 때 O(n^2))
+    std::erase_if(pendingFrees, [&](const PendingFree& pending) {
+        if (pending.fenceValue > completedFenceValue)
+            return false;
+        Release(pending.index, pending.count);
+        return true;
+    });
+}
+
+DescriptorAllocator::Stats DescriptorAllocator::GetStats() const
+{
+    Stats stats;
+    stats.capacity = capacity;
+    stats.bumpIndex = nextFreeIndex;
+    stats.freeRanges = static_cast<uint32_t>(freeRanges.size());
+    for (const auto& [offset, count] : freeRanges)
+        stats.freeDescriptors += count;
+    stats.pendingFrees = static_cast<uint32_t>(pendingFrees.size());
+    return stats;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// 디스크립터 힙 한 개의 슬롯 할당 (D3D 없이 동작하는 순수 로직, DescriptorHeapManager 가 힙마다 하나씩 소유)
+//   - range free list(offset -> count), 인접 구간은 병합하고 first-fit 으로 재사용, 없으면 bump
+//   - Free() 는 fence 값과 함께 보류되었다가 ProcessDeferredFrees() 에서 free list 로 반환
+//   - bump 포인터 바로 앞 구간이 해제되면 free list 대신 포인터를 되돌린다
+// 쓰레드 안전하지 않음 (호출자가 lock)
+// ---------------------------------------------------------------------------
+class DescriptorAllocator
+{
+public:
+    struct Stats
+    {
+        uint32_t capacity = 0;
+        uint32_t bumpIndex = 0;
+        uint32_t freeDescriptors = 0;   // free list 에 있는 슬롯 수
+        uint32_t freeRanges = 0;
+        uint32_t pendingFrees = 0;      // fence 대기 중인 해제 요청 수
+    };
+
+    void Reset(uint32_t capacity);
+
+    // 연속 count 개의 시작 인덱스, 공간이 없으면 std::runtime_error
+    uint32_t Allocate(uint32_t count);
+
+    // 즉시 반환 (GPU 가 더 이상 참조하지 않는 슬롯)
+    void Release(uint32_t index, uint32_t count);
+
+    // fenceValue 가 완료된 뒤에야 슬롯이 재사용된다
+    void Free(uint32_t index, uint32_t count, uint64_t fenceValue);
+    void ProcessDeferredFrees(uint64_t completedFenceValue);
+
+    Stats GetStats() const;
+
+private:
+    struct PendingFree
+    {
+        uint32_t index;
+        uint32_t count;
+        uint64_t fenceValue;
+    };
+
+    uint32_t capacity = 0;
+    uint32_t nextFreeIndex = 0;                 // bump 포인터
+    std::map<uint32_t, uint32_t> freeRanges;    // offset -> count
+    std::vector<PendingFree> pendingFrees;
+};
@@ -7,7 +7,8 @@ bool DescriptorHeapManager::Initialize(ID3D12Device* device,
     UINT samplerCount,
     UINT rtvCount,
     UINT dsvCount,
-    UINT backBufferCount)
+    UINT backBufferCount,
+    UINT transientCountPerFrame)
 {
 
     if (!CreateDescriptorHeap(device, HeapType::D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, cbvSrvUavCount, true)) {
@@ -26,6 +27,19 @@ bool DescriptorHeapManager::Initialize(ID3D12Device* device,
         return false;
     }
 
+    // CBV_SRV_UAV 힙의 뒷부분을 프레임별 transient ring 으로 예약 (영구 할당은 앞부분만)
+    const UINT transientTotal = transientCountPerFrame * backBufferCount;
+    if (transientTotal > 0)
+    {
+        auto& info = descriptorHeaps[static_cast<size_t>(HeapType::D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)];
+        if (transientTotal >= info.maxDescriptors)
+            return false;
+
+        const UINT persistentCount = info.maxDescriptors - transientTotal;
+        info.allocator.Reset(persistentCount);
+        transientRing.Reset(persistentCount, transientCountPerFrame, backBufferCount);
+    }
+
     return true;
 }
 
@@ -207,7 +221,7 @@ bool DescriptorHeapManager::CreateDescriptorHeap(
         ->GetCPUDescriptorHandleForHeapStart();
     info.gpuStart = info.descriptorHeap
         ->GetGPUDescriptorHandleForHeapStart();
-    info.nextFreeIndex = 0;
+    info.allocator.Reset(descriptorCount);
     return true;
 }
 
@@ -217,20 +231,56 @@ DescriptorHandle DescriptorHeapManager::Allocate(
 {
     auto& info = descriptorHeaps[static_cast<size_t>(heapType)];
 
-    if (info.nextFreeIndex + count > info.maxDescriptors)
-        throw std::runtime_error("DescriptorHeapManager: heap exhausted");
+    std::lock_guard<std::mutex> lock(allocationMutex);
+    return MakeHandle(info, info.allocator.Allocate(count));
+}
+
+void DescriptorHeapManager::Free(
+    D3D12_DESCRIPTOR_HEAP_TYPE heapType,
+    const DescriptorHandle& handle,
+    UINT count,
+    UINT64 fenceValue)
+{
+    std::lock_guard<std::mutex> lock(allocationMutex);
+    descriptorHeaps[static_cast<size_t>(heapType)].allocator.Free(handle.index, count, fenceValue);
+}
 
+void DescriptorHeapManager::ProcessDeferredFrees(UINT64 completedFenceValue)
+{
+    std::lock_guard<std::mutex> lock(allocationMutex);
+    for (auto& info : descriptorHeaps)
+        info.allocator.ProcessDeferredFrees(completedFenceValue);
+}
+
+void DescriptorHeapManager::BeginFrame(UINT frameIndex)
+{
+    transientRing.BeginFrame(frameIndex);
+}
+
+DescriptorHandle DescriptorHeapManager::AllocateTransient(UINT count)
+{
+    const auto& info = descriptorHeaps[static_cast<size_t>(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)];
+    return MakeHandle(info, transientRing.Allocate(count));
+}
+
+DescriptorAllocator::Stats DescriptorHeapManager::GetStats(D3D12_DESCRIPTOR_HEAP_TYPE heapType) const
+{
+    std::lock_guard<std::mutex> lock(allocationMutex);
+    return descriptorHeaps[static_cast<size_t>(heapType)].allocator.GetStats();
+}
+
+DescriptorHandle DescriptorHeapManager::MakeHandle(const DescriptorHeapInfo& info, UINT index) const
+{
     DescriptorHandle handle;
     handle.cpuHandle.ptr =
-        info.cpuStart.ptr + SIZE_T(info.nextFreeIndex) * info.descriptorSize;
+        info.cpuStart.ptr + SIZE_T(index) * info.descriptorSize;
 
     if (info.isShaderVisible)
         handle.gpuHandle.ptr =
-        info.gpuStart.ptr + UINT64(info.nextFreeIndex) * info.descriptorSize;
+        info.gpuStart.ptr + UINT64(index) * info.descriptorSize;
     else
         handle.gpuHandle.ptr = 0;
 
-    handle.index = info.nextFreeIndex;
-    info.nextFreeIndex += count;
+    handle.index = index;
     return handle;
 }
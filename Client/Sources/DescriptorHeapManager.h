@@ -3,9 +3,11 @@
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <array>
-#include <stdexcept>
+#include <mutex>
 
 #include "DescriptorHandle.h"
+#include "DescriptorAllocator.h"
+#include "TransientDescriptorRing.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -34,6 +36,11 @@ Sampler의 경우 추후 Sampler Manager 를 두어 여기서 관리하도록 
 //   - RTV
 //   - DSV
 // Also creates a dedicated SRV heap for ImGui resources.
+//
+// Allocation
+//   - 힙마다 DescriptorAllocator (range free list + bump, fence 로 보류되는 Free)
+//   - 영구 할당/해제는 allocationMutex 아래에서 처리 (텍스쳐 로드 / 스트리밍처럼 프레임당 몇 번 안 되는 경로)
+//   - CBV_SRV_UAV 힙 끝부분은 프레임별 transient ring (드로우마다 만드는 동적 테이블용, lock 없이 스레드별 커서)
 // ---------------------------------------------------------------------------
 class DescriptorHeapManager
 {
@@ -44,12 +51,26 @@ public:
         UINT samplerCount = 128,
         UINT rtvCount = 8,
         UINT dsvCount = 4,
-        UINT backBufferCount = 3);
+        UINT backBufferCount = 3,
+        UINT transientCountPerFrame = 0);
 
     bool InitializeImGuiDescriptorHeaps(ID3D12Device* device, UINT imguiSrvCount = 4, UINT imguiSamplerCount = 1);
 
+    // 여러 스레드에서 호출 가능
     DescriptorHandle Allocate(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT count = 1);
 
+    // fenceValue 가 완료된 뒤에야 슬롯이 재사용된다
+    void Free(D3D12_DESCRIPTOR_HEAP_TYPE type, const DescriptorHandle& handle, UINT count, UINT64 fenceValue);
+    void ProcessDeferredFrees(UINT64 completedFenceValue);
+
+    // Transient ring: 프레임 시작 시 해당 프레임 구간을 리셋하고, 그 프레임 동안만 유효한 연속 CBV_SRV_UAV 슬롯을 준다
+    // AllocateTransient 는 렌더 워커에서 lock 없이 호출 가능, BeginFrame 은 워커 제출 전에 한 번
+    void BeginFrame(UINT frameIndex);
+    DescriptorHandle AllocateTransient(UINT count);
+
+    DescriptorAllocator::Stats GetStats(D3D12_DESCRIPTOR_HEAP_TYPE type) const;
+    TransientDescriptorRing::Stats GetTransientStats() const { return transientRing.GetStats(); }
+
     ID3D12DescriptorHeap* GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE type) const;
     UINT GetDescriptorSize(D3D12_DESCRIPTOR_HEAP_TYPE type) const;      // 하나의 디스크립터 슬롯이 차지하는 바이트 크기 리턴
 
@@ -81,8 +102,9 @@ private:
         D3D12_GPU_DESCRIPTOR_HANDLE gpuStart;
         UINT descriptorSize = 0;                     // 한 슬롯당 바이트 오프셋(= GetDescriptorHandleIncrementSize)
         UINT maxDescriptors = 0;                     // NumDescriptors
-        UINT nextFreeIndex = 0;                     // Allocate() 시 사용할 다음 인덱스
         bool isShaderVisible = false;                 // SHADER_VISIBLE 플래그 사용 여부
+
+        DescriptorAllocator allocator;              // [0, maxDescriptors) 슬롯 관리
     };
 
     // index 0: CBV_SRV_UAV, 1: Sampler, 2: RTV, 3: DSV
@@ -93,6 +115,13 @@ private:
 
     bool CreateDescriptorHeap(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT count, bool shaderVisible);
 
+    DescriptorHandle MakeHandle(const DescriptorHeapInfo& info, UINT index) const;
+
+    mutable std::mutex allocationMutex;
+
+    // CBV_SRV_UAV 힙의 [maxDescriptors - transientCountPerFrame * backBufferCount, maxDescriptors)
+    TransientDescriptorRing transientRing;
+
     D3D12_GPU_DESCRIPTOR_HANDLE linearWrapSamplerHandle;
     D3D12_GPU_DESCRIPTOR_HANDLE linearClampSamplerHandle;
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "FrameResource.h"
 #include "D3DUtil.h" 
+#include "MaterialTable.h"
+#include "LightClusterGrid.h"
 #include <dxgi1_6.h>
 #include <directx/d3dx12.h>
 
@@ -7,27 +9,27 @@ FrameResource::FrameResource(
     ID3D12Device* device,
     DescriptorHeapManager* descriptorHeapManager,
     UINT objectCount,
-    UINT frameWidth,
-    UINT frameHeight,
+    std::shared_ptr<SceneTargets> sharedSceneTargets,
+    std::shared_ptr<ShadowMap> sharedShadowAtlas,
     UINT numThreads,
     bool enableMultiThreaded)
     : numThreads(numThreads)
     ,useMultiThreadedRendering(enableMultiThreaded)
     ,syncPoint(numThreads+1)
+    ,sceneTargets(std::move(sharedSceneTargets))
+    ,shadowAtlas(std::move(sharedShadowAtlas))
 {
-
+    // 프레임마다 따로 두는 건 CPU 가 쓰는 것(커맨드 할당자, 업로드 버퍼)뿐
+    // 렌더 타겟 / 깊이 / 섀도우 아틀라스는 공유
     InitializeCommandBundles(device, numThreads);
     
 
     // 상수 버퍼들 초기화
     InitializeConstantBuffers(device, objectCount);
 
-    // Off-screen, Depth, ShadowMap 리소스 + 뷰 생성
-    InitializeFrameBuffersAndViews(
-        device,
-        descriptorHeapManager,
-        frameWidth,
-        frameHeight);
+    // per-object SRV/CBV/UAV 풀 초기화
+    // 미사용
+    objectSrvCbvUav.clear();
 }
 
 void FrameResource::InitializeConstantBuffers(
@@ -43,14 +45,20 @@ void FrameResource::InitializeConstantBuffers(
     cbOutline = std::make_unique<UploadBuffer<CB_OutlineOptions>>(device, 1, true);
     cbToneMapping = std::make_unique<UploadBuffer<CB_ToneMapping>>(device, 1, true);
     cbShadowViewProj = std::make_unique<UploadBuffer<CB_ShadowMapViewProj>>(device, 1, true);
+
+    materialTable = std::make_unique<UploadBuffer<MaterialGpuData>>(device, MaterialTable::MaxMaterials, false);
+
+    clusterLights = std::make_unique<UploadBuffer<LightData>>(device, MAX_CLUSTERED_LIGHTS, false);
+    clusterData = std::make_unique<UploadBuffer<uint32_t>>(device, CLUSTER_DATA_SIZE, false);
 }
 
-void FrameResource::InitializeFrameBuffersAndViews(
+std::shared_ptr<SceneTargets> FrameResource::CreateSceneTargets(
     ID3D12Device* device,
     DescriptorHeapManager* descriptorHeapManager,
     UINT frameWidth,
     UINT frameHeight)
 {
+    auto targets = std::make_shared<SceneTargets>();
 
     // 1) Off-screen SceneColor 버퍼 생성 + RTV/SRV 뷰
     {
@@ -83,21 +91,21 @@ void FrameResource::InitializeFrameBuffersAndViews(
             &textureDesc,
             D3D12_RESOURCE_STATE_RENDER_TARGET,
             &clearValue,
-            IID_PPV_ARGS(&sceneColorBuffer)));
+            IID_PPV_ARGS(&targets->sceneColorBuffer)));
 
         // RTV 생성
-        sceneColorRtv = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+        targets->sceneColorRtv = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
         descriptorHeapManager->CreateRenderTargetView(
             device,
-            sceneColorBuffer.Get(),
-            sceneColorRtv.index);
+            targets->sceneColorBuffer.Get(),
+            targets->sceneColorRtv.index);
 
         // SRV 생성
-        sceneColorSrv = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        targets->sceneColorSrv = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
         device->CreateShaderResourceView(
-            sceneColorBuffer.Get(),
+            targets->sceneColorBuffer.Get(),
             nullptr,
-            sceneColorSrv.cpuHandle);
+            targets->sceneColorSrv.cpuHandle);
     }
 
     // 2) Depth-Stencil 버퍼 생성 + DSV 뷰
@@ -125,72 +133,79 @@ void FrameResource::InitializeFrameBuffersAndViews(
             &depthDesc,
             D3D12_RESOURCE_STATE_DEPTH_WRITE,
             &clearValue,
-            IID_PPV_ARGS(&depthStencilBuffer)));
+            IID_PPV_ARGS(&targets->depthStencilBuffer)));
 
-        depthStencilDsv = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
+        targets->depthStencilDsv = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
         descriptorHeapManager->CreateDepthStencilView(
             device,
-            depthStencilBuffer.Get(),
+            targets->depthStencilBuffer.Get(),
             nullptr,
-            depthStencilDsv.index);
+            targets->depthStencilDsv.index);
     }
 
-    // 3) ShadowMap 버퍼들 생성 + DSV/SRV 뷰
-    for (UINT i = 0; i < MaxShadowMaps; ++i)
-    {
-        D3D12_RESOURCE_DESC shadowDesc = {};
-        shadowDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
-        shadowDesc.Width = SHADOW_MAP_WIDTH;
-        shadowDesc.Height = SHADOW_MAP_HEIGHT;
-        shadowDesc.DepthOrArraySize = 1;
-        shadowDesc.MipLevels = 1;
-        shadowDesc.Format = DXGI_FORMAT_R24G8_TYPELESS;
-        shadowDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
-        shadowDesc.SampleDesc.Count = 1;
-
-        D3D12_CLEAR_VALUE clearValue = {};
-        clearValue.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
-        clearValue.DepthStencil.Depth = 1.0f;
-        clearValue.DepthStencil.Stencil = 0;
-
-        CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_DEFAULT);
-
-        // 깊이-스텐실 버퍼 생성
-        THROW_IF_FAILED(device->CreateCommittedResource(
-            &heapProperties,
-            D3D12_HEAP_FLAG_NONE,
-            &shadowDesc,
-            D3D12_RESOURCE_STATE_DEPTH_WRITE,
-            &clearValue,
-            IID_PPV_ARGS(&shadowMaps[i].depthBuffer)));
-
-        // DSV 뷰
-        shadowDsv[i] = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
-        D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
-        dsvDesc.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
-        dsvDesc.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D;
-        descriptorHeapManager->CreateDepthStencilView(
-            device,
-            shadowMaps[i].depthBuffer.Get(),
-            &dsvDesc,
-            shadowDsv[i].index);
-
-        // SRV 뷰
-        shadowSrv[i] = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-        srvDesc.Format = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MipLevels = 1;
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        device->CreateShaderResourceView(
-            shadowMaps[i].depthBuffer.Get(),
-            &srvDesc,
-            shadowSrv[i].cpuHandle);
-    }
+    return targets;
+}
 
-    // 4) per-object SRV/CBV/UAV 풀 초기화
-    // 미사용
-    objectSrvCbvUav.clear();
+std::shared_ptr<ShadowMap> FrameResource::CreateShadowAtlas(
+    ID3D12Device* device,
+    DescriptorHeapManager* descriptorHeapManager,
+    bool createSrv)
+{
+    auto atlas = std::make_shared<ShadowMap>();
+
+    D3D12_RESOURCE_DESC shadowDesc = {};
+    shadowDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    shadowDesc.Width = SHADOW_ATLAS_SIZE;
+    shadowDesc.Height = SHADOW_ATLAS_SIZE;
+    shadowDesc.DepthOrArraySize = 1;
+    shadowDesc.MipLevels = 1;
+    shadowDesc.Format = DXGI_FORMAT_R24G8_TYPELESS;
+    shadowDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+    shadowDesc.SampleDesc.Count = 1;
+
+    D3D12_CLEAR_VALUE clearValue = {};
+    clearValue.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+    clearValue.DepthStencil.Depth = 1.0f;
+    clearValue.DepthStencil.Stencil = 0;
+
+    CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_DEFAULT);
+
+    // 깊이-스텐실 버퍼 생성
+    THROW_IF_FAILED(device->CreateCommittedResource(
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &shadowDesc,
+        D3D12_RESOURCE_STATE_DEPTH_WRITE,
+        &clearValue,
+        IID_PPV_ARGS(&atlas->depthBuffer)));
+
+    // DSV 뷰
+    atlas->dsvHandle = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
+    D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+    dsvDesc.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+    dsvDesc.ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D;
+    descriptorHeapManager->CreateDepthStencilView(
+        device,
+        atlas->depthBuffer.Get(),
+        &dsvDesc,
+        atlas->dsvHandle.index);
+
+    // SRV 뷰 (t7). 깊이 타겟으로만 쓰면 생략
+    if (!createSrv)
+        return atlas;
+
+    atlas->srvHandle = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+    srvDesc.Format = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
+    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MipLevels = 1;
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    device->CreateShaderResourceView(
+        atlas->depthBuffer.Get(),
+        &srvDesc,
+        atlas->srvHandle.cpuHandle);
+
+    return atlas;
 }
 
 void FrameResource::InitializeCommandBundles(ID3D12Device* device, UINT numThreads)
@@ -18,6 +18,19 @@ using Microsoft::WRL::ComPtr;
 
 static constexpr UINT MaxShadowMaps = MAX_SHADOW_DSV_COUNT;
 
+// Off-screen 컬러 + 씬 깊이 타겟
+// GPU 만 쓰고 읽으며 한 direct queue 에서 프레임 순서대로 실행되므로 FrameResource 끼리 공유
+// (프레임 끝에서 항상 RENDER_TARGET / DEPTH_WRITE 상태로 돌려놓을 것)
+struct SceneTargets
+{
+    ComPtr<ID3D12Resource> sceneColorBuffer;
+    ComPtr<ID3D12Resource> depthStencilBuffer;
+
+    DescriptorHandle sceneColorRtv;    // Off-screen 컬러 RTV
+    DescriptorHandle sceneColorSrv;    // Off-screen 컬러 SRV
+    DescriptorHandle depthStencilDsv;  // Depth-Stencil DSV
+};
+
 class FrameResource
 {
 public:
@@ -25,8 +38,8 @@ public:
         ID3D12Device* device,
         DescriptorHeapManager* descriptorHeapManager,
         UINT objectCount,
-        UINT frameWidth,
-        UINT frameHeight,
+        std::shared_ptr<SceneTargets> sharedSceneTargets,
+        std::shared_ptr<ShadowMap> sharedShadowAtlas,
         UINT numThreads,
         bool enableMultiThreaded = false);
 
@@ -72,23 +85,23 @@ public:
     std::unique_ptr<UploadBuffer<CB_ToneMapping>>     cbToneMapping;    // 1
     std::unique_ptr<UploadBuffer<CB_ShadowMapViewProj>> cbShadowViewProj; // 1
 
+    // Bindless 머티리얼 테이블 (StructuredBuffer, root SRV 로 바인딩)
+    std::unique_ptr<UploadBuffer<MaterialGpuData>>    materialTable;    // MaterialTable::MaxMaterials
 
-    // 렌더 타겟 & 뷰 핸들
-    DescriptorHandle sceneColorRtv;    // Off-screen 컬러 RTV
-    DescriptorHandle sceneColorSrv;    // Off-screen 컬러 SRV
-    DescriptorHandle depthStencilDsv;  // Depth-Stencil DSV
+    // 클러스터드 라이팅 (StructuredBuffer, root SRV t8/t9)
+    std::unique_ptr<UploadBuffer<LightData>>          clusterLights;    // MAX_CLUSTERED_LIGHTS
+    std::unique_ptr<UploadBuffer<uint32_t>>           clusterData;      // CLUSTER_DATA_SIZE
 
-    // ShadowMap용 뷰 핸들
-    std::array<DescriptorHandle, MaxShadowMaps> shadowDsv;
-    std::array<DescriptorHandle, MaxShadowMaps> shadowSrv;
 
     // per-object SRV/CBV/UAV 풀 (동적 필요 시)
     std::vector<DescriptorHandle> objectSrvCbvUav;
 
-    // 실제 GPU 리소스
-    ComPtr<ID3D12Resource> sceneColorBuffer;
-    ComPtr<ID3D12Resource> depthStencilBuffer;
-    std::array<ShadowMap, MaxShadowMaps> shadowMaps;
+    // Off-screen 컬러 / 씬 깊이 (모든 FrameResource 공유)
+    std::shared_ptr<SceneTargets> sceneTargets;
+
+    // 모든 라이트 면이 타일로 들어가는 단일 섀도우 아틀라스 (DSV 1개 + SRV 1개)
+    // 한 direct queue 에서 순서대로 쓰고 읽으므로 FrameResource 끼리 공유 → 프레임을 넘어 타일 캐시 가능
+    std::shared_ptr<ShadowMap> shadowAtlas;
 
 
 public:
@@ -97,14 +110,20 @@ public:
         ID3D12Device* device,
         UINT objectCount);
 
-    // 프레임 단위 Off-screen/Depth/Shadow 리소스 + 뷰 생성
-    void InitializeFrameBuffersAndViews(
+    // Off-screen 컬러(R16G16B16A16) + Depth 버퍼와 RTV/SRV/DSV 생성
+    static std::shared_ptr<SceneTargets> CreateSceneTargets(
         ID3D12Device* device,
         DescriptorHeapManager* descriptorHeapManager,
         UINT frameWidth,
         UINT frameHeight);
 
 
+    // SHADOW_ATLAS_SIZE² 깊이 아틀라스 + DSV (+ t7 SRV)
+    static std::shared_ptr<ShadowMap> CreateShadowAtlas(
+        ID3D12Device* device,
+        DescriptorHeapManager* descriptorHeapManager,
+        bool createSrv = true);
+
     // 커맨드 할당자/리스트를 Reset
     void ResetCommandBundles();
     void CloseCommandLists();
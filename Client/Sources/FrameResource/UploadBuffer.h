@@ -64,8 +64,14 @@ public:
         std::memcpy(reinterpret_cast<BYTE*>(mappedData) + index * elementSize, &data, sizeof(T));
     }
 
+    // 연속 요소 일괄 복사 (StructuredBuffer 용, 상수 버퍼 정렬이 없을 때만)
+    void CopyRange(UINT firstIndex, const T* data, UINT elementCount) {
+        assert(!isConstantBuffer && firstIndex + elementCount <= count);
+        std::memcpy(reinterpret_cast<BYTE*>(mappedData) + firstIndex * elementSize, data, sizeof(T) * elementCount);
+    }
+
     // GPU 가상 주소
-    D3D12_GPU_VIRTUAL_ADDRESS GetGPUAddress(UINT index) const {
+    D3D12_GPU_VIRTUAL_ADDRESS GetGPUVirtualAddress(UINT index) const {
         assert(index < count);
         return resource->GetGPUVirtualAddress() + UINT64(index) * elementSize;
     }
@@ -173,6 +173,7 @@ bool Game::Initialize(HINSTANCE hInstance, int nCmdShow) {
     }
     boxObject->SetPosition(XMFLOAT3{ 0.0f, -2.0f, 0.0f });
     boxObject->SetScale(XMFLOAT3{ 1000.0f,  0.5f, 1000.0f });
+    boxObject->SetStaticShadowCaster(true);     // 바닥은 움직이지 않음 → 정적 섀도우 레이어
     renderer.AddGameObject(boxObject);
     
 
@@ -183,7 +184,7 @@ bool Game::Initialize(HINSTANCE hInstance, int nCmdShow) {
     flightMaterial->parameters.ambientOcclusion = 1.0f;
     flightMaterial->SetAllTextures(flightTextures);
 
-    auto flightObject = std::make_shared<Flight>(flight1Mesh, flightTextures);
+    auto flightObject = std::make_shared<Flight>(flight1Mesh.Get(), flightTextures);
     if (!flightObject->Initialize(&renderer))
         throw std::runtime_error("Failed to initialize Flight object");
 
@@ -252,49 +253,34 @@ bool Game::Initialize(HINSTANCE hInstance, int nCmdShow) {
 
 void Game::LoadModel()
 {
-    ModelLoader loader;
+    // 로더 스레드에서 임포트하고 업로드는 Renderer::Update 에서 처리 (실패는 AssetLoader 가 로그)
+    AssetLoader* assetLoader = renderer.GetAssetLoader();
 
-    
-    std::string flightPath = "Assets/spitfirev6/spitfirev6.obj";
-    flight1Mesh = loader.LoadMesh(&renderer, flightPath);
-    if (!flight1Mesh) {
-        MessageBox(hwnd, L"Failed to load flight mesh!", L"Error", MB_OK);
-    }
-
-    std::string bulletPath = "Assets/Bullet/bullet.obj";
-    bulletMesh = loader.LoadMesh(&renderer, bulletPath);
-    if (!bulletMesh) {
-        MessageBox(hwnd, L"Failed to load bullet mesh!", L"Error", MB_OK);
-    }
-    
+    flight1Mesh = assetLoader->LoadMeshAsync("Assets/spitfirev6/spitfirev6.obj");
+    bulletMesh = assetLoader->LoadMeshAsync("Assets/Bullet/bullet.obj");
 }
 
 void Game::LoadTexture()
 {
-    flightTextures.albedoTexture = renderer.GetTextureManager()->LoadTexture(
-        L"Assets/spitfirev6/spitfirev6_Textures/base_Base_Color_1002.png");
-    if (!flightTextures.albedoTexture) MessageBox(hwnd, L"Failed to load flight albedo texture!", L"Error", MB_OK);
-    
-    flightTextures.normalTexture = renderer.GetTextureManager()->LoadTexture(
-        L"Assets/spitfirev6/spitfirev6_Textures/base_Normal_DirectX_1002.png");
-    if (!flightTextures.normalTexture) MessageBox(hwnd, L"Failed to load flight normal texture!", L"Error", MB_OK);
+    // 준비될 때까지 자리표시자 SRV 가 바인딩됨 (bindless 머티리얼은 텍스쳐 없이 파라미터 값 사용)
+    AssetLoader* assetLoader = renderer.GetAssetLoader();
 
-    flightTextures.metallicTexture = renderer.GetTextureManager()->LoadTexture(
-        L"Assets/spitfirev6/spitfirev6_Textures/base_Metallic_1002.png");
-    if (!flightTextures.metallicTexture) MessageBox(hwnd, L"Failed to load flight metallic texture!", L"Error", MB_OK);
+    flightTextures.albedoTexture = assetLoader->LoadTextureAsync(
+        L"Assets/spitfirev6/spitfirev6_Textures/base_Base_Color_1002.png").Get();
 
-    flightTextures.roughnessTexture = renderer.GetTextureManager()->LoadTexture(
-        L"Assets/spitfirev6/spitfirev6_Textures/base_Roughness_1002.png");
-    if (!flightTextures.roughnessTexture) MessageBox(hwnd, L"Failed to load flight roughness texture!", L"Error", MB_OK);
+    flightTextures.normalTexture = assetLoader->LoadTextureAsync(
+        L"Assets/spitfirev6/spitfirev6_Textures/base_Normal_DirectX_1002.png").Get();
 
-    bulletTexture = renderer.GetTextureManager()->LoadTexture(
-        L"Assets/Bullet/Textures/bullet_DefaultMaterial_BaseColor.png");
-    if (!bulletTexture) MessageBox(hwnd, L"Failed to load bullet texture!", L"Error", MB_OK);
-    
+    flightTextures.metallicTexture = assetLoader->LoadTextureAsync(
+        L"Assets/spitfirev6/spitfirev6_Textures/base_Metallic_1002.png").Get();
+
+    flightTextures.roughnessTexture = assetLoader->LoadTextureAsync(
+        L"Assets/spitfirev6/spitfirev6_Textures/base_Roughness_1002.png").Get();
+
+    bulletTexture = assetLoader->LoadTextureAsync(
+        L"Assets/Bullet/Textures/bullet_DefaultMaterial_BaseColor.png").Get();
 
-    skyboxTexture = renderer.GetTextureManager()->LoadCubeMap(L"Assets/HDRI/SkyboxSpecularHDR.dds");
-    if (!skyboxTexture)
-        MessageBox(hwnd, L"Failed to load skybox texture", L"Error", MB_OK);
+    skyboxTexture = assetLoader->LoadCubeMapAsync(L"Assets/HDRI/SkyboxSpecularHDR.dds").Get();
 }
 
 bool Game::InitWindow(HINSTANCE hInstance, int nCmdShow) {
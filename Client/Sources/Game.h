@@ -37,8 +37,8 @@ private:
     Renderer renderer;
     ModelLoader modelLoader;
 
-    // Meshes
-    std::shared_ptr<Mesh> flight1Mesh;
+    // Meshes (비동기 로드, 준비되기 전까지 Get() 은 nullptr)
+    AssetHandle<Mesh> flight1Mesh;
     std::shared_ptr<Material> flightMaterial;
     MaterialPbrTextures flightTextures;
 
@@ -54,7 +54,7 @@ private:
     };
 
 
-    std::shared_ptr<Mesh> bulletMesh;
+    AssetHandle<Mesh> bulletMesh;
     std::shared_ptr<Texture> bulletTexture;
 
 
@@ -30,6 +30,8 @@ bool BoxObject::Initialize(Renderer* renderer)
     }
     SetMesh(cubeMesh);
 
+    renderer->GetMaterialTable()->Register(materialPBR);
+
     return true;
 }
 
@@ -68,6 +70,13 @@ void BoxObject::Update(float deltaTime, Renderer* renderer, UINT objectIndex)
 
 void BoxObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex)
 {
+    // Bindless: 패스에서 공통 상태를 이미 바인딩함
+    if (renderer->IsBindlessMaterialsEnabled())
+    {
+        RenderBindlessPbr(commandList, renderer, objectIndex, materialPBR->GetMaterialIndex(), materialPBR->GetFeatureFlags());
+        return;
+    }
+
     auto descriptorManager = renderer->GetDescriptorHeapManager();
     ID3D12DescriptorHeap* descriptorHeaps[] = {
         descriptorManager->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV),
@@ -77,10 +86,10 @@ void BoxObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* rendere
 
     // 루트 시그니처 및 파이프라인 상태 설정
     commandList->SetGraphicsRootSignature(
-        renderer->GetRootSignatureManager()->Get(L"PbrRS")
+        renderer->GetRootSignatureManager()->Get(RootSignatureId::PbrRS)
     );
     commandList->SetPipelineState(
-        renderer->GetPSOManager()->Get(L"PbrPSO")
+        renderer->GetPbrPipelineState(0, false)    // CB flags 를 쓰지 않으므로 텍스쳐 샘플링 없는 변형
     );
 
     FrameResource* frameResource = renderer->GetCurrentFrameResource();
@@ -110,13 +119,10 @@ void BoxObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* rendere
         4, frameResource->cbShadowViewProj->GetGPUVirtualAddress(0)
     );
 
-    // 텍스처 및 샘플러 테이블 바인딩
-    // 텍스쳐가 유효할시에만 바인딩
-    if (materialPBR->GetAlbedoTexture()) {
-        commandList->SetGraphicsRootDescriptorTable(
-            5, materialPBR->GetAlbedoTexture()->GetGpuHandle()
-        );
-    }
+    // 텍스처 및 샘플러 테이블 바인딩 (텍스쳐가 없으면 자리표시자로 채운 테이블)
+    commandList->SetGraphicsRootDescriptorTable(
+        5, GetMaterialTextureTable(renderer, *materialPBR)
+    );
 
 
     renderer->GetEnvironmentMaps().Bind(commandList, 6, 7, 8);
@@ -126,7 +132,15 @@ void BoxObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* rendere
 
     // 그림자맵 SRV 테이블 바인딩 (t7~t7+N-1)
     commandList->SetGraphicsRootDescriptorTable(
-        10, frameResource->shadowSrv[0].gpuHandle
+        10, frameResource->shadowAtlas->srvHandle.gpuHandle
+    );
+
+    // 클러스터드 라이팅 root SRV (t8: 라이트, t9: 클러스터 목록)
+    commandList->SetGraphicsRootShaderResourceView(
+        11, frameResource->clusterLights->GetGPUVirtualAddress(0)
+    );
+    commandList->SetGraphicsRootShaderResourceView(
+        12, frameResource->clusterData->GetGPUVirtualAddress(0)
     );
 
     // 입력 어셈블러 설정 및 드로우 호출
@@ -135,8 +149,6 @@ void BoxObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* rendere
         commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         commandList->IASetVertexBuffers(0, 1, &cubeMesh->GetVertexBufferView());
         commandList->IASetIndexBuffer(&cubeMesh->GetIndexBufferView());
-        commandList->DrawIndexedInstanced(
-            cubeMesh->GetIndexCount(), 1, 0, 0, 0
-        );
+        DrawMesh(commandList, renderer, *cubeMesh);
     }
 }
@@ -66,6 +66,8 @@ bool Flight::Initialize(Renderer* renderer)
     commandQueue->ExecuteCommandLists(_countof(lists), lists);
     renderer->WaitForDirectQueue();
 
+    renderer->GetMaterialTable()->Register(materialPBR);
+
     return true;
 }
 
@@ -148,12 +150,7 @@ void Flight::Update(float deltaTime, Renderer* renderer, UINT objectIndex)
     materialConstantData.emissiveColor = parameters.emissiveColor;
     materialConstantData.emissiveIntensity = parameters.emissiveIntensity;
 
-    uint32_t textureFlags = 0;
-    if (materialPBR->GetAlbedoTexture())    textureFlags |= USE_ALBEDO_MAP;
-    if (materialPBR->GetNormalTexture())    textureFlags |= USE_NORMAL_MAP;
-    if (materialPBR->GetMetallicTexture())  textureFlags |= USE_METALLIC_MAP;
-    if (materialPBR->GetRoughnessTexture()) textureFlags |= USE_ROUGHNESS_MAP;
-    materialConstantData.flags = textureFlags;
+    materialConstantData.flags = materialPBR->GetFeatureFlags();
 
 
     FrameResource* frameResource = renderer->GetCurrentFrameResource();
@@ -167,6 +164,13 @@ void Flight::Update(float deltaTime, Renderer* renderer, UINT objectIndex)
 
 void Flight::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex)
 {
+    // Bindless: 패스에서 공통 상태를 이미 바인딩함
+    if (renderer->IsBindlessMaterialsEnabled())
+    {
+        RenderBindlessPbr(commandList, renderer, objectIndex, materialPBR->GetMaterialIndex(), materialPBR->GetFeatureFlags());
+        return;
+    }
+
     // Descriptor Heaps 바인딩 (CBV_SRV_UAV + SAMPLER)
     ID3D12DescriptorHeap* descriptorHeaps[] = {
         renderer->GetDescriptorHeapManager()->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV),
@@ -175,8 +179,9 @@ void Flight::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer,
     commandList->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
 
     // PBR  RS & PSO 바인딩
-    ID3D12RootSignature* pbrRootSignature = renderer->GetRootSignatureManager()->Get(L"PbrRS");
-    ID3D12PipelineState* pbrPso = renderer->GetPSOManager()->Get(L"PbrPSO");
+    ID3D12RootSignature* pbrRootSignature = renderer->GetRootSignatureManager()->Get(RootSignatureId::PbrRS);
+    ID3D12PipelineState* pbrPso = renderer->GetPbrPipelineState(
+        materialPBR->GetFeatureFlags(), false, mesh && mesh->IsCompact());
     commandList->SetGraphicsRootSignature(pbrRootSignature);
     commandList->SetPipelineState(pbrPso);
 
@@ -197,7 +202,7 @@ void Flight::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer,
     {
         // material textures (t0~t3) → root 5
         commandList->SetGraphicsRootDescriptorTable(
-            5, materialPBR->GetAlbedoTexture()->GetGpuHandle());
+            5, GetMaterialTextureTable(renderer, *materialPBR));
 
         // IBL 환경맵 바인딩 (t4~t6)
         renderer->GetEnvironmentMaps().Bind(
@@ -209,7 +214,13 @@ void Flight::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer,
 
         // shadow map SRV 테이블 바인딩 (t7~t7+N-1) → root 10
         commandList->SetGraphicsRootDescriptorTable(
-            10, frameResource->shadowSrv[0].gpuHandle);
+            10, frameResource->shadowAtlas->srvHandle.gpuHandle);
+
+        // 클러스터 라이트 (t8), 클러스터 목록 (t9) → root 11, 12
+        commandList->SetGraphicsRootShaderResourceView(
+            11, frameResource->clusterLights->GetGPUVirtualAddress(0));
+        commandList->SetGraphicsRootShaderResourceView(
+            12, frameResource->clusterData->GetGPUVirtualAddress(0));
     }
 
     // IA 설정 및 Draw Call
@@ -218,7 +229,6 @@ void Flight::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer,
         commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         commandList->IASetVertexBuffers(0, 1, &meshInstance->GetVertexBufferView());
         commandList->IASetIndexBuffer(&meshInstance->GetIndexBufferView());
-        commandList->DrawIndexedInstanced(
-            meshInstance->GetIndexCount(), 1, 0, 0, 0);
+        DrawMesh(commandList, renderer, *meshInstance);
     }
 }
\ No newline at end of file
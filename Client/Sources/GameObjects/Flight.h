@@ -16,6 +16,8 @@ public:
     bool Initialize(Renderer* renderer) override;
     void Update(float deltaTime, Renderer* renderer, UINT objectIndex) override;
     void Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex) override;
+    bool UsesBindlessPbr() const override { return true; }
+    std::shared_ptr<Material> GetMaterial() const override { return materialPBR; }
 
 private:
     std::weak_ptr<Mesh> flightMesh;
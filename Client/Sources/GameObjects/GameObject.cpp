@@ -1,6 +1,28 @@
 #include "GameObject.h"
 #include "Renderer.h"
 #include "FrameResource/FrameResource.h"
+#include "TextureManager.h"
+#include "Material.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+// 더 거친 LOD 로는 오차가 임계값의 이 비율 아래일 때만 전환 (경계 거리에서 LOD 가 깜빡이지 않도록)
+static constexpr float LodHysteresis = 0.8f;
+
+// 한 드로우에서 컬링할 수 있는 최대 뷰 수 (면 인스턴싱 그룹의 viewport 수 상한)
+static constexpr UINT MaxClusterCullViews = D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
+
+// Compact 정점 위치 디코드 상수 (Full 메시는 scale 1 / bias 0)
+static void StorePositionDecode(const Mesh* mesh, XMFLOAT4& outScale, XMFLOAT4& outBias)
+{
+    VertexCompression::PositionQuantization quantization;
+    if (mesh)
+        quantization = mesh->GetPositionQuantization();
+
+    outScale = { quantization.scale.x, quantization.scale.y, quantization.scale.z, 0.0f };
+    outBias = { quantization.bias.x, quantization.bias.y, quantization.bias.z, 0.0f };
+}
 
 GameObject::GameObject() {
 }
@@ -16,12 +38,14 @@ bool GameObject::Initialize(Renderer* renderer) {
 void GameObject::Update(float deltaTime, Renderer* renderer, UINT objectIndex) {
 
     UpdateWorldMatrix();
+    SelectLod(renderer);
 
     CB_MVP constantBufferData{};
     XMStoreFloat4x4(&constantBufferData.model, XMMatrixTranspose(worldMatrix));
     XMStoreFloat4x4(&constantBufferData.view, XMMatrixTranspose(renderer->GetCamera()->GetViewMatrix()));
     XMStoreFloat4x4(&constantBufferData.projection, XMMatrixTranspose(renderer->GetCamera()->GetProjectionMatrix()));
     XMStoreFloat4x4(&constantBufferData.modelInvTranspose, XMMatrixTranspose(XMMatrixInverse(nullptr, worldMatrix)));
+    StorePositionDecode(mesh.get(), constantBufferData.positionScale, constantBufferData.positionBias);
 
     FrameResource* frameResource = renderer->GetCurrentFrameResource();
     assert(frameResource != nullptr && frameResource->cbMVP && "FrameResource or cbMVP is null");
@@ -35,6 +59,7 @@ void GameObject::UpdateShadowMap(Renderer* renderer, UINT objectIndex, UINT shad
     CB_ShadowMapPass data{};
     XMStoreFloat4x4(&data.modelWorld, XMMatrixTranspose(worldMatrix));
     XMStoreFloat4x4(&data.lightViewProj, XMMatrixTranspose(lightViewProj));
+    StorePositionDecode(mesh.get(), data.positionScale, data.positionBias);
 
     FrameResource* frameResource = renderer->GetCurrentFrameResource();
     assert(frameResource && frameResource->cbShadowPass && "FrameResource or cbShadowPass is null");
@@ -44,7 +69,7 @@ void GameObject::UpdateShadowMap(Renderer* renderer, UINT objectIndex, UINT shad
     frameResource->cbShadowPass->CopyData(slot, data);
 }
 
-void GameObject::RenderShadowMap(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT shadowMapIndex) 
+void GameObject::RenderShadowMap(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT shadowMapIndex, const XMMATRIX& lightViewProj)
 {
     auto& frameResource = *renderer->GetCurrentFrameResource();
     assert(frameResource.cbShadowPass && "cbShadowPass is null");
@@ -54,16 +79,166 @@ void GameObject::RenderShadowMap(ID3D12GraphicsCommandList* commandList, Rendere
 
     D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = frameResource.cbShadowPass->GetGPUVirtualAddress(slot);
 
-    commandList->SetGraphicsRootSignature(renderer->GetRootSignatureManager()->Get(L"ShadowMapPassRS"));
-    commandList->SetPipelineState(renderer->GetPSOManager()->Get(L"ShadowMapPassPSO"));
+    const bool compact = mesh && mesh->IsCompact();
+
+    commandList->SetGraphicsRootSignature(renderer->GetRootSignatureManager()->Get(RootSignatureId::ShadowMapPassRS));
+    commandList->SetPipelineState(renderer->GetPSOManager()->Get(
+        compact ? PipelineStateId::ShadowMapPassCompactPSO : PipelineStateId::ShadowMapPassPSO));
     commandList->SetGraphicsRootConstantBufferView(0, gpuAddress);
 
     if (auto mesh = GetMesh()) {
         commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
         commandList->IASetVertexBuffers(0, 1, &mesh->GetVertexBufferView());
         commandList->IASetIndexBuffer(&mesh->GetIndexBufferView());
-        commandList->DrawIndexedInstanced(mesh->GetIndexCount(), 1, 0, 0, 0);
+        DrawMesh(commandList, renderer, *mesh, 1, &lightViewProj, 1);
+    }
+}
+
+void GameObject::RenderShadowMapInstanced(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT faceCount, const XMMATRIX* faceViewProjs)
+{
+    FrameResource* frameResource = renderer->GetCurrentFrameResource();
+
+    // Compact 메시만 PSO 교체 후 원래대로 (RS / 루트 인자는 공통)
+    const bool compact = mesh && mesh->IsCompact();
+    if (compact)
+        commandList->SetPipelineState(renderer->GetPSOManager()->Get(PipelineStateId::ShadowMapInstancedCompactPSO));
+
+    // b0: model 행렬 + 위치 디코드만 사용
+    commandList->SetGraphicsRootConstantBufferView(0, frameResource->cbMVP->GetGPUVirtualAddress(objectIndex));
+
+    if (auto mesh = GetMesh()) {
+        commandList->IASetVertexBuffers(0, 1, &mesh->GetVertexBufferView());
+        commandList->IASetIndexBuffer(&mesh->GetIndexBufferView());
+        DrawMesh(commandList, renderer, *mesh, faceCount, faceViewProjs, faceCount);
     }
+
+    if (compact)
+        commandList->SetPipelineState(renderer->GetPSOManager()->Get(PipelineStateId::ShadowMapInstancedPSO));
+}
+
+void GameObject::RenderBindlessPbr(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT materialIndex, uint32_t featureFlags)
+{
+    FrameResource* frameResource = renderer->GetCurrentFrameResource();
+    assert(materialIndex != UINT(-1) && "Material is not registered to MaterialTable");
+
+    // Compact 메시는 퍼뮤테이션이 꺼져 있어도 PSO 교체 필요 (다음 오브젝트를 위해 원래대로 복구)
+    const bool compact = mesh && mesh->IsCompact();
+    if (renderer->IsShaderPermutationsEnabled() || compact)
+        commandList->SetPipelineState(renderer->GetPbrPipelineState(featureFlags, true, compact));
+
+    commandList->SetGraphicsRootConstantBufferView(0, frameResource->cbMVP->GetGPUVirtualAddress(objectIndex));
+    commandList->SetGraphicsRoot32BitConstant(2, materialIndex, 0);
+
+    if (auto mesh = GetMesh()) {
+        commandList->IASetVertexBuffers(0, 1, &mesh->GetVertexBufferView());
+        commandList->IASetIndexBuffer(&mesh->GetIndexBufferView());
+        DrawMesh(commandList, renderer, *mesh);
+    }
+
+    if (compact && !renderer->IsShaderPermutationsEnabled())
+        commandList->SetPipelineState(renderer->GetPSOManager()->Get(PipelineStateId::PbrBindlessPSO));
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE GameObject::GetMaterialTextureTable(Renderer* renderer, const Material& material)
+{
+    // 1) MaterialTable::UpdateTextureTables 가 만든 머티리얼 테이블
+    if (material.GetTextureTable().ptr != 0)
+        return material.GetTextureTable();
+
+    // 2) 이번 프레임 갱신 뒤에 등록된 머티리얼은 transient ring 에 임시 테이블
+    //    (텍스쳐마다 SRV 슬롯이 따로 있으므로 albedo 핸들을 테이블 시작으로 쓰면 t1~t3 가 엉뚱한 슬롯을 읽음)
+    const std::shared_ptr<Texture> textures[] = {
+        material.GetAlbedoTexture(),
+        material.GetNormalTexture(),
+        material.GetMetallicTexture(),
+        material.GetRoughnessTexture(),
+    };
+    return renderer->GetTextureManager()->CreateTransientTable(textures, _countof(textures));
+}
+
+void GameObject::SelectLod(Renderer* renderer)
+{
+    if (!mesh || mesh->GetLodCount() <= 1 || !renderer->IsMeshLodEnabled()) {
+        currentLod = 0;
+        return;
+    }
+
+    BoundingSphere worldBounds;
+    GetWorldBoundingSphere(worldBounds);
+
+    // 1) 바운딩 구에서 카메라까지 가장 가까운 거리 (안에 있으면 LOD0)
+    const Camera* camera = renderer->GetCamera();
+    const XMFLOAT3 cameraPosition = camera->GetPosition();
+    const float distance = XMVectorGetX(XMVector3Length(XMLoadFloat3(&worldBounds.Center) - XMLoadFloat3(&cameraPosition))) - worldBounds.Radius;
+    if (distance <= camera->GetNearZ()) {
+        currentLod = 0;
+        return;
+    }
+
+    // 2) LOD 오차(로컬 공간 거리) → 화면 픽셀
+    const float localRadius = mesh->GetBounds().Radius;
+    const float worldScale = localRadius > 0.0f ? worldBounds.Radius / localRadius : 1.0f;
+    const float pixelsPerUnit = float(renderer->GetViewportHeight()) / (2.0f * distance * std::tan(camera->GetFovY() * 0.5f));
+    auto errorInPixels = [&](uint32_t lod) { return mesh->GetLod(lod).error * worldScale * pixelsPerUnit; };
+
+    // 3) 히스테리시스: 거친 쪽은 여유 있게, 세밀한 쪽은 임계값을 넘는 즉시
+    const float threshold = renderer->GetLodErrorThreshold();
+    uint32_t lod = std::min(currentLod, mesh->GetLodCount() - 1);
+    while (lod + 1 < mesh->GetLodCount() && errorInPixels(lod + 1) <= threshold * LodHysteresis)
+        ++lod;
+    while (lod > 0 && errorInPixels(lod) > threshold)
+        --lod;
+
+    currentLod = lod;
+}
+
+void GameObject::DrawMesh(ID3D12GraphicsCommandList* commandList, Renderer* renderer, const Mesh& drawMesh, UINT instanceCount,
+    const XMMATRIX* cullViewProjs, UINT cullViewCount)
+{
+    const MeshLod& lod = drawMesh.GetLod(currentLod);
+
+    // 메시릿은 LOD0 에만 있음. 거친 LOD 는 이미 삼각형이 적으므로 통째로 드로우
+    if (currentLod != 0 || !drawMesh.HasMeshlets() || !renderer->IsClusterCullingEnabled() || cullViewCount > MaxClusterCullViews) {
+        commandList->DrawIndexedInstanced(lod.indexCount, instanceCount, lod.indexStart, 0, 0);
+        renderer->AddSubmittedTriangles(uint64_t(lod.indexCount / 3) * instanceCount);
+        return;
+    }
+
+    // 컬링 CPU 시간은 통계 창이 펼쳐져 있을 때만 잰다 (now() 두 번도 드로우마다면 비용)
+    const bool measureTime = renderer->IsStatsWindowVisible();
+    const auto startTime = measureTime ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    // 1) 뷰마다 오브젝트 로컬 공간의 절두체 평면 + 시점 (기본은 카메라)
+    XMMATRIX cameraViewProj;
+    if (cullViewCount == 0) {
+        cameraViewProj = renderer->GetCamera()->GetViewMatrix() * renderer->GetCamera()->GetProjectionMatrix();
+        cullViewProjs = &cameraViewProj;
+        cullViewCount = 1;
+    }
+
+    Meshlets::CullView views[MaxClusterCullViews];
+    for (UINT i = 0; i < cullViewCount; ++i)
+        views[i] = Meshlets::MakeCullView(worldMatrix, cullViewProjs[i]);
+
+    // 2) 보이는 메시릿의 연속 구간만 드로우 (LOD0 인덱스가 메시릿 순서로 정렬되어 있음)
+    //    구간 버퍼는 드로우마다 할당하지 않도록 쓰레드별로 재사용 (멀티쓰레드 렌더링에서도 안전)
+    thread_local std::vector<Meshlets::DrawRange> ranges;
+    ranges.clear();
+    Meshlets::CullStats stats;
+    Meshlets::Cull(drawMesh.GetMeshlets(), views, cullViewCount, ranges, stats);
+
+    const uint64_t cullNanoseconds = measureTime
+        ? std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count()
+        : 0;
+
+    uint64_t triangles = 0;
+    for (const Meshlets::DrawRange& range : ranges) {
+        commandList->DrawIndexedInstanced(range.indexCount, instanceCount, range.indexStart, 0, 0);
+        triangles += range.indexCount / 3;
+    }
+
+    renderer->AddSubmittedTriangles(triangles * instanceCount);
+    renderer->AddClusterCullStats(stats, cullNanoseconds);
 }
 
 void GameObject::SetPosition(const XMFLOAT3& pos) {
@@ -94,6 +269,15 @@ float GameObject::DistanceToCamera(const XMVECTOR& cameraPos) const
     return XMVectorGetX(XMVector3Length(worldPos - cameraPos));
 }
 
+bool GameObject::GetWorldBoundingSphere(BoundingSphere& outSphere) const
+{
+    if (!mesh)
+        return false;
+
+    mesh->GetBounds().Transform(outSphere, worldMatrix);
+    return true;
+}
+
 void GameObject::SetMesh(std::shared_ptr<Mesh> mesh_)
 {
     mesh = mesh_;
@@ -108,5 +292,16 @@ void GameObject::UpdateWorldMatrix() {
     XMMATRIX S = XMMatrixScaling(scale.x, scale.y, scale.z);
     XMMATRIX R = XMMatrixRotationQuaternion(rotation);
     XMMATRIX T = XMMatrixTranslation(position.x, position.y, position.z);
-    worldMatrix = S * R * T;
+    XMMATRIX newWorldMatrix = S * R * T;
+
+    for (int row = 0; row < 4; ++row)
+    {
+        if (!XMVector4Equal(newWorldMatrix.r[row], worldMatrix.r[row]))
+        {
+            ++transformVersion;
+            break;
+        }
+    }
+
+    worldMatrix = newWorldMatrix;
 }
@@ -14,6 +14,7 @@ using Microsoft::WRL::ComPtr;
 using namespace DirectX;
 
 class Renderer;
+class Material;
 
 class GameObject {
 public:
@@ -25,7 +26,20 @@ public:
     virtual void Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex) = 0;
 
     void UpdateShadowMap(Renderer* renderer, UINT objectIndex, UINT shadowMapIndex, const XMMATRIX& lightViewProj);
-    void RenderShadowMap(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT shadowMapIndex);
+
+    // lightViewProj: 메시릿 컬링용 면 행렬 (UpdateShadowMap 에 넘긴 것과 같은 값)
+    void RenderShadowMap(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT shadowMapIndex, const XMMATRIX& lightViewProj);
+
+    // 면 인스턴싱: RS/PSO, b1(면 행렬), b2(faceMask) 는 패스가 설정. 면 수만큼 인스턴스로 그림
+    // faceViewProjs: 그리는 면들의 행렬 faceCount 개 (메시릿은 어느 한 면에라도 보이면 그림)
+    void RenderShadowMapInstanced(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT faceCount, const XMMATRIX* faceViewProjs);
+
+    // true 면 Renderer::BindBindlessPbrState() 로 묶인 상태를 그대로 쓴다
+    // (패스가 오브젝트마다 RS/PSO/테이블을 다시 바인딩하지 않아도 됨)
+    virtual bool UsesBindlessPbr() const { return false; }
+
+    // 텍스쳐 스트리밍이 화면 텍셀 밀도를 계산할 머티리얼 (없으면 nullptr)
+    virtual std::shared_ptr<Material> GetMaterial() const { return nullptr; }
 
     void SetPosition(const XMFLOAT3& pos);
     void SetScale(const XMFLOAT3& scale);
@@ -36,12 +50,41 @@ public:
 
     float DistanceToCamera(const XMVECTOR& cameraPos) const;
 
+    // 메쉬 바운딩 구를 월드로 변환 (메쉬가 없으면 false)
+    bool GetWorldBoundingSphere(BoundingSphere& outSphere) const;
+
+    // 섀도우 캐시용: 정적 캐스터는 정적 레이어에 한 번만 그려 재사용
+    void SetStaticShadowCaster(bool isStatic) { staticShadowCaster = isStatic; }
+    bool IsStaticShadowCaster() const { return staticShadowCaster; }
+
+    // 월드 행렬이 바뀔 때마다 증가 (섀도우 면 dirty 판정)
+    uint32_t GetTransformVersion() const { return transformVersion; }
+
     void SetMesh(std::shared_ptr<Mesh> mesh);
     std::shared_ptr<Mesh> GetMesh() const;
 
+    // 이번 프레임에 그릴 LOD (Update 에서 선택, 섀도우 패스도 같은 LOD 사용)
+    uint32_t GetCurrentLod() const { return currentLod; }
+
 protected:
     void UpdateWorldMatrix();
 
+    // 화면상 오차(픽셀)가 임계값 이하인 가장 거친 LOD 선택 (컬링과 같은 월드 바운딩 구 기준)
+    void SelectLod(Renderer* renderer);
+
+    // 현재 LOD 구간으로 드로우 + 제출 삼각형 수 집계 (IA 설정은 호출 측)
+    // LOD0 + 메시릿이 있으면 cullViewProjs (없으면 카메라) 로 메시릿을 컬링하고 보이는 구간만 드로우
+    void DrawMesh(ID3D12GraphicsCommandList* commandList, Renderer* renderer, const Mesh& drawMesh, UINT instanceCount = 1,
+        const XMMATRIX* cullViewProjs = nullptr, UINT cullViewCount = 0);
+
+    // Bindless PBR 드로우: b0(MVP) + materialIndex root constant 만 설정
+    // 퍼뮤테이션이 켜져 있으면 featureFlags 에 맞는 PSO 로 교체 (RS 는 공통)
+    void RenderBindlessPbr(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex, UINT materialIndex, uint32_t featureFlags);
+
+    // 비 bindless PBR 드로우의 t0~t3 (알베도 / 노멀 / 메탈릭 / 러프니스) 연속 테이블 (root 5 에 바인딩)
+    // 머티리얼마다 만들어 둔 테이블을 조회만 하므로 렌더 워커에서 호출 가능
+    static D3D12_GPU_DESCRIPTOR_HANDLE GetMaterialTextureTable(Renderer* renderer, const Material& material);
+
     // 변환 정보
     XMFLOAT3 position    = {0,0,0};
     XMFLOAT3 scale       = {1,1,1};
@@ -50,5 +93,10 @@ protected:
 
     bool transparent = false;
 
+    bool     staticShadowCaster = false;
+    uint32_t transformVersion = 0;
+
+    uint32_t currentLod = 0;
+
     std::shared_ptr<Mesh> mesh;     // 모든 GameObject는 1개의 메쉬를 갖는다고 가정
 };
@@ -23,8 +23,8 @@ bool Skybox::Initialize(Renderer* renderer)
     if (!cubeMesh)
         return false;
 
-    rootSignature = renderer->GetRootSignatureManager()->Get(L"SkyboxRS");
-    pipelineState = renderer->GetPSOManager()->Get(L"SkyboxPSO");
+    rootSignature = renderer->GetRootSignatureManager()->Get(RootSignatureId::SkyboxRS);
+    pipelineState = renderer->GetPSOManager()->Get(PipelineStateId::SkyboxPSO);
     return (rootSignature.Get() && pipelineState.Get());
 }
 
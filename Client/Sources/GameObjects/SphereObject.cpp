@@ -36,6 +36,8 @@ bool SphereObject::Initialize(Renderer* renderer)
         return false;
     SetMesh(sphereMesh);
 
+    renderer->GetMaterialTable()->Register(materialPBR);
+
     return true;
 }
 
@@ -121,6 +123,13 @@ void SphereObject::Update(
 
 void SphereObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex)
 {
+    // Bindless: 패스에서 공통 상태를 이미 바인딩함
+    if (renderer->IsBindlessMaterialsEnabled() && UsesBindlessPbr())
+    {
+        RenderBindlessPbr(commandList, renderer, objectIndex, materialPBR->GetMaterialIndex(), materialPBR->GetFeatureFlags());
+        return;
+    }
+
     // Descriptor Heaps 바인딩
     ID3D12DescriptorHeap* heaps[] = {
         renderer->GetDescriptorHeapManager()->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV),
@@ -135,10 +144,10 @@ void SphereObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* rend
     {
 
         commandList->SetGraphicsRootSignature(
-            renderer->GetRootSignatureManager()->Get(L"DebugNormalRS")
+            renderer->GetRootSignatureManager()->Get(RootSignatureId::DebugNormalRS)
         );
         commandList->SetPipelineState(
-            renderer->GetPSOManager()->Get(L"DebugNormalPSO")
+            renderer->GetPSOManager()->Get(PipelineStateId::DebugNormalPSO)
         );
 
         commandList->SetGraphicsRootConstantBufferView(0, frameResource->cbMVP->GetGPUVirtualAddress(objectIndex));
@@ -149,24 +158,22 @@ void SphereObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* rend
     else
     {
         commandList->SetGraphicsRootSignature(
-            renderer->GetRootSignatureManager()->Get(L"PbrRS")
+            renderer->GetRootSignatureManager()->Get(RootSignatureId::PbrRS)
         );
         commandList->SetPipelineState(
-            renderer->GetPSOManager()->Get(L"PbrPSO")
+            renderer->GetPbrPipelineState(0, false)    // CB flags 를 쓰지 않으므로 텍스쳐 샘플링 없는 변형
         );
 
         
         commandList->SetGraphicsRootConstantBufferView(0, frameResource->cbMVP->GetGPUVirtualAddress(objectIndex)); commandList->SetGraphicsRootConstantBufferView(1, frameResource->cbLighting->GetGPUVirtualAddress(0)); commandList->SetGraphicsRootConstantBufferView(3, frameResource->cbGlobal->GetGPUVirtualAddress(0)); commandList->SetGraphicsRootConstantBufferView(4, frameResource->cbShadowViewProj->GetGPUVirtualAddress(0));
 
-        if (materialPBR->GetAlbedoTexture()) {
-            commandList->SetGraphicsRootDescriptorTable(
-                5, materialPBR->GetAlbedoTexture()->GetGpuHandle()
-            );
-        }
+        commandList->SetGraphicsRootDescriptorTable(5, GetMaterialTextureTable(renderer, *materialPBR));
 
         renderer->GetEnvironmentMaps().Bind(commandList, 6, 7, 8);
         commandList->SetGraphicsRootDescriptorTable(9, renderer->GetDescriptorHeapManager()->GetLinearWrapSamplerGpuHandle());
-        commandList->SetGraphicsRootDescriptorTable(10, frameResource->shadowSrv[0].gpuHandle);
+        commandList->SetGraphicsRootDescriptorTable(10, frameResource->shadowAtlas->srvHandle.gpuHandle);
+        commandList->SetGraphicsRootShaderResourceView(11, frameResource->clusterLights->GetGPUVirtualAddress(0));
+        commandList->SetGraphicsRootShaderResourceView(12, frameResource->clusterData->GetGPUVirtualAddress(0));
 
         commandList->SetGraphicsRootConstantBufferView(2, frameResource->cbMaterialPbr->GetGPUVirtualAddress(objectIndex));
         commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -175,5 +182,5 @@ void SphereObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* rend
     // IA 설정 및 드로우
     commandList->IASetVertexBuffers(0, 1, &sphereMesh->GetVertexBufferView());
     commandList->IASetIndexBuffer(&sphereMesh->GetIndexBufferView());
-    commandList->DrawIndexedInstanced(sphereMesh->GetIndexCount(), 1, 0, 0, 0);
+    DrawMesh(commandList, renderer, *sphereMesh);
 }
\ No newline at end of file
@@ -115,8 +115,8 @@ void TriangleObject::Update(float deltaTime, Renderer* renderer, UINT objectInde
 void TriangleObject::Render(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT objectIndex)
 {
     // PSO & RootSignature
-    commandList->SetPipelineState(renderer->GetPSOManager()->Get(L"TrianglePSO"));
-    commandList->SetGraphicsRootSignature(renderer->GetRootSignatureManager()->Get(L"TriangleRS"));
+    commandList->SetPipelineState(renderer->GetPSOManager()->Get(PipelineStateId::TrianglePSO));
+    commandList->SetGraphicsRootSignature(renderer->GetRootSignatureManager()->Get(RootSignatureId::TriangleRS));
 
     // b0: MVP
     FrameResource* frameResource = renderer->GetCurrentFrameResource();
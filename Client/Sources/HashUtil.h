@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// FNV-1a 64bit 해시 (캐시 키 생성용, 암호학적 용도 아님)
+class Hasher
+{
+public:
+    static constexpr uint64_t OffsetBasis = 14695981039346656037ull;
+    static constexpr uint64_t Prime = 1099511628211ull;
+
+    void Add(const void* data, size_t size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            value ^= bytes[i];
+            value *= Prime;
+        }
+    }
+
+    template<typename T>
+    void AddValue(const T& v) { Add(&v, sizeof(T)); }
+
+    void AddString(std::string_view s)
+    {
+        Add(s.data(), s.size());
+        AddValue(static_cast<uint64_t>(s.size()));
+    }
+
+    // wchar_t 크기가 플랫폼마다 달라(Windows 2, Linux 4) UTF-16 코드 유닛 단위로 해시
+    void AddString(std::wstring_view s)
+    {
+        for (wchar_t c : s)
+            AddValue(static_cast<uint16_t>(c));
+        AddValue(static_cast<uint64_t>(s.size()));
+    }
+
+    uint64_t Value() const { return value; }
+
+private:
+    uint64_t value = OffsetBasis;
+};
+
+// 오프라인 툴(Linux)에서도 쓰므로 <format> 없이 구현
+inline std::wstring HashToHex(uint64_t hash)
+{
+    static constexpr wchar_t digits[] = L"0123456789abcdef";
+    std::wstring hex(16, L'0');
+    for (int i = 15; i >= 0; --i, hash >>= 4)
+        hex[i] = digits[hash & 0xF];
+    return hex;
+}
@@ -0,0 +1,282 @@
+#include "LightClusterGrid.h"
+#include "Camera.h"
+#include "Lights/LightType.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+    // 구 vs AABB: 가장 가까운 점까지 거리² <= r²
+    bool SphereIntersectsAabb(FXMVECTOR center, float radius, FXMVECTOR aabbMin, GXMVECTOR aabbMax)
+    {
+        const XMVECTOR zero = XMVectorZero();
+        const XMVECTOR outside = XMVectorAdd(
+            XMVectorMax(XMVectorSubtract(aabbMin, center), zero),
+            XMVectorMax(XMVectorSubtract(center, aabbMax), zero));
+        return XMVectorGetX(XMVector3LengthSq(outside)) <= radius * radius;
+    }
+
+    // 콘 vs 구 (콘 축 방향 거리 + 측면 거리)
+    bool ConeIntersectsSphere(FXMVECTOR apex, FXMVECTOR direction, float range, float cosAngle, float sinAngle,
+        FXMVECTOR sphereCenter, float sphereRadius)
+    {
+        const XMVECTOR v = XMVectorSubtract(sphereCenter, apex);
+        const float lengthSq = XMVectorGetX(XMVector3LengthSq(v));
+        const float axial = XMVectorGetX(XMVector3Dot(v, direction));
+        const float lateral = std::sqrt(std::max(lengthSq - axial * axial, 0.0f));
+
+        const float closest = cosAngle * lateral - axial * sinAngle;
+        if (closest > sphereRadius)          return false;  // 콘 측면 밖
+        if (axial > sphereRadius + range)    return false;  // 사거리 밖
+        if (axial < -sphereRadius)           return false;  // apex 뒤
+        return true;
+    }
+}
+
+void LightClusterGrid::Build(const Camera& camera, uint32_t viewportWidth, uint32_t viewportHeight,
+    const std::vector<LightData>& lights, uint32_t directionalCount)
+{
+    clusterLights.resize(CLUSTER_COUNT);
+    for (auto& list : clusterLights)
+        list.clear();
+
+    clusterData.resize(CLUSTER_DATA_SIZE);
+    indexCount = 0;
+    maxLightsPerCluster = 0;
+    overflowed = false;
+
+    tileSize = XMFLOAT2(
+        static_cast<float>(viewportWidth) / CLUSTER_GRID_X,
+        static_cast<float>(viewportHeight) / CLUSTER_GRID_Y);
+
+    const uint32_t lightCount = static_cast<uint32_t>(std::min<size_t>(lights.size(), MAX_CLUSTERED_LIGHTS));
+
+    // 1) 직교 카메라: 슬라이스 분할이 의미 없으므로 모든 클러스터가 한 목록을 공유
+    if (!camera.IsPerspective())
+    {
+        depthScale = 0.0f;
+        depthBias = 0.0f;
+
+        const uint32_t localCount = std::min(lightCount - std::min(directionalCount, lightCount), MAX_CLUSTER_LIGHT_INDICES);
+        for (uint32_t i = 0; i < localCount; ++i)
+            clusterData[CLUSTER_COUNT * 2 + i] = directionalCount + i;
+
+        for (uint32_t cluster = 0; cluster < CLUSTER_COUNT; ++cluster)
+        {
+            clusterData[cluster * 2 + 0] = CLUSTER_COUNT * 2;
+            clusterData[cluster * 2 + 1] = localCount;
+        }
+        indexCount = localCount;
+        maxLightsPerCluster = localCount;
+        return;
+    }
+
+    RebuildClusterBounds(camera);
+
+    // 2) 로컬 라이트를 뷰 공간으로 옮겨 클러스터에 배정
+    const XMMATRIX view = camera.GetViewMatrix();
+    for (uint32_t i = directionalCount; i < lightCount; ++i)
+    {
+        const LightData& light = lights[i];
+        if (light.range <= 0.0f)
+            continue;
+
+        const XMVECTOR center = XMVector3TransformCoord(XMLoadFloat3(&light.position), view);
+        if (light.type == static_cast<int>(LightType::Spot))
+        {
+            const XMVECTOR direction = XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(&light.direction), view));
+            AssignSpot(i, center, direction, light.range, light.outerCutoffAngle);
+        }
+        else
+        {
+            AssignSphere(i, center, light.range);
+        }
+    }
+
+    // 3) 평탄화: (offset, count) 헤더 + 인덱스 목록
+    uint32_t offset = CLUSTER_COUNT * 2;
+    for (uint32_t cluster = 0; cluster < CLUSTER_COUNT; ++cluster)
+    {
+        const auto& list = clusterLights[cluster];
+        uint32_t count = static_cast<uint32_t>(list.size());
+        if (indexCount + count > MAX_CLUSTER_LIGHT_INDICES)
+        {
+            count = MAX_CLUSTER_LIGHT_INDICES - indexCount;
+            overflowed = true;
+        }
+
+        clusterData[cluster * 2 + 0] = offset;
+        clusterData[cluster * 2 + 1] = count;
+        std::copy_n(list.begin(), count, clusterData.begin() + offset);
+
+        offset += count;
+        indexCount += count;
+        maxLightsPerCluster = std::max(maxLightsPerCluster, static_cast<uint32_t>(list.size()));
+    }
+}
+
+void LightClusterGrid::RebuildClusterBounds(const Camera& camera)
+{
+    const float fovY = camera.GetFovY();
+    const float aspect = camera.GetAspectRatio();
+    const float nearZ = camera.GetNearZ();
+    const float farZ = camera.GetFarZ();
+
+    // 셰이더의 슬라이스 계산은 프레임마다 같이 갱신 (값이 같으면 결과도 같음)
+    const float logRatio = std::log(farZ / nearZ);
+    depthScale = static_cast<float>(CLUSTER_GRID_Z) / logRatio;
+    depthBias = -depthScale * std::log(nearZ);
+
+    if (boundsValid && fovY == cachedFovY && aspect == cachedAspect && nearZ == cachedNear && farZ == cachedFar)
+        return;
+
+    boundsValid = true;
+    cachedFovY = fovY;
+    cachedAspect = aspect;
+    cachedNear = nearZ;
+    cachedFar = farZ;
+
+    // 1) 지수 분할 깊이
+    sliceDepths.resize(CLUSTER_GRID_Z + 1);
+    for (uint32_t z = 0; z <= CLUSTER_GRID_Z; ++z)
+        sliceDepths[z] = nearZ * std::pow(farZ / nearZ, static_cast<float>(z) / CLUSTER_GRID_Z);
+
+    // 2) 타일 x 슬라이스 → 뷰 공간 AABB (near/far 사각형 8 모서리)
+    const float tanY = std::tan(fovY * 0.5f);
+    const float tanX = tanY * aspect;
+
+    clusterMin.resize(CLUSTER_COUNT);
+    clusterMax.resize(CLUSTER_COUNT);
+    for (uint32_t z = 0; z < CLUSTER_GRID_Z; ++z)
+    {
+        const float depths[2] = { sliceDepths[z], sliceDepths[z + 1] };
+        for (uint32_t y = 0; y < CLUSTER_GRID_Y; ++y)
+        {
+            // 화면 y 는 아래로 증가 → NDC y 는 위가 +1
+            const float ndcTop = 1.0f - 2.0f * y / CLUSTER_GRID_Y;
+            const float ndcBottom = 1.0f - 2.0f * (y + 1) / CLUSTER_GRID_Y;
+            for (uint32_t x = 0; x < CLUSTER_GRID_X; ++x)
+            {
+                const float ndcLeft = -1.0f + 2.0f * x / CLUSTER_GRID_X;
+                const float ndcRight = -1.0f + 2.0f * (x + 1) / CLUSTER_GRID_X;
+
+                XMFLOAT3 lo(FLT_MAX, FLT_MAX, depths[0]);
+                XMFLOAT3 hi(-FLT_MAX, -FLT_MAX, depths[1]);
+                for (float depth : depths)
+                {
+                    for (float ndcX : { ndcLeft, ndcRight })
+                    {
+                        lo.x = std::min(lo.x, ndcX * tanX * depth);
+                        hi.x = std::max(hi.x, ndcX * tanX * depth);
+                    }
+                    for (float ndcY : { ndcBottom, ndcTop })
+                    {
+                        lo.y = std::min(lo.y, ndcY * tanY * depth);
+                        hi.y = std::max(hi.y, ndcY * tanY * depth);
+                    }
+                }
+
+                const uint32_t cluster = ClusterIndex(x, y, z);
+                clusterMin[cluster] = lo;
+                clusterMax[cluster] = hi;
+            }
+        }
+    }
+}
+
+bool LightClusterGrid::ComputeClusterRange(FXMVECTOR center, float radius, uint32_t outMin[3], uint32_t outMax[3]) const
+{
+    XMFLOAT3 c;
+    XMStoreFloat3(&c, center);
+
+    // 1) 깊이 → 슬라이스 범위
+    const float zNear = std::max(c.z - radius, cachedNear);
+    const float zFar = std::min(c.z + radius, cachedFar);
+    if (zNear > zFar)
+        return false;
+
+    auto sliceOf = [this](float depth) {
+        const float slice = std::log(depth) * depthScale + depthBias;
+        return static_cast<uint32_t>(std::clamp(slice, 0.0f, static_cast<float>(CLUSTER_GRID_Z - 1)));
+    };
+    outMin[2] = sliceOf(zNear);
+    outMax[2] = sliceOf(zFar);
+
+    // 2) 구를 감싸는 상자의 투영 범위 → 타일 범위 (x/z 는 z 에 대해 단조이므로 양끝만 확인)
+    const float tanY = std::tan(cachedFovY * 0.5f);
+    const float tanX = tanY * cachedAspect;
+
+    const float xs[2] = { c.x - radius, c.x + radius };
+    const float ys[2] = { c.y - radius, c.y + radius };
+    float ndcMinX = FLT_MAX, ndcMaxX = -FLT_MAX;
+    float ndcMinY = FLT_MAX, ndcMaxY = -FLT_MAX;
+    for (float depth : { zNear, zFar })
+    {
+        for (float x : xs)
+        {
+            ndcMinX = std::min(ndcMinX, x / (depth * tanX));
+            ndcMaxX = std::max(ndcMaxX, x / (depth * tanX));
+        }
+        for (float y : ys)
+        {
+            ndcMinY = std::min(ndcMinY, y / (depth * tanY));
+            ndcMaxY = std::max(ndcMaxY, y / (depth * tanY));
+        }
+    }
+
+    if (ndcMinX > 1.0f || ndcMaxX < -1.0f || ndcMinY > 1.0f || ndcMaxY < -1.0f)
+        return false;
+
+    auto tileOf = [](float t, uint32_t count) {
+        return static_cast<uint32_t>(std::clamp(t * count, 0.0f, static_cast<float>(count - 1)));
+    };
+    outMin[0] = tileOf((ndcMinX + 1.0f) * 0.5f, CLUSTER_GRID_X);
+    outMax[0] = tileOf((ndcMaxX + 1.0f) * 0.5f, CLUSTER_GRID_X);
+    outMin[1] = tileOf((1.0f - ndcMaxY) * 0.5f, CLUSTER_GRID_Y);
+    outMax[1] = tileOf((1.0f - ndcMinY) * 0.5f, CLUSTER_GRID_Y);
+    return true;
+}
+
+void LightClusterGrid::AssignSphere(uint32_t lightIndex, FXMVECTOR center, float radius)
+{
+    uint32_t lo[3], hi[3];
+    if (!ComputeClusterRange(center, radius, lo, hi))
+        return;
+
+    for (uint32_t z = lo[2]; z <= hi[2]; ++z)
+        for (uint32_t y = lo[1]; y <= hi[1]; ++y)
+            for (uint32_t x = lo[0]; x <= hi[0]; ++x)
+            {
+                const uint32_t cluster = ClusterIndex(x, y, z);
+                if (SphereIntersectsAabb(center, radius, XMLoadFloat3(&clusterMin[cluster]), XMLoadFloat3(&clusterMax[cluster])))
+                    clusterLights[cluster].push_back(lightIndex);
+            }
+}
+
+void LightClusterGrid::AssignSpot(uint32_t lightIndex, FXMVECTOR apex, FXMVECTOR direction, float range, float outerAngle)
+{
+    uint32_t lo[3], hi[3];
+    if (!ComputeClusterRange(apex, range, lo, hi))
+        return;
+
+    const float cosAngle = std::cos(outerAngle);
+    const float sinAngle = std::sin(outerAngle);
+
+    for (uint32_t z = lo[2]; z <= hi[2]; ++z)
+        for (uint32_t y = lo[1]; y <= hi[1]; ++y)
+            for (uint32_t x = lo[0]; x <= hi[0]; ++x)
+            {
+                const uint32_t cluster = ClusterIndex(x, y, z);
+                const XMVECTOR aabbMin = XMLoadFloat3(&clusterMin[cluster]);
+                const XMVECTOR aabbMax = XMLoadFloat3(&clusterMax[cluster]);
+                if (!SphereIntersectsAabb(apex, range, aabbMin, aabbMax))
+                    continue;
+
+                // 클러스터 바운딩 구로 콘 검사
+                const XMVECTOR sphereCenter = XMVectorScale(XMVectorAdd(aabbMin, aabbMax), 0.5f);
+                const float sphereRadius = 0.5f * XMVectorGetX(XMVector3Length(XMVectorSubtract(aabbMax, aabbMin)));
+                if (ConeIntersectsSphere(apex, direction, range, cosAngle, sinAngle, sphereCenter, sphereRadius))
+                    clusterLights[cluster].push_back(lightIndex);
+            }
+}
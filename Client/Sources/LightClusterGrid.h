@@ -0,0 +1,83 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+#include "Lights/LightData.h"
+
+using namespace DirectX;
+
+class Camera;
+
+// 클러스터(froxel) 격자 크기. Common.hlsli 와 동일하게
+constexpr uint32_t CLUSTER_GRID_X = 16;
+constexpr uint32_t CLUSTER_GRID_Y = 9;
+constexpr uint32_t CLUSTER_GRID_Z = 24;
+constexpr uint32_t CLUSTER_COUNT = CLUSTER_GRID_X * CLUSTER_GRID_Y * CLUSTER_GRID_Z;
+
+constexpr uint32_t MAX_CLUSTERED_LIGHTS = 1024;
+constexpr uint32_t MAX_CLUSTER_LIGHT_INDICES = CLUSTER_COUNT * 32;
+
+// GPU 버퍼 (uint): [0, CLUSTER_COUNT * 2) = 클러스터별 (offset, count), 이후 = 라이트 인덱스
+// offset 은 버퍼 시작 기준 절대 위치
+constexpr uint32_t CLUSTER_DATA_SIZE = CLUSTER_COUNT * 2 + MAX_CLUSTER_LIGHT_INDICES;
+
+// ---------------------------------------------------------------------------
+// 클러스터드 포워드 라이트 배정 (CPU)
+//   - 뷰 공간 froxel: 화면 타일 X*Y, 깊이는 지수 분할 Z
+//   - Point: 구 vs 클러스터 AABB, Spot: 구 + 콘 vs 클러스터 바운딩 구
+//   - Directional 은 버퍼 앞쪽에 두고 모든 픽셀이 적용 (클러스터 목록에 넣지 않음)
+// ---------------------------------------------------------------------------
+class LightClusterGrid
+{
+public:
+    // lights 는 Directional 이 앞쪽 directionalCount 개로 정렬되어 있어야 함 (반경은 LightData::range)
+    void Build(const Camera& camera, uint32_t viewportWidth, uint32_t viewportHeight,
+        const std::vector<LightData>& lights, uint32_t directionalCount);
+
+    // CLUSTER_DATA_SIZE 크기 버퍼 내용 (앞쪽 GetUsedDataSize() 만 유효)
+    const std::vector<uint32_t>& GetClusterData() const { return clusterData; }
+    uint32_t GetUsedDataSize() const { return CLUSTER_COUNT * 2 + indexCount; }
+
+    // 셰이더: slice = log(viewZ) * scale + bias
+    float GetDepthScale() const { return depthScale; }
+    float GetDepthBias() const { return depthBias; }
+    XMFLOAT2 GetTileSize() const { return tileSize; }
+
+    uint32_t GetIndexCount() const { return indexCount; }
+    uint32_t GetMaxLightsPerCluster() const { return maxLightsPerCluster; }
+    bool IsOverflowed() const { return overflowed; }
+
+private:
+    void RebuildClusterBounds(const Camera& camera);
+    void AssignSphere(uint32_t lightIndex, FXMVECTOR center, float radius);
+    void AssignSpot(uint32_t lightIndex, FXMVECTOR apex, FXMVECTOR direction, float range, float outerAngle);
+
+    // 구가 걸치는 클러스터 범위 (z slice, 화면 타일)
+    bool ComputeClusterRange(FXMVECTOR center, float radius, uint32_t outMin[3], uint32_t outMax[3]) const;
+
+    uint32_t ClusterIndex(uint32_t x, uint32_t y, uint32_t z) const { return (z * CLUSTER_GRID_Y + y) * CLUSTER_GRID_X + x; }
+
+    // 뷰 공간 클러스터 AABB (프로젝션이 바뀔 때만 다시 계산)
+    std::vector<XMFLOAT3> clusterMin;
+    std::vector<XMFLOAT3> clusterMax;
+    std::vector<float>    sliceDepths;      // CLUSTER_GRID_Z + 1
+
+    float cachedFovY = 0.0f;
+    float cachedAspect = 0.0f;
+    float cachedNear = 0.0f;
+    float cachedFar = 0.0f;
+    bool  boundsValid = false;
+
+    // 클러스터별 임시 목록 → clusterData 로 평탄화
+    std::vector<std::vector<uint32_t>> clusterLights;
+    std::vector<uint32_t> clusterData;
+
+    float    depthScale = 0.0f;
+    float    depthBias = 0.0f;
+    XMFLOAT2 tileSize = {};
+
+    uint32_t indexCount = 0;
+    uint32_t maxLightsPerCluster = 0;
+    bool     overflowed = false;
+};
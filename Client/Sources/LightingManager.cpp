@@ -1,17 +1,23 @@
 #include "LightingManager.h"
 #include "Renderer.h"
 #include "FrameResource/FrameResource.h"
+#include "Lights/DirectionalLight.h"
+#include "DebugManager.h"
 #include <imgui.h>
 #include <algorithm>
+#include <format>
 
 using namespace DirectX;
 
 void LightingManager::AddLight(std::shared_ptr<BaseLight> light)
 {
-    if (lights.size() < MAX_LIGHTS)
+    if (lights.size() >= MAX_CLUSTERED_LIGHTS)
     {
-        lights.push_back(std::move(light));
+        DebugManager::GetInstance().LogMessage(std::format(
+            L"[Lighting] AddLight ignored: MAX_CLUSTERED_LIGHTS ({}) reached", MAX_CLUSTERED_LIGHTS));
+        return;
     }
+    lights.push_back(std::move(light));
 }
 
 void LightingManager::ClearLights()
@@ -26,27 +32,34 @@ void LightingManager::Update(Renderer* renderer)
     lightingData = {};
     lightingData.cameraWorld = camera->GetPosition();
 
-    size_t count = std::min<size_t>(lights.size(), static_cast<size_t>(MAX_LIGHTS));
-    for (size_t i = 0; i < count; ++i)
-    {
-        auto& light = lights[i];
-        lightingData.lights[i] = light->GetLightData();
+    // 캐스케이드 텍셀 스냅이 타일 해상도를 쓰므로 라이트 Update 전에 배정
+    AssignShadowSlots();
+    AllocateShadowAtlas(renderer);
 
-        if (light->IsShadowCastingEnabled())
+    // 섀도우 슬롯을 받은 라이트만 그림자 행렬 갱신
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        if (shadowSlots[i] >= 0)
         {
-            light->Update(camera);
+            lights[i]->Update(camera);
         }
     }
 
     UpdateImGui();
+    BuildClusters(renderer);
+
     UploadLightingBuffer(renderer);
     UploadShadowViewProjBuffer(renderer);
+    UploadClusterBuffers(renderer);
 }
 
 void LightingManager::UpdateImGui()
 {
     ImGui::Begin("Lighting Controls");
-    for (size_t i = 0; i < lights.size(); ++i)
+
+    // 라이트가 많을 수 있으므로 앞쪽 MAX_LIGHTS 개만 편집
+    const size_t editableCount = std::min<size_t>(lights.size(), MAX_LIGHTS);
+    for (size_t i = 0; i < editableCount; ++i)
     {
         auto& light = lights[i];
         LightData data = light->GetLightData();
@@ -94,9 +107,118 @@ void LightingManager::UpdateImGui()
 
         light->SetLightData(data);
     }
+
+    ImGui::Separator();
+    ImGui::Text("Clustered Lights: %zu (%u x %u x %u clusters)", clusterLightData.size(), CLUSTER_GRID_X, CLUSTER_GRID_Y, CLUSTER_GRID_Z);
+    ImGui::Text("  indices %u / %u, max per cluster %u%s", clusterGrid.GetIndexCount(), MAX_CLUSTER_LIGHT_INDICES,
+        clusterGrid.GetMaxLightsPerCluster(), clusterGrid.IsOverflowed() ? " (overflow)" : "");
+
+    ImGui::Separator();
+    ImGui::Text("Shadow Atlas %u x %u : %.1f / %.1f MB", SHADOW_ATLAS_SIZE, SHADOW_ATLAS_SIZE,
+        shadowAtlas.GetUsedBytes() / (1024.0 * 1024.0), shadowAtlas.GetMemoryBudget() / (1024.0 * 1024.0));
+    for (size_t face = 0; face < shadowAtlas.GetTileCount(); ++face)
+    {
+        const ShadowAtlasTile& tile = shadowAtlas.GetTile(face);
+        ImGui::Text("  face %zu : %u (%u, %u)", face, tile.size, tile.x, tile.y);
+    }
     ImGui::End();
 }
 
+void LightingManager::AssignShadowSlots()
+{
+    // 라이트 순서대로 면 수만큼 연속 배정. 모든 면이 들어가지 않으면 그림자 없이 라이팅만
+    shadowSlots.assign(lights.size(), -1);
+
+    size_t nextSlot = 0;
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        if (!lights[i]->IsShadowCastingEnabled())
+            continue;
+
+        const size_t faceCount = lights[i]->GetShadowViewProjMatrixCount();
+        if (nextSlot + faceCount > MaxShadowMaps)
+            continue;
+
+        shadowSlots[i] = static_cast<int>(nextSlot);
+        nextSlot += faceCount;
+    }
+}
+
+void LightingManager::AllocateShadowAtlas(Renderer* renderer)
+{
+    Camera* camera = renderer->GetCamera();
+    const float viewportHeight = static_cast<float>(renderer->GetViewportHeight());
+
+    // 1) 면마다 화면 커버리지 기반 희망 해상도 (섀도우맵 인덱스 순서)
+    std::vector<uint32_t> requestedSizes;
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        if (shadowSlots[i] < 0)
+            continue;
+
+        const uint32_t size = ShadowAtlas::ComputeRequestedSize(*lights[i], *camera, viewportHeight);
+        requestedSizes.resize(shadowSlots[i] + lights[i]->GetShadowViewProjMatrixCount(), size);
+    }
+
+    // 2) 예산 안에서 배치
+    shadowAtlas.Allocate(requestedSizes);
+
+    // 3) 배정된 해상도를 라이트에 돌려줌
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        if (shadowSlots[i] < 0)
+            continue;
+
+        for (size_t face = 0; face < lights[i]->GetShadowViewProjMatrixCount(); ++face)
+        {
+            const size_t slot = shadowSlots[i] + face;
+            lights[i]->SetShadowFaceResolution(face, slot < shadowAtlas.GetTileCount() ? shadowAtlas.GetTile(slot).size : 0);
+        }
+    }
+}
+
+void LightingManager::BuildClusters(Renderer* renderer)
+{
+    auto toGpuData = [this](size_t i) {
+        LightData data = lights[i]->GetLightData();
+        data.range = lights[i]->GetShadowRange();
+        data.shadowMapIndex = shadowSlots[i];
+        return data;
+    };
+
+    // 1) Directional 을 앞에 모으고 나머지는 뒤에 (셰이더는 앞쪽을 모든 픽셀에 적용)
+    clusterLightData.clear();
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        if (lights[i]->GetType() == LightType::Directional)
+            clusterLightData.push_back(toGpuData(i));
+    }
+    const uint32_t directionalCount = static_cast<uint32_t>(clusterLightData.size());
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        if (lights[i]->GetType() != LightType::Directional)
+            clusterLightData.push_back(toGpuData(i));
+    }
+
+    // 2) Phong 경로는 기존 상수 버퍼 배열을 그대로 사용
+    const size_t phongCount = std::min<size_t>(lights.size(), MAX_LIGHTS);
+    for (size_t i = 0; i < phongCount; ++i)
+    {
+        lightingData.lights[i] = toGpuData(i);
+    }
+
+    // 3) froxel 배정
+    clusterGrid.Build(*renderer->GetCamera(),
+        static_cast<uint32_t>(renderer->GetViewportWidth()), static_cast<uint32_t>(renderer->GetViewportHeight()),
+        clusterLightData, directionalCount);
+
+    lightingData.clusterLightCount = static_cast<uint32_t>(clusterLightData.size());
+    lightingData.directionalLightCount = directionalCount;
+    lightingData.clusterDepthScale = clusterGrid.GetDepthScale();
+    lightingData.clusterDepthBias = clusterGrid.GetDepthBias();
+    lightingData.clusterTileSize = clusterGrid.GetTileSize();
+}
+
 void LightingManager::UploadLightingBuffer(Renderer* renderer)
 {
     FrameResource* frameResource = renderer->GetCurrentFrameResource();
@@ -114,27 +236,52 @@ void LightingManager::UploadShadowViewProjBuffer(Renderer* renderer)
 
     CB_ShadowMapViewProj shadowData = {};
 
-    // 전체 슬롯 인덱스
-    UINT slot = 0;
-
-    // 각 라이트별로 shadowViewProjMatrices를 꺼내서 채워넣는다.
-    for (auto& lightPtr : lights)
+    // 1) 각 라이트별로 shadowViewProjMatrices를 꺼내서 자기 슬롯에 채워넣는다.
+    for (size_t i = 0; i < lights.size(); ++i)
     {
-        if (!lightPtr->IsShadowCastingEnabled())
+        if (shadowSlots[i] < 0)
             continue;
 
+        auto& lightPtr = lights[i];
         const auto& matrices = lightPtr->GetShadowViewProjMatrices();
-        for (size_t j = 0; j < matrices.size() && slot < MaxShadowMaps; ++j)
+        for (size_t j = 0; j < matrices.size(); ++j)
         {
+            const size_t slot = shadowSlots[i] + j;
+
             // 행렬전치
             XMStoreFloat4x4(&shadowData.ShadowMapViewProj[slot], XMMatrixTranspose(matrices[j]));
-            ++slot;
+            shadowData.shadowAtlasRects[slot] = shadowAtlas.GetScaleOffset(slot);
+        }
+
+        // 2) 캐스케이드 선택 정보 (그림자를 드리우는 첫 DirectionalLight 기준)
+        if (shadowData.cascadeCount == 0.0f && lightPtr->GetType() == LightType::Directional)
+        {
+            const auto& splits = static_cast<const DirectionalLight&>(*lightPtr).GetCascadeSplits();
+            shadowData.cascadeSplits = XMFLOAT4(splits[1], splits[2], splits[3], splits[4]);
+            shadowData.cascadeCount = static_cast<float>(NUM_CASCADES);
         }
     }
 
+    // 캐스케이드 분할과 같은 기준 (뷰 행렬의 +Z 축)
+    XMMATRIX inverseView = XMMatrixInverse(nullptr, renderer->GetCamera()->GetViewMatrix());
+    XMStoreFloat3(&shadowData.cameraForward, XMVector3Normalize(inverseView.r[2]));
+
     frameResource->cbShadowViewProj->CopyData(0, shadowData);
 }
 
+void LightingManager::UploadClusterBuffers(Renderer* renderer)
+{
+    FrameResource* frameResource = renderer->GetCurrentFrameResource();
+    if (!(frameResource && frameResource->clusterLights && frameResource->clusterData))
+        return;
+
+    if (!clusterLightData.empty())
+    {
+        frameResource->clusterLights->CopyRange(0, clusterLightData.data(), static_cast<UINT>(clusterLightData.size()));
+    }
+    frameResource->clusterData->CopyRange(0, clusterGrid.GetClusterData().data(), clusterGrid.GetUsedDataSize());
+}
+
 const std::vector<std::shared_ptr<BaseLight>>& LightingManager::GetLights() const
 {
     return lights;
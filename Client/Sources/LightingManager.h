@@ -9,6 +9,8 @@
 #include "Lights/LightData.h"
 #include "ConstantBuffers.h"
 #include "ShadowMap.h"
+#include "ShadowAtlas.h"
+#include "LightClusterGrid.h"
 #include "Camera.h"
 
 using namespace DirectX;
@@ -27,10 +29,28 @@ public:
     void UpdateImGui();
     const std::vector<std::shared_ptr<BaseLight>>& GetLights() const;
 
+    // 면(섀도우맵 인덱스)별 아틀라스 타일
+    const ShadowAtlas& GetShadowAtlas() const { return shadowAtlas; }
+
+    // 라이트 첫 면의 섀도우맵 인덱스 (-1 = 그림자 없음, 모든 면이 MaxShadowMaps 안에 들어갈 때만 배정)
+    int GetShadowSlot(size_t lightIndex) const { return lightIndex < shadowSlots.size() ? shadowSlots[lightIndex] : -1; }
+
+    const LightClusterGrid& GetClusterGrid() const { return clusterGrid; }
+
 private:
     void UploadLightingBuffer(Renderer* renderer);
     void UploadShadowViewProjBuffer(Renderer* renderer);
+    void UploadClusterBuffers(Renderer* renderer);
+    void AssignShadowSlots();
+    void AllocateShadowAtlas(Renderer* renderer);
+    void BuildClusters(Renderer* renderer);
 
     std::vector<std::shared_ptr<BaseLight>> lights;
     CB_Lighting lightingData = {};
+    ShadowAtlas shadowAtlas;
+    std::vector<int> shadowSlots;
+
+    // 클러스터드 라이팅: Directional 을 앞에 모은 GPU 라이트 배열 (t8)
+    std::vector<LightData> clusterLightData;
+    LightClusterGrid clusterGrid;
 };
\ No newline at end of file
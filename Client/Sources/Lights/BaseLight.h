@@ -2,6 +2,7 @@
 
 #include <DirectXMath.h>
 #include <vector>
+#include <cstdint>
 #include "LightData.h"
 #include "LightType.h"
 #include "Camera.h"
@@ -39,7 +40,15 @@ public:
 
     void SetShadowCastingEnabled(bool enabled) { lightData.shadowCastingEnabled = enabled ? 1 : 0; }
 
+    // Shadow atlas tile resolution per face (0 = no tile this frame)
+    void SetShadowFaceResolution(size_t face, uint32_t resolution) { shadowFaceResolutions.resize(shadowViewProjMatrices.size()); shadowFaceResolutions[face] = resolution; }
+    uint32_t GetShadowFaceResolution(size_t face) const { return face < shadowFaceResolutions.size() ? shadowFaceResolutions[face] : 0; }
+
+    // Shadow influence radius, used to estimate screen coverage (0 = unbounded, e.g. directional)
+    virtual float GetShadowRange() const { return 0.0f; }
+
 protected:
     LightData               lightData = {};
     std::vector<XMMATRIX>   shadowViewProjMatrices;
+    std::vector<uint32_t>   shadowFaceResolutions;
 };
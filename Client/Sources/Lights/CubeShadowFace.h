@@ -0,0 +1,48 @@
+#pragma once
+
+#include <DirectXMath.h>
+
+// ---------------------------------------------------------------------------
+// 포인트 라이트 큐브 섀도우 면 (순서: +X, -X, +Y, -Y, +Z, -Z)
+//   PbrLighting.hlsli 의 CubeShadowFace() 와 같은 규칙이므로 함께 고칠 것
+// ---------------------------------------------------------------------------
+namespace CubeShadowFace
+{
+    constexpr int FaceCount = 6;
+
+    inline constexpr DirectX::XMFLOAT3 Directions[FaceCount] = {
+        { 1.0f,  0.0f,  0.0f }, { -1.0f,  0.0f,  0.0f },
+        { 0.0f,  1.0f,  0.0f }, {  0.0f, -1.0f,  0.0f },
+        { 0.0f,  0.0f,  1.0f }, {  0.0f,  0.0f, -1.0f },
+    };
+
+    inline constexpr DirectX::XMFLOAT3 Ups[FaceCount] = {
+        { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f,  0.0f },
+        { 0.0f, 0.0f, -1.0f }, { 0.0f, 0.0f, 1.0f },
+        { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f,  0.0f },
+    };
+
+    // lightToPixel 이 들어가는 면: 절대값이 가장 큰 축 (같으면 x > y > z 순)
+    inline int Select(const DirectX::XMFLOAT3& lightToPixel)
+    {
+        const float ax = lightToPixel.x < 0.0f ? -lightToPixel.x : lightToPixel.x;
+        const float ay = lightToPixel.y < 0.0f ? -lightToPixel.y : lightToPixel.y;
+        const float az = lightToPixel.z < 0.0f ? -lightToPixel.z : lightToPixel.z;
+
+        if (ax >= ay && ax >= az)
+            return lightToPixel.x >= 0.0f ? 0 : 1;
+        if (ay >= az)
+            return lightToPixel.y >= 0.0f ? 2 : 3;
+        return lightToPixel.z >= 0.0f ? 4 : 5;
+    }
+
+    // 면 하나의 90도 원근 view * proj
+    inline DirectX::XMMATRIX ComputeViewProj(int face, DirectX::FXMVECTOR lightPosition, float nearZ, float farZ)
+    {
+        using namespace DirectX;
+
+        const XMMATRIX view = XMMatrixLookToLH(lightPosition, XMLoadFloat3(&Directions[face]), XMLoadFloat3(&Ups[face]));
+        const XMMATRIX proj = XMMatrixPerspectiveFovLH(XM_PIDIV2, 1.0f, nearZ, farZ);
+        return XMMatrixMultiply(view, proj);
+    }
+}
@@ -1,12 +1,15 @@
 #include "DirectionalLight.h"
+#include "ShadowCascades.h"
+#include "ShadowMap.h"
 #include <DirectXMath.h>
+#include <algorithm>
 
 using namespace DirectX;
 
 DirectionalLight::DirectionalLight()
 {
     lightData.type = static_cast<int>(LightType::Directional);
-    shadowViewProjMatrices.resize(1);
+    shadowViewProjMatrices.resize(NUM_CASCADES);
 }
 
 LightType DirectionalLight::GetType() const
@@ -16,11 +19,6 @@ LightType DirectionalLight::GetType() const
 
 void DirectionalLight::Update(Camera* camera)
 {
-    const float orthoWidth = 200.0f;
-    const float orthoHeight = 200.0f;
-    const float nearZ = 1.0f;
-    const float farZ = 200.0f;
-    const float shadowDistance = farZ * 0.5f;
     constexpr float epsilon = 1e-6f;
 
     XMVECTOR lightDir = XMLoadFloat3(&lightData.direction);
@@ -37,6 +35,45 @@ void DirectionalLight::Update(Camera* camera)
         lightDir = XMVector3Normalize(lightDir);
     }
 
+    if (!camera->IsPerspective())
+    {
+        UpdateFallbackOrtho(camera, lightDir);
+        return;
+    }
+
+    // 1) 분할 거리 (log / uniform 블렌드)
+    const float nearZ = camera->GetNearZ();
+    const float farZ = std::min(camera->GetFarZ(), shadowDistance);
+    ShadowCascades::ComputeSplitDistances(nearZ, farZ, NUM_CASCADES, splitLambda, cascadeSplits.data());
+
+    // 2) 서브 프러스텀마다 최소 구 → 텍셀 스냅된 ortho
+    const XMMATRIX inverseView = XMMatrixInverse(nullptr, camera->GetViewMatrix());
+    for (UINT cascade = 0; cascade < NUM_CASCADES; ++cascade)
+    {
+        BoundingSphere sphere = ShadowCascades::ComputeSliceBoundingSphere(
+            camera->GetFovY(), camera->GetAspectRatio(),
+            cascadeSplits[cascade], cascadeSplits[cascade + 1]);
+        sphere.Transform(sphere, inverseView);
+
+        // 아틀라스 타일 해상도 기준으로 텍셀 스냅 (미배정이면 최대 해상도로)
+        uint32_t resolution = GetShadowFaceResolution(cascade);
+        if (resolution == 0)
+            resolution = SHADOW_MAP_WIDTH;
+
+        shadowViewProjMatrices[cascade] = ShadowCascades::ComputeCascadeViewProj(
+            sphere, lightDir, resolution, casterExtension);
+    }
+}
+
+void DirectionalLight::UpdateFallbackOrtho(Camera* camera, FXMVECTOR lightDir)
+{
+    // 직교 카메라: 카메라 주변 고정 크기 한 장을 모든 캐스케이드에 사용
+    const float orthoWidth = 200.0f;
+    const float orthoHeight = 200.0f;
+    const float nearZ = 1.0f;
+    const float farZ = 200.0f;
+    const float shadowDistance = farZ * 0.5f;
+
     XMFLOAT3 camPosFloat = camera->GetPosition();
     XMVECTOR camPos = XMLoadFloat3(&camPosFloat);
     XMVECTOR lightPos = camPos - lightDir * shadowDistance;
@@ -52,5 +89,9 @@ void DirectionalLight::Update(Camera* camera)
     XMMATRIX lightView = XMMatrixLookAtLH(lightPos, target, up);
     XMMATRIX lightProj = XMMatrixOrthographicLH(orthoWidth, orthoHeight, nearZ, farZ);
 
-    shadowViewProjMatrices[0] = lightView * lightProj;
-}
\ No newline at end of file
+    for (auto& matrix : shadowViewProjMatrices)
+        matrix = lightView * lightProj;
+
+    cascadeSplits.fill(camera->GetFarZ());
+    cascadeSplits[0] = camera->GetNearZ();
+}
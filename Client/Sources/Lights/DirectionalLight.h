@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include "BaseLight.h"
 
 class DirectionalLight : public BaseLight
@@ -9,4 +10,19 @@ public:
 
     LightType GetType() const override;
     void Update(Camera* camera) override;
-};
\ No newline at end of file
+
+    // 캐스케이드 i 는 뷰 깊이 [splits[i], splits[i + 1]] 구간을 담당
+    const std::array<float, NUM_CASCADES + 1>& GetCascadeSplits() const { return cascadeSplits; }
+
+    void SetSplitLambda(float lambda) { splitLambda = lambda; }
+    void SetShadowDistance(float distance) { shadowDistance = distance; }
+
+private:
+    void UpdateFallbackOrtho(Camera* camera, FXMVECTOR lightDir);
+
+    float splitLambda = 0.75f;          // 0 = uniform, 1 = log
+    float shadowDistance = 400.0f;      // 캐스케이드가 덮는 최대 거리 (카메라 far 로 클램프)
+    float casterExtension = 500.0f;     // 라이트 쪽으로 캐스터를 담기 위한 near 확장
+
+    std::array<float, NUM_CASCADES + 1> cascadeSplits{};
+};
@@ -6,7 +6,7 @@ using namespace DirectX;
 struct LightData
 {
     XMFLOAT3 position;
-    float     _pad0;
+    float     range;                    // 영향 반경 (클러스터 배정 + 셰이더 컷오프, Directional 은 0)
 
     XMFLOAT3 direction;
     float     _pad1;
@@ -17,7 +17,7 @@ struct LightData
     float     innerCutoffAngle;
     float     outerCutoffAngle;
     int       shadowCastingEnabled = 1;
-    float     _pad3;
+    int       shadowMapIndex = -1;      // 첫 면의 섀도우맵 인덱스 (-1 = 슬롯 없음)
 
     float     constant;
     float     linear;
@@ -4,6 +4,7 @@ constexpr int MAX_LIGHTS = 3;
 constexpr int NUM_DIR_LIGHTS = 1;
 constexpr int NUM_POINT_LIGHTS = 1;
 constexpr int NUM_SPOT_LIGHTS = 1;
+constexpr int NUM_CASCADES = 4;        // DirectionalLight 캐스케이드 수 (Common.hlsli 와 동일하게)
 
 
 enum class LightType : int {
@@ -1,4 +1,5 @@
 #include "PointLight.h"
+#include "CubeShadowFace.h"
 #include <DirectXMath.h>
 
 using namespace DirectX;
@@ -6,7 +7,7 @@ using namespace DirectX;
 PointLight::PointLight()
 {
     lightData.type = static_cast<int>(LightType::Point);
-    shadowViewProjMatrices.resize(6); // 큐브맵 6면
+    shadowViewProjMatrices.resize(CubeShadowFace::FaceCount); // 큐브맵 6면
 }
 
 LightType PointLight::GetType() const
@@ -16,38 +17,31 @@ LightType PointLight::GetType() const
 
 void PointLight::Update(Camera* camera)
 {
-    static const XMVECTOR directions[6] = {
-        XMVectorSet(1,  0,  0, 0), XMVectorSet(-1,  0,  0, 0),
-        XMVectorSet(0,  1,  0, 0), XMVectorSet(0, -1,  0, 0),
-        XMVectorSet(0,  0,  1, 0), XMVectorSet(0,  0, -1, 0),
-    };
-
-    static const XMVECTOR ups[6] = {
-        XMVectorSet(0, 1, 0, 0), XMVectorSet(0, 1, 0, 0),
-        XMVectorSet(0, 0, -1, 0), XMVectorSet(0, 0, 1, 0),
-        XMVectorSet(0, 1, 0, 0), XMVectorSet(0, 1, 0, 0),
-    };
-
     XMVECTOR lightPos = XMLoadFloat3(&lightData.position);
 
     // 감쇠가 1% 이하로 떨어지는 거리를 farZ로
     float nearZ = 0.1f;
     float farZ = ComputeShadowFarZ(lightData.constant, lightData.linear, lightData.quadratic, 0.01f); 
 
-    XMMATRIX proj = XMMatrixPerspectiveFovLH(
-        XM_PIDIV2,    // 90도
-        1.0f,         // 정사각
-        nearZ,
-        farZ
-    );
+    // 라이트가 그대로면 이전 행렬 재사용 (섀도우 캐시도 clean 유지)
+    if (farZ == cachedFarZ && XMVector3Equal(lightPos, XMLoadFloat3(&cachedPosition)))
+        return;
+
+    cachedPosition = lightData.position;
+    cachedFarZ = farZ;
 
-    for (int i = 0; i < 6; ++i) {
-        XMMATRIX view = XMMatrixLookAtLH(lightPos, lightPos + directions[i], ups[i]);
-        shadowViewProjMatrices[i] = XMMatrixMultiply(view, proj);
+    // 면 순서/방향은 셰이더의 면 선택(CubeShadowFace)과 공유
+    for (int i = 0; i < CubeShadowFace::FaceCount; ++i) {
+        shadowViewProjMatrices[i] = CubeShadowFace::ComputeViewProj(i, lightPos, nearZ, farZ);
     }
 }
 
-float PointLight::ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold)
+float PointLight::GetShadowRange() const
+{
+    return ComputeShadowFarZ(lightData.constant, lightData.linear, lightData.quadratic, 0.01f);
+}
+
+float PointLight::ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold) const
 {
     // 1/(C + L·d + Q·d²) = threshold  ⇒  C + L·d + Q·d² = 1/threshold
     float target = 1.0f / threshold - constant;
@@ -10,6 +10,12 @@ public:
     LightType GetType() const override;
     void Update(Camera* camera) override;
 
+    float GetShadowRange() const override;
+
 private:
-    float ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold = 0.01f);
+    // 위치/감쇠가 그대로면 6면 행렬을 다시 계산하지 않음
+    XMFLOAT3 cachedPosition = {};
+    float    cachedFarZ = -1.0f;
+
+    float ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold = 0.01f) const;
 };
\ No newline at end of file
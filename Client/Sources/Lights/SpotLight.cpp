@@ -44,7 +44,12 @@ void SpotLight::Update(Camera* camera)
     shadowViewProjMatrices[0] = view * proj;
 }
 
-float SpotLight::ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold)
+float SpotLight::GetShadowRange() const
+{
+    return ComputeShadowFarZ(lightData.constant, lightData.linear, lightData.quadratic, 0.01f);
+}
+
+float SpotLight::ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold) const
 {
     // 1/(C + L·d + Q·d²) = threshold  ⇒  C + L·d + Q·d² = 1/threshold
     float target = 1.0f / threshold - constant;
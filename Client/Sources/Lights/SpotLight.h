@@ -10,6 +10,8 @@ public:
     LightType GetType() const override;
     void Update(Camera* camera) override;
 
+    float GetShadowRange() const override;
+
 private:
-    float ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold = 0.01f);
+    float ComputeShadowFarZ(float constant, float linear, float quadratic, float threshold = 0.01f) const;
 };
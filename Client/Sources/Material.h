@@ -4,6 +4,7 @@
 #include <DirectXMath.h>
 #include <cstdint>
 #include "Texture.h"
+#include "ConstantBuffers.h"
 
 
 struct MaterialPbrParameters
@@ -49,6 +50,30 @@ public:
         emissiveTexture = textures.emissiveTexture;
     }
 
+    // Bindless 머티리얼 테이블 인덱스 (MaterialTable::Register 에서 지정)
+    UINT GetMaterialIndex() const { return materialIndex; }
+    void SetMaterialIndex(UINT index) { materialIndex = index; }
+
+    // 비 bindless PBR 의 t0~t3 연속 테이블 (MaterialTable::UpdateTextureTables 가 텍스쳐 SRV 가 바뀔 때만 다시 만듦)
+    // 아직 만들어지지 않았으면 ptr == 0
+    D3D12_GPU_DESCRIPTOR_HANDLE GetTextureTable() const { return textureTable; }
+    void SetTextureTable(D3D12_GPU_DESCRIPTOR_HANDLE table) { textureTable = table; }
+
+    // 실제로 바인딩 가능한 텍스쳐의 USE_*_MAP 비트 (셰이더 퍼뮤테이션 선택 키)
+    uint32_t GetFeatureFlags() const
+    {
+        auto hasTexture = [](const std::shared_ptr<Texture>& texture) {
+            return texture && texture->GetDescriptorIndex() != UINT(-1);
+        };
+
+        uint32_t flags = 0;
+        if (hasTexture(albedoTexture))    flags |= USE_ALBEDO_MAP;
+        if (hasTexture(normalTexture))    flags |= USE_NORMAL_MAP;
+        if (hasTexture(metallicTexture))  flags |= USE_METALLIC_MAP;
+        if (hasTexture(roughnessTexture)) flags |= USE_ROUGHNESS_MAP;
+        return flags;
+    }
+
     // Texture getters
     std::shared_ptr<Texture> GetAlbedoTexture() const { return albedoTexture; }
     std::shared_ptr<Texture> GetNormalTexture() const { return normalTexture; }
@@ -64,4 +89,7 @@ private:
     std::shared_ptr<Texture> roughnessTexture;
     std::shared_ptr<Texture> ambientOcclusionTexture;
     std::shared_ptr<Texture> emissiveTexture;
+
+    UINT materialIndex = UINT(-1);
+    D3D12_GPU_DESCRIPTOR_HANDLE textureTable{ 0 };
 };
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "MaterialTable.h"
+#include "TextureManager.h"
+#include <stdexcept>
+
+UINT MaterialTable::Register(const std::shared_ptr<Material>& material)
+{
+    if (!material)
+        throw std::invalid_argument("MaterialTable::Register - material is null");
+
+    // 이미 등록된 머티리얼이면 기존 인덱스 재사용
+    if (material->GetMaterialIndex() != UINT(-1))
+        return material->GetMaterialIndex();
+
+    if (materials.size() >= MaxMaterials)
+        throw std::runtime_error("MaterialTable: too many materials");
+
+    const UINT index = static_cast<UINT>(materials.size());
+    materials.push_back({ material });
+    material->SetMaterialIndex(index);
+    return index;
+}
+
+void MaterialTable::Upload(UploadBuffer<MaterialGpuData>* buffer) const
+{
+    for (UINT i = 0; i < materials.size(); ++i)
+    {
+        // 해제된 머티리얼 슬롯은 그대로 둔다 (참조하는 드로우가 없음)
+        if (auto material = materials[i].material.lock())
+            buffer->CopyData(i, BuildGpuData(*material));
+    }
+}
+
+uint32_t MaterialTable::GetFeatureMaskSet() const
+{
+    uint32_t maskSet = 0;
+    for (const Entry& entry : materials)
+    {
+        if (auto material = entry.material.lock())
+            maskSet |= 1u << (material->GetFeatureFlags() & MATERIAL_FEATURE_MASK);
+    }
+    return maskSet;
+}
+
+void MaterialTable::UpdateTextureTables(TextureManager* textureManager)
+{
+    for (Entry& entry : materials)
+    {
+        const auto material = entry.material.lock();
+
+        // 1) 해제된 머티리얼은 테이블만 회수
+        if (!material)
+        {
+            if (entry.textureTable.index != UINT(-1))
+            {
+                textureManager->FreeTextureTable(entry.textureTable, TextureTableSize);
+                entry.textureTable.index = UINT(-1);
+            }
+            continue;
+        }
+
+        // 2) 네 텍스쳐의 SRV 가 그대로면 기존 테이블 유지
+        const std::shared_ptr<Texture> textures[TextureTableSize] = {
+            material->GetAlbedoTexture(),
+            material->GetNormalTexture(),
+            material->GetMetallicTexture(),
+            material->GetRoughnessTexture()
+        };
+
+        std::array<UINT64, TextureTableSize> versions{};
+        for (UINT slot = 0; slot < TextureTableSize; ++slot)
+            versions[slot] = textures[slot] ? textures[slot]->GetViewVersion() : 0;
+
+        if (entry.textureTable.index != UINT(-1) && versions == entry.textureVersions)
+            continue;
+
+        // 3) 새 슬롯에 다시 만들고 이전 슬롯은 지연 해제 (지난 프레임 커맨드 리스트가 참조 중일 수 있음)
+        if (entry.textureTable.index != UINT(-1))
+            textureManager->FreeTextureTable(entry.textureTable, TextureTableSize);
+
+        entry.textureTable = textureManager->CreateTextureTable(textures, TextureTableSize);
+        entry.textureVersions = versions;
+        material->SetTextureTable(entry.textureTable.gpuHandle);
+    }
+}
+
+MaterialGpuData MaterialTable::BuildGpuData(const Material& material)
+{
+    MaterialGpuData data{};
+    const auto& parameters = material.parameters;
+    data.baseColor = parameters.baseColor;
+    data.metallic = parameters.metallic;
+    data.specular = parameters.specular;
+    data.roughness = parameters.roughness;
+    data.ambientOcclusion = parameters.ambientOcclusion;
+    data.emissiveColor = parameters.emissiveColor;
+    data.emissiveIntensity = parameters.emissiveIntensity;
+
+    // 텍스쳐가 있으면 flag 를 켜고 heap index 기록
+    data.flags = material.GetFeatureFlags();
+
+    const std::shared_ptr<Texture> textures[4] = {
+        material.GetAlbedoTexture(),
+        material.GetNormalTexture(),
+        material.GetMetallicTexture(),
+        material.GetRoughnessTexture()
+    };
+
+    for (UINT slot = 0; slot < 4; ++slot)
+    {
+        if (data.flags & (1u << slot))
+            data.textureIndices[slot] = textures[slot]->GetDescriptorIndex();
+    }
+
+    return data;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <d3d12.h>
+#include <array>
+#include <memory>
+#include <vector>
+#include "ConstantBuffers.h"
+#include "DescriptorHandle.h"
+#include "Material.h"
+#include "FrameResource/UploadBuffer.h"
+
+class TextureManager;
+
+// ---------------------------------------------------------------------------
+// MaterialTable
+// Bindless 경로에서 쓰는 머티리얼 목록.
+//   - Register() 로 Material 에 고정 인덱스를 부여 (같은 Material 은 한 번만 등록)
+//   - Upload() 는 매 프레임 FrameResource 의 StructuredBuffer 로 파라미터/텍스쳐 인덱스를 복사
+//   - 셰이더는 root constant 로 받은 materialIndex 로 해당 줄을 읽는다
+//   - 비 bindless 경로용 t0~t3 연속 테이블도 머티리얼마다 하나씩 유지 (UpdateTextureTables)
+// ---------------------------------------------------------------------------
+class MaterialTable
+{
+public:
+    static constexpr UINT MaxMaterials = 1024;
+
+    UINT Register(const std::shared_ptr<Material>& material);
+
+    void Upload(UploadBuffer<MaterialGpuData>* buffer) const;
+
+    UINT GetMaterialCount() const { return static_cast<UINT>(materials.size()); }
+
+    // 살아있는 머티리얼이 쓰는 feature mask 집합 (비트 i = mask i, 퍼뮤테이션 미리 생성용)
+    uint32_t GetFeatureMaskSet() const;
+
+    // 텍스쳐가 바뀌었거나 (Set*Texture) 텍스쳐 SRV 가 바뀐 (로드 완료 / 스트리밍 밉 변경) 머티리얼만 테이블을 다시 만들고,
+    // 해제된 머티리얼의 테이블은 회수
+    // 렌더 스레드에서 텍스쳐 갱신 (AssetLoader / TextureStreamer) 이 끝난 뒤, 드로우 전에 호출
+    void UpdateTextureTables(TextureManager* textureManager);
+
+    static constexpr UINT TextureTableSize = 4;     // 알베도 / 노멀 / 메탈릭 / 러프니스
+
+private:
+    static MaterialGpuData BuildGpuData(const Material& material);
+
+    struct Entry
+    {
+        std::weak_ptr<Material> material;
+
+        // 마지막으로 만든 테이블과 그때의 텍스쳐 GetViewVersion (0 = 텍스쳐 없음)
+        DescriptorHandle textureTable{ {0}, {0}, UINT(-1) };
+        std::array<UINT64, TextureTableSize> textureVersions{};
+    };
+
+    std::vector<Entry> materials;
+};
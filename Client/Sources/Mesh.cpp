@@ -134,24 +134,123 @@ static void BuildSphere(
 
 bool Mesh::Initialize(Renderer* renderer,
     const std::vector<MeshVertex>& vertices,
-    const std::vector<uint32_t>& indices) {
+    const std::vector<uint32_t>& indices,
+    const std::vector<MeshLod>& lods) {
     if (vertices.empty() || indices.empty()) return false;
 
-    indexCount = static_cast<uint32_t>(indices.size());
+    BoundingSphere localBounds;
+    BoundingSphere::CreateFromPoints(localBounds, vertices.size(), &vertices[0].position, sizeof(MeshVertex));
 
-    const size_t vertexBytes = vertices.size() * sizeof(MeshVertex);
-    const size_t indexBytes = indices.size() * sizeof(uint32_t);
+    return Initialize(renderer,
+        vertices.data(), vertices.size(),
+        indices.data(), indices.size(),
+        localBounds, VertexFormat::Full, lods);
+}
+
+bool Mesh::Initialize(Renderer* renderer,
+    const MeshVertex* vertices, size_t vertexCount,
+    const uint32_t* indices, size_t indexCount_,
+    const BoundingSphere& localBounds,
+    VertexFormat format,
+    const std::vector<MeshLod>& lods_) {
+    if (!vertices || !indices || vertexCount == 0 || indexCount_ == 0) return false;
+
+    // 0) LOD 구간 (범위를 벗어난 LOD 는 버림)
+    lods.clear();
+    for (const MeshLod& lod : lods_) {
+        if (lod.indexCount > 0 && size_t(lod.indexStart) + lod.indexCount <= indexCount_)
+            lods.push_back(lod);
+    }
+    if (lods.empty())
+        lods.push_back({ 0, static_cast<uint32_t>(indexCount_), 0.0f });
+
+    indexCount = lods[0].indexCount;
+    meshlets = {};
+    submeshes.clear();
+    bounds = localBounds;
+    vertexFormat = format;
+    positionQuantization = {};
+
+    // 1) 정점: Full 은 그대로, Compact 는 AABB 기준 양자화 + octahedral 노멀/탄젠트
+    const void* vertexData = vertices;
+    size_t vertexBytes = vertexCount * sizeof(MeshVertex);
+    UINT vertexStride = sizeof(MeshVertex);
+
+    std::vector<CompactMeshVertex> compactVertices;
+    if (format == VertexFormat::Compact) {
+        BoundingBox box;
+        BoundingBox::CreateFromPoints(box, vertexCount, &vertices[0].position, sizeof(MeshVertex));
+
+        const XMFLOAT3 boxMin = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z };
+        const XMFLOAT3 boxMax = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z };
+        positionQuantization = VertexCompression::ComputePositionQuantization(boxMin, boxMax);
+
+        compactVertices.resize(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            const MeshVertex& v = vertices[i];
+            compactVertices[i] = VertexCompression::EncodeVertex(
+                v.position, v.normal, v.texCoord, v.tangent, positionQuantization);
+        }
+
+        vertexData = compactVertices.data();
+        vertexBytes = vertexCount * sizeof(CompactMeshVertex);
+        vertexStride = sizeof(CompactMeshVertex);
+    }
+
+    // 2) 인덱스: 16비트로 표현 가능하면 인덱스 버퍼 크기 / 대역폭 절반
+    const void* indexData = indices;
+    size_t indexBytes = indexCount_ * sizeof(uint32_t);
+    indexFormat = DXGI_FORMAT_R32_UINT;
+
+    std::vector<uint16_t> narrowIndices;
+    if (vertexCount <= 0xFFFF) {
+        narrowIndices.assign(indices, indices + indexCount_);
+        indexData = narrowIndices.data();
+        indexBytes = narrowIndices.size() * sizeof(uint16_t);
+        indexFormat = DXGI_FORMAT_R16_UINT;
+    }
 
 
     return UploadBuffers(renderer,
-        vertices.data(), vertexBytes,
-        indices.data(), indexBytes);
+        vertexData, vertexBytes, vertexStride,
+        indexData, indexBytes);
+}
+
+bool Mesh::SetMeshlets(Meshlets::MeshletData data)
+{
+    // 클러스터 컬링은 LOD0 구간 [0, indexCount) 안에서만 드로우 범위를 만든다
+    const MeshLod lod0 = lods.empty() ? MeshLod{ 0, indexCount, 0.0f } : lods[0];
+    for (const Meshlets::Meshlet& meshlet : data.meshlets) {
+        const uint64_t indexEnd = (uint64_t(meshlet.firstTriangle) + meshlet.triangleCount) * 3;
+        if (lod0.indexStart != 0 || indexEnd > lod0.indexCount
+            || uint64_t(meshlet.vertexOffset) + meshlet.vertexCount > data.vertices.size()
+            || indexEnd > data.triangles.size()) {
+            meshlets = {};
+            return false;
+        }
+    }
+
+    meshlets = std::move(data);
+    return true;
 }
 
+bool Mesh::SetSubmeshes(std::vector<MeshCache::SubmeshRecord> records)
+{
+    const MeshLod lod0 = lods.empty() ? MeshLod{ 0, indexCount, 0.0f } : lods[0];
+    for (const MeshCache::SubmeshRecord& submesh : records) {
+        if (submesh.indexStart < lod0.indexStart
+            || uint64_t(submesh.indexStart) + submesh.indexCount > uint64_t(lod0.indexStart) + lod0.indexCount) {
+            submeshes.clear();
+            return false;
+        }
+    }
 
+    submeshes = std::move(records);
+    return true;
+}
 
 bool Mesh::UploadBuffers(Renderer* renderer,
-    const void* vertexData, size_t vertexByteSize,
+    const void* vertexData, size_t vertexByteSize, UINT vertexStride,
     const void* indexData, size_t indexByteSize)
 {
     // 1) DEFAULT-heap 버퍼 생성 (COMMON)
@@ -251,11 +350,11 @@ bool Mesh::UploadBuffers(Renderer* renderer,
     // 6) VB/IB 뷰 설정
     vertexView.BufferLocation = vertexBuffer->GetGPUVirtualAddress();
     vertexView.SizeInBytes = UINT(vertexByteSize);
-    vertexView.StrideInBytes = sizeof(MeshVertex);
+    vertexView.StrideInBytes = vertexStride;
 
     indexView.BufferLocation = indexBuffer->GetGPUVirtualAddress();
     indexView.SizeInBytes = UINT(indexByteSize);
-    indexView.Format = DXGI_FORMAT_R32_UINT;
+    indexView.Format = indexFormat;
 
     return true;
 }
@@ -281,6 +380,17 @@ std::shared_ptr<Mesh> Mesh::CreateSphere(Renderer* renderer, uint32_t latitudeSe
     std::vector<uint32_t>   indices;
     BuildSphere(latitudeSegments, longitudeSegments, vertices, indices);
 
+    // LOD0 를 메시릿 순서로 바꾼 뒤 (클러스터 컬링) 멀리 있는 구용 LOD 체인 생성
+    Meshlets::MeshletData meshlets;
+    Meshlets::Build(vertices, indices, 0, indices.size(), meshlets);
+
+    std::vector<MeshLod> lods;
+    MeshSimplifier::BuildLodChain(vertices, indices, lods);
+
     auto mesh = std::make_shared<Mesh>();
-    return mesh->Initialize(renderer, vertices, indices) ? mesh : nullptr;
+    if (!mesh->Initialize(renderer, vertices, indices, lods))
+        return nullptr;
+
+    mesh->SetMeshlets(std::move(meshlets));
+    return mesh;
 }
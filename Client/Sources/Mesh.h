@@ -3,20 +3,25 @@
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <DirectXMath.h>
+#include <DirectXCollision.h>
 #include <vector>
 #include <memory>
 #include <stdexcept>
+#include "VertexCompression.h"
+#include "MeshSimplifier.h"
+#include "Meshlets.h"
+#include "MeshCache.h"
+#include "MeshVertex.h"
 
 class Renderer;
 
 using Microsoft::WRL::ComPtr;
 using namespace DirectX;
 
-struct MeshVertex {
-    XMFLOAT3 position;
-    XMFLOAT3 normal;
-    XMFLOAT2 texCoord;
-    XMFLOAT3 tangent;
+// GPU 정점 버퍼 레이아웃 (CPU 쪽 데이터는 항상 MeshVertex)
+enum class VertexFormat : uint8_t {
+    Full = 0,       // MeshVertex (44 바이트)
+    Compact,        // CompactMeshVertex (20 바이트), *CompactPSO 로 그려야 함
 };
 
 
@@ -31,14 +36,49 @@ public:
      */
     bool Initialize(Renderer* renderer,
         const std::vector<MeshVertex>& vertices,
-        const std::vector<uint32_t>& indices);
+        const std::vector<uint32_t>& indices,
+        const std::vector<MeshLod>& lods = {});
+
+    // 메모리 매핑된 캐시 등에서 바로 업로드 (바운딩 구는 미리 계산된 값 사용)
+    // Compact 면 업로드 직전에 CompactMeshVertex 로 인코딩
+    // lods 가 비어 있으면 인덱스 전체가 LOD0, 있으면 indices 는 모든 LOD 를 이어 붙인 버퍼
+    bool Initialize(Renderer* renderer,
+        const MeshVertex* vertices, size_t vertexCount,
+        const uint32_t* indices, size_t indexCount,
+        const BoundingSphere& localBounds,
+        VertexFormat format = VertexFormat::Full,
+        const std::vector<MeshLod>& lods = {});
 
     // GPU views
     const D3D12_VERTEX_BUFFER_VIEW& GetVertexBufferView() const { return vertexView; }
     const D3D12_INDEX_BUFFER_VIEW& GetIndexBufferView()  const { return indexView; }
     ID3D12Resource* GetVertexBuffer() const { return vertexBuffer.Get(); }
     ID3D12Resource* GetIndexBuffer()  const { return indexBuffer.Get(); }
-    uint32_t GetIndexCount() const { return indexCount; }
+    uint32_t GetIndexCount() const { return indexCount; }     // LOD0
+
+    // LOD 체인 (최소 1개, 뒤로 갈수록 거침)
+    uint32_t GetLodCount() const { return uint32_t(lods.size()); }
+    const MeshLod& GetLod(uint32_t lod) const { return lods[lod < lods.size() ? lod : lods.size() - 1]; }
+
+    // LOD0 메시릿 (Initialize 후 설정, 인덱스 버퍼의 LOD0 구간이 메시릿 순서여야 함)
+    // LOD0 범위를 벗어나는 데이터면 버리고 false
+    bool SetMeshlets(Meshlets::MeshletData data);
+    const Meshlets::MeshletData& GetMeshlets() const { return meshlets; }
+    bool HasMeshlets() const { return !meshlets.Empty(); }
+
+    // 서브메시 테이블 (Initialize 후 설정, 비어 있으면 메시 전체가 서브메시 하나)
+    // LOD0 범위를 벗어나는 구간이 있으면 버리고 false
+    bool SetSubmeshes(std::vector<MeshCache::SubmeshRecord> records);
+    const std::vector<MeshCache::SubmeshRecord>& GetSubmeshes() const { return submeshes; }
+
+    VertexFormat GetVertexFormat() const { return vertexFormat; }
+    bool IsCompact() const { return vertexFormat == VertexFormat::Compact; }
+
+    // Compact 위치 디코드 값 (CB_MVP / CB_ShadowMapPass 로 전달, Full 이면 scale 1 / bias 0)
+    const VertexCompression::PositionQuantization& GetPositionQuantization() const { return positionQuantization; }
+
+    // 로컬 공간 바운딩 구 (섀도우 캐스터 컬링용)
+    const BoundingSphere& GetBounds() const { return bounds; }
 
     static std::shared_ptr<Mesh> CreateCube(Renderer* renderer);
     static std::shared_ptr<Mesh> CreateQuad(Renderer* renderer);
@@ -46,7 +86,7 @@ public:
 
 private:
     bool UploadBuffers(Renderer* renderer,
-        const void* vertexData, size_t vertexByteSize,
+        const void* vertexData, size_t vertexByteSize, UINT vertexStride,
         const void* indexData, size_t indexByteSize);
 
     ComPtr<ID3D12Resource> vertexBuffer; // DEFAULT
@@ -55,4 +95,13 @@ private:
     D3D12_VERTEX_BUFFER_VIEW vertexView{};
     D3D12_INDEX_BUFFER_VIEW  indexView{};
     uint32_t indexCount = 0;
+    DXGI_FORMAT indexFormat = DXGI_FORMAT_R32_UINT;   // 정점 65535 개 이하면 R16_UINT
+    std::vector<MeshLod> lods;
+    Meshlets::MeshletData meshlets;
+    std::vector<MeshCache::SubmeshRecord> submeshes;
+
+    VertexFormat vertexFormat = VertexFormat::Full;
+    VertexCompression::PositionQuantization positionQuantization;
+
+    BoundingSphere bounds;
 };
\ No newline at end of file
@@ -0,0 +1,232 @@
+#include "MeshCache.h"
+#include "Mesh.h"
+#include "HashUtil.h"
+#include <Windows.h>
+#include <fstream>
+
+namespace
+{
+    constexpr uint64_t AlignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    struct Layout
+    {
+        uint64_t vertexOffset;
+        uint64_t indexOffset;
+        uint64_t meshletOffset;
+        uint64_t meshletVertexOffset;
+        uint64_t meshletTriangleOffset;
+        uint64_t totalSize;
+    };
+
+    Layout ComputeLayout(uint64_t vertexCount, uint64_t indexCount, uint64_t submeshCount, uint64_t lodCount,
+        uint64_t meshletCount, uint64_t meshletVertexCount, uint64_t meshletTriangleByteCount)
+    {
+        Layout layout{};
+        layout.vertexOffset = AlignUp(sizeof(MeshCache::FileHeader)
+            + submeshCount * sizeof(MeshCache::SubmeshRecord)
+            + lodCount * sizeof(MeshLod), 16);
+        layout.indexOffset = AlignUp(layout.vertexOffset + vertexCount * sizeof(MeshVertex), 16);
+        layout.meshletOffset = AlignUp(layout.indexOffset + indexCount * sizeof(uint32_t), 16);
+        layout.meshletVertexOffset = AlignUp(layout.meshletOffset + meshletCount * sizeof(Meshlets::Meshlet), 16);
+        layout.meshletTriangleOffset = AlignUp(layout.meshletVertexOffset + meshletVertexCount * sizeof(uint32_t), 16);
+        layout.totalSize = layout.meshletTriangleOffset + meshletTriangleByteCount;
+        return layout;
+    }
+}
+
+namespace MeshCache
+{
+    std::filesystem::path GetCachePath(const std::string& sourcePath)
+    {
+        const std::filesystem::path source(sourcePath);
+
+        Hasher hasher;
+        hasher.AddString(source.lexically_normal().generic_wstring());
+
+        return std::filesystem::path(L"Cache/Meshes") /
+            (source.stem().wstring() + L"_" + HashToHex(hasher.Value()) + L".mesh");
+    }
+
+    uint64_t HashSource(const std::filesystem::path& sourcePath, uint32_t importFlags, uint32_t processingOptions)
+    {
+        std::ifstream stream(sourcePath, std::ios::binary);
+        if (!stream)
+            return 0;
+
+        Hasher hasher;
+        std::vector<char> chunk(1 << 16);
+        while (stream) {
+            stream.read(chunk.data(), chunk.size());
+            hasher.Add(chunk.data(), static_cast<size_t>(stream.gcount()));
+        }
+        hasher.AddValue(importFlags);
+        hasher.AddValue(processingOptions);
+        hasher.AddValue(Version);
+        return hasher.Value();
+    }
+
+    bool Write(
+        const std::filesystem::path& cachePath,
+        uint64_t sourceHash,
+        const std::vector<MeshVertex>& vertices,
+        const std::vector<uint32_t>& indices,
+        const std::vector<SubmeshRecord>& submeshes,
+        const std::vector<MeshLod>& lods,
+        const Meshlets::MeshletData& meshlets,
+        const DirectX::BoundingSphere& bounds)
+    {
+        const Layout layout = ComputeLayout(vertices.size(), indices.size(), submeshes.size(), lods.size(),
+            meshlets.meshlets.size(), meshlets.vertices.size(), meshlets.triangles.size());
+
+        FileHeader header{};
+        header.magic = Magic;
+        header.version = Version;
+        header.sourceHash = sourceHash;
+        header.vertexStride = sizeof(MeshVertex);
+        header.vertexCount = static_cast<uint32_t>(vertices.size());
+        header.indexCount = static_cast<uint32_t>(indices.size());
+        header.submeshCount = static_cast<uint32_t>(submeshes.size());
+        header.lodCount = static_cast<uint32_t>(lods.size());
+        header.vertexOffset = layout.vertexOffset;
+        header.indexOffset = layout.indexOffset;
+        header.boundsCenter[0] = bounds.Center.x;
+        header.boundsCenter[1] = bounds.Center.y;
+        header.boundsCenter[2] = bounds.Center.z;
+        header.boundsRadius = bounds.Radius;
+        header.meshletCount = static_cast<uint32_t>(meshlets.meshlets.size());
+        header.meshletVertexCount = static_cast<uint32_t>(meshlets.vertices.size());
+        header.meshletTriangleByteCount = static_cast<uint32_t>(meshlets.triangles.size());
+        header.meshletOffset = layout.meshletOffset;
+        header.meshletVertexOffset = layout.meshletVertexOffset;
+        header.meshletTriangleOffset = layout.meshletTriangleOffset;
+
+        // 한 번에 조립해서 쓰기 (패딩 0 채움)
+        std::vector<uint8_t> blob(static_cast<size_t>(layout.totalSize), 0);
+        memcpy(blob.data(), &header, sizeof(header));
+        if (!submeshes.empty())
+            memcpy(blob.data() + sizeof(header), submeshes.data(), submeshes.size() * sizeof(SubmeshRecord));
+        if (!lods.empty())
+            memcpy(blob.data() + sizeof(header) + submeshes.size() * sizeof(SubmeshRecord), lods.data(), lods.size() * sizeof(MeshLod));
+        if (!vertices.empty())
+            memcpy(blob.data() + layout.vertexOffset, vertices.data(), vertices.size() * sizeof(MeshVertex));
+        if (!indices.empty())
+            memcpy(blob.data() + layout.indexOffset, indices.data(), indices.size() * sizeof(uint32_t));
+        if (!meshlets.meshlets.empty()) {
+            memcpy(blob.data() + layout.meshletOffset, meshlets.meshlets.data(), meshlets.meshlets.size() * sizeof(Meshlets::Meshlet));
+            memcpy(blob.data() + layout.meshletVertexOffset, meshlets.vertices.data(), meshlets.vertices.size() * sizeof(uint32_t));
+            memcpy(blob.data() + layout.meshletTriangleOffset, meshlets.triangles.data(), meshlets.triangles.size());
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(cachePath.parent_path(), ec);
+
+        // 중간에 실패해도 깨진 캐시가 남지 않도록 임시 파일에 쓴 뒤 교체
+        std::filesystem::path tempPath = cachePath;
+        tempPath += L".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+                return false;
+            file.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+            if (!file)
+                return false;
+        }
+
+        std::filesystem::rename(tempPath, cachePath, ec);
+        return !ec;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    void MappedFile::Close()
+    {
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file) CloseHandle(file);
+        data = nullptr;
+        mapping = nullptr;
+        file = nullptr;
+        size = 0;
+    }
+
+    bool MappedFile::Open(const std::filesystem::path& cachePath, const uint64_t* expectedSourceHash)
+    {
+        Close();
+
+        // 1) 파일 매핑
+        HANDLE handle = CreateFileW(cachePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (handle == INVALID_HANDLE_VALUE)
+            return false;
+        file = handle;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < LONGLONG(sizeof(FileHeader))) {
+            Close();
+            return false;
+        }
+        size = static_cast<uint64_t>(fileSize.QuadPart);
+
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+            data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!data) {
+            Close();
+            return false;
+        }
+
+        // 2) 헤더 / 레이아웃 검증
+        const FileHeader& header = GetHeader();
+        bool valid = header.magic == Magic
+            && header.version == Version
+            && header.vertexStride == sizeof(MeshVertex)
+            && header.vertexCount > 0
+            && header.indexCount > 0;
+
+        if (valid) {
+            const Layout layout = ComputeLayout(header.vertexCount, header.indexCount, header.submeshCount, header.lodCount,
+                header.meshletCount, header.meshletVertexCount, header.meshletTriangleByteCount);
+            valid = header.vertexOffset == layout.vertexOffset
+                && header.indexOffset == layout.indexOffset
+                && header.meshletOffset == layout.meshletOffset
+                && header.meshletVertexOffset == layout.meshletVertexOffset
+                && header.meshletTriangleOffset == layout.meshletTriangleOffset
+                && layout.totalSize <= size;
+        }
+
+        // 3) 소스가 바뀌었으면 stale
+        if (valid && expectedSourceHash)
+            valid = header.sourceHash == *expectedSourceHash;
+
+        if (!valid) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    DirectX::BoundingSphere MappedFile::GetBounds() const
+    {
+        const FileHeader& header = GetHeader();
+        return DirectX::BoundingSphere(
+            DirectX::XMFLOAT3(header.boundsCenter[0], header.boundsCenter[1], header.boundsCenter[2]),
+            header.boundsRadius);
+    }
+
+    Meshlets::MeshletData MappedFile::ReadMeshlets() const
+    {
+        const FileHeader& header = GetHeader();
+
+        Meshlets::MeshletData meshlets;
+        meshlets.meshlets.assign(GetMeshlets(), GetMeshlets() + header.meshletCount);
+        meshlets.vertices.assign(GetMeshletVertices(), GetMeshletVertices() + header.meshletVertexCount);
+        meshlets.triangles.assign(GetMeshletTriangles(), GetMeshletTriangles() + header.meshletTriangleByteCount);
+        return meshlets;
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <DirectXCollision.h>
+#include "MeshSimplifier.h"
+#include "Meshlets.h"
+
+struct MeshVertex;
+
+// ---------------------------------------------------------------------------
+// 바이너리 메시 캐시 (.mesh) 포맷
+// ModelLoader 가 Assimp 로 처음 임포트할 때 쓰고, 이후 실행부터는 memory-map 으로 읽어
+// 그대로 업로드 버퍼에 복사한다 (Assimp 는 캐시 미스일 때만 사용)
+//
+//   FileHeader
+//   SubmeshRecord[submeshCount]
+//   MeshLod[lodCount]          (인덱스 영역 안의 LOD 구간, [0] = 원본)
+//   vertex 영역 (MeshVertex[vertexCount], 16바이트 정렬)
+//   index 영역  (uint32_t[indexCount], 16바이트 정렬)
+//   meshlet 영역 (Meshlet[meshletCount] / uint32_t[meshletVertexCount] / uint8_t[meshletTriangleByteCount], 각각 16바이트 정렬)
+// ---------------------------------------------------------------------------
+namespace MeshCache
+{
+    static constexpr uint32_t Magic = 0x4853454D;    // 'MESH'
+    static constexpr uint32_t Version = 5;           // 임포트 처리나 레이아웃이 바뀌면 올릴 것
+
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceHash;        // 소스 파일 내용 + 임포트 플래그
+        uint32_t vertexStride;      // sizeof(MeshVertex), 다르면 stale
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t submeshCount;
+        uint32_t lodCount;
+        uint32_t reserved;
+        uint64_t vertexOffset;      // 파일 시작 기준
+        uint64_t indexOffset;
+        float    boundsCenter[3];   // 로컬 공간 바운딩 구
+        float    boundsRadius;
+        uint32_t meshletCount;              // 0 이면 메시릿 없음
+        uint32_t meshletVertexCount;
+        uint32_t meshletTriangleByteCount;  // 삼각형 수 * 3
+        uint32_t reserved2;
+        uint64_t meshletOffset;
+        uint64_t meshletVertexOffset;
+        uint64_t meshletTriangleOffset;
+    };
+
+    // aiMesh 하나 = 서브메시 하나. 모든 서브메시가 한 VB/IB 를 공유하고
+    // 인덱스는 메시 전체 기준 값이라 [indexStart, indexStart + indexCount) 만 따로 그릴 수도 있다
+    struct SubmeshRecord
+    {
+        uint32_t indexStart;        // LOD0 구간
+        uint32_t indexCount;
+        uint32_t baseVertex;        // 서브메시가 쓰는 정점 구간 [baseVertex, baseVertex + vertexCount)
+        uint32_t vertexCount;
+        uint32_t materialIndex;     // aiMesh::mMaterialIndex
+        float    boundsMin[3];      // 메시 로컬 공간 AABB
+        float    boundsMax[3];
+
+        DirectX::BoundingBox GetBounds() const
+        {
+            DirectX::BoundingBox box;
+            DirectX::BoundingBox::CreateFromPoints(box,
+                DirectX::XMVectorSet(boundsMin[0], boundsMin[1], boundsMin[2], 0.0f),
+                DirectX::XMVectorSet(boundsMax[0], boundsMax[1], boundsMax[2], 0.0f));
+            return box;
+        }
+    };
+    static_assert(sizeof(SubmeshRecord) == 44, "SubmeshRecord is stored as-is in the mesh cache");
+
+    // Cache/Meshes/<파일 이름>_<경로 해시>.mesh
+    std::filesystem::path GetCachePath(const std::string& sourcePath);
+
+    // 소스 파일 내용 해시 (없으면 0)
+    // processingOptions: 임포트 플래그 외에 결과를 바꾸는 로더 설정 (탄젠트 생성 방식 등)
+    uint64_t HashSource(const std::filesystem::path& sourcePath, uint32_t importFlags, uint32_t processingOptions = 0);
+
+    bool Write(
+        const std::filesystem::path& cachePath,
+        uint64_t sourceHash,
+        const std::vector<MeshVertex>& vertices,
+        const std::vector<uint32_t>& indices,
+        const std::vector<SubmeshRecord>& submeshes,
+        const std::vector<MeshLod>& lods,
+        const Meshlets::MeshletData& meshlets,
+        const DirectX::BoundingSphere& bounds);
+
+    // 읽기 전용 memory-map (소멸 시 Unmap)
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // expectedSourceHash 가 nullptr 이면 (배포 빌드처럼 소스가 없을 때) 해시 검사 생략
+        bool Open(const std::filesystem::path& cachePath, const uint64_t* expectedSourceHash);
+
+        const FileHeader& GetHeader() const { return *reinterpret_cast<const FileHeader*>(data); }
+        const SubmeshRecord* GetSubmeshes() const { return reinterpret_cast<const SubmeshRecord*>(data + sizeof(FileHeader)); }
+        const MeshLod* GetLods() const { return reinterpret_cast<const MeshLod*>(GetSubmeshes() + GetHeader().submeshCount); }
+        const MeshVertex* GetVertices() const { return reinterpret_cast<const MeshVertex*>(data + GetHeader().vertexOffset); }
+        const uint32_t* GetIndices() const { return reinterpret_cast<const uint32_t*>(data + GetHeader().indexOffset); }
+        const Meshlets::Meshlet* GetMeshlets() const { return reinterpret_cast<const Meshlets::Meshlet*>(data + GetHeader().meshletOffset); }
+        const uint32_t* GetMeshletVertices() const { return reinterpret_cast<const uint32_t*>(data + GetHeader().meshletVertexOffset); }
+        const uint8_t* GetMeshletTriangles() const { return data + GetHeader().meshletTriangleOffset; }
+        Meshlets::MeshletData ReadMeshlets() const;     // Mesh 가 CPU 컬링용으로 보관할 복사본
+        DirectX::BoundingSphere GetBounds() const;
+
+    private:
+        void Close();
+
+        void* file = nullptr;       // HANDLE (INVALID_HANDLE_VALUE 는 nullptr 로 정규화)
+        void* mapping = nullptr;    // HANDLE
+        const uint8_t* data = nullptr;
+        uint64_t size = 0;
+    };
+}
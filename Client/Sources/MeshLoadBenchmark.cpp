@@ -0,0 +1,158 @@
+#include "MeshLoadBenchmark.h"
+#include "ModelLoader.h"
+#include "MeshCache.h"
+#include "DebugManager.h"
+
+#include <Windows.h>
+#include <shellapi.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    constexpr const wchar_t* BenchmarkFlag = L"--bench-mesh-cache";
+    constexpr uint32_t DefaultIterations = 5;
+
+    double Median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        const size_t middle = values.size() / 2;
+        return (values.size() % 2 != 0) ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+    }
+
+    // 한 번 로드에 걸린 시간 (ms), 실패하면 음수
+    double TimeLoad(ModelLoader& loader, const std::string& modelPath, ModelLoader::MeshData& outData)
+    {
+        outData = {};
+        const auto startTime = std::chrono::steady_clock::now();
+        // AssetLoader 의 로더 스레드와 같은 조건 (탄젠트 생성 풀 없음)
+        if (!loader.LoadMeshData(modelPath, nullptr, outData))
+            return -1.0;
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    void AppendCsv(const std::string& modelPath, const MeshLoadBenchmark::Result& result)
+    {
+        const std::filesystem::path csvPath = L"Cache/Benchmarks/MeshCache.csv";
+        std::error_code ec;
+        std::filesystem::create_directories(csvPath.parent_path(), ec);
+
+        const bool writeHeader = !std::filesystem::exists(csvPath, ec);
+        std::ofstream csv(csvPath, std::ios::app);
+        if (!csv)
+            return;
+
+        if (writeHeader)
+            csv << "model,iterations,vertices,indices,import_min_ms,import_median_ms,cache_min_ms,cache_median_ms,speedup\n";
+
+        csv << std::format("{},{},{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.1f}\n",
+            modelPath, result.iterations, result.vertexCount, result.indexCount,
+            result.importMinMs, result.importMedianMs, result.cacheMinMs, result.cacheMedianMs,
+            result.importMedianMs / std::max(result.cacheMedianMs, 1e-6));
+    }
+}
+
+namespace MeshLoadBenchmark
+{
+    bool Run(const std::string& modelPath, uint32_t iterations, Result& outResult)
+    {
+        auto& debug = DebugManager::GetInstance();
+        const std::filesystem::path cachePath = MeshCache::GetCachePath(modelPath);
+
+        outResult = {};
+        outResult.iterations = std::max(iterations, 1u);
+
+        ModelLoader loader;
+        ModelLoader::MeshData data;
+        std::vector<double> importTimes;
+        std::vector<double> cacheTimes;
+
+        // 1) 캐시 미스: 매번 캐시 파일을 지우고 Assimp 임포트 (마지막 회차가 캐시를 남김)
+        for (uint32_t i = 0; i < outResult.iterations; ++i)
+        {
+            std::error_code ec;
+            std::filesystem::remove(cachePath, ec);
+
+            const double ms = TimeLoad(loader, modelPath, data);
+            if (ms < 0.0)
+            {
+                debug.LogMessage(std::format(L"[Bench] failed to import {}", std::filesystem::path(modelPath).wstring()));
+                return false;
+            }
+            importTimes.push_back(ms);
+        }
+
+        outResult.vertexCount = data.vertices.size();
+        outResult.indexCount = data.indices.size();
+
+        if (!std::filesystem::exists(cachePath))
+        {
+            debug.LogMessage(std::format(L"[Bench] import did not write {}", cachePath.wstring()));
+            return false;
+        }
+
+        // 2) 캐시 히트: 같은 결과가 나오는지도 확인
+        for (uint32_t i = 0; i < outResult.iterations; ++i)
+        {
+            const double ms = TimeLoad(loader, modelPath, data);
+            if (ms < 0.0 || data.vertices.size() != outResult.vertexCount || data.indices.size() != outResult.indexCount)
+            {
+                debug.LogMessage(std::format(L"[Bench] cache read mismatch for {}", cachePath.wstring()));
+                return false;
+            }
+            cacheTimes.push_back(ms);
+        }
+
+        outResult.importMinMs = *std::min_element(importTimes.begin(), importTimes.end());
+        outResult.importMedianMs = Median(importTimes);
+        outResult.cacheMinMs = *std::min_element(cacheTimes.begin(), cacheTimes.end());
+        outResult.cacheMedianMs = Median(cacheTimes);
+
+        debug.LogMessage(std::format(
+            L"[Bench] {} ({} verts, {} indices, x{}): Assimp import min {:.2f} / median {:.2f} ms, cache min {:.2f} / median {:.2f} ms ({:.1f}x)",
+            std::filesystem::path(modelPath).wstring(), outResult.vertexCount, outResult.indexCount, outResult.iterations,
+            outResult.importMinMs, outResult.importMedianMs, outResult.cacheMinMs, outResult.cacheMedianMs,
+            outResult.importMedianMs / std::max(outResult.cacheMedianMs, 1e-6)));
+
+        AppendCsv(modelPath, outResult);
+        return true;
+    }
+
+    bool RunFromCommandLine(int& outExitCode)
+    {
+        int argc = 0;
+        LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+        if (!argv)
+            return false;
+
+        // --bench-mesh-cache <모델 경로> [반복 횟수]
+        bool found = false;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (wcscmp(argv[i], BenchmarkFlag) != 0)
+                continue;
+
+            found = true;
+            outExitCode = 1;
+            if (i + 1 >= argc)
+            {
+                DebugManager::GetInstance().LogMessage(L"[Bench] usage: --bench-mesh-cache <model path> [iterations]");
+                break;
+            }
+
+            const std::string modelPath = std::filesystem::path(argv[i + 1]).string();
+            const uint32_t iterations = (i + 2 < argc) ? static_cast<uint32_t>(_wtoi(argv[i + 2])) : DefaultIterations;
+
+            Result result;
+            outExitCode = Run(modelPath, iterations, result) ? 0 : 1;
+            break;
+        }
+
+        LocalFree(argv);
+        return found;
+    }
+}
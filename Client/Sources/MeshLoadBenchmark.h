@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// ---------------------------------------------------------------------------
+// 메시 로드 벤치마크: 같은 모델을 Assimp 임포트(캐시 미스)와 .mesh 캐시 히트로 N 번씩 로드해 비교
+//   Client.exe --bench-mesh-cache <모델 경로> [반복 횟수 (기본 5)]
+// 창/디바이스 없이 CPU 단계(ModelLoader::LoadMeshData)만 재고 종료한다
+// 결과는 로그와 Cache/Benchmarks/MeshCache.csv 에 한 줄씩 추가 (같은 조건으로 반복 실행해 비교)
+// ---------------------------------------------------------------------------
+namespace MeshLoadBenchmark
+{
+    struct Result
+    {
+        uint32_t iterations = 0;
+        size_t   vertexCount = 0;
+        size_t   indexCount = 0;
+        double   importMinMs = 0.0;     // 캐시 삭제 후 Assimp 임포트 + 캐시 기록
+        double   importMedianMs = 0.0;
+        double   cacheMinMs = 0.0;      // memory-map 캐시 읽기
+        double   cacheMedianMs = 0.0;
+    };
+
+    bool Run(const std::string& modelPath, uint32_t iterations, Result& outResult);
+
+    // 명령줄에 --bench-mesh-cache 가 있으면 실행하고 true (outExitCode: 0 = 성공)
+    bool RunFromCommandLine(int& outExitCode);
+}
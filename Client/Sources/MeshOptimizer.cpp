@@ -0,0 +1,363 @@
+#include "MeshOptimizer.h"
+#include "Mesh.h"
+#include "HashUtil.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+namespace
+{
+    // Forsyth, "Linear-Speed Vertex Cache Optimisation" 기본 파라미터
+    constexpr uint32_t kForsythCacheSize = 32;
+    constexpr uint32_t kMaxValence = 32;
+    constexpr float kCacheDecayPower = 1.5f;
+    constexpr float kLastTriScore = 0.75f;
+    constexpr float kValenceBoostScale = 2.0f;
+    constexpr float kValenceBoostPower = 0.5f;
+
+    struct ScoreTables
+    {
+        std::array<float, kForsythCacheSize> cache{};
+        std::array<float, kMaxValence + 1> valence{};
+
+        ScoreTables()
+        {
+            for (uint32_t i = 0; i < kForsythCacheSize; ++i) {
+                if (i < 3) {
+                    cache[i] = kLastTriScore;
+                }
+                else {
+                    const float scaler = 1.0f / float(kForsythCacheSize - 3);
+                    cache[i] = std::pow(1.0f - float(i - 3) * scaler, kCacheDecayPower);
+                }
+            }
+            valence[0] = 0.0f;
+            for (uint32_t i = 1; i <= kMaxValence; ++i)
+                valence[i] = kValenceBoostScale * std::pow(float(i), -kValenceBoostPower);
+        }
+    };
+
+    float VertexScore(const ScoreTables& tables, int cachePosition, uint32_t remaining)
+    {
+        if (remaining == 0)
+            return -1.0f;   // 더 이상 쓰이지 않는 정점
+
+        float score = cachePosition >= 0 ? tables.cache[cachePosition] : 0.0f;
+        return score + tables.valence[std::min(remaining, kMaxValence)];
+    }
+
+    struct VertexHash
+    {
+        const std::vector<MeshVertex>* vertices;
+        size_t operator()(uint32_t index) const
+        {
+            Hasher hasher;
+            hasher.Add(&(*vertices)[index], sizeof(MeshVertex));
+            return static_cast<size_t>(hasher.Value());
+        }
+    };
+
+    struct VertexEqual
+    {
+        const std::vector<MeshVertex>* vertices;
+        bool operator()(uint32_t a, uint32_t b) const
+        {
+            return memcmp(&(*vertices)[a], &(*vertices)[b], sizeof(MeshVertex)) == 0;
+        }
+    };
+}
+
+namespace MeshOptimizer
+{
+    CacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+    {
+        CacheStats stats;
+        if (indices.size() < 3 || vertexCount == 0)
+            return stats;
+
+        // FIFO: 미스 때만 타임스탬프 갱신
+        std::vector<uint32_t> timestamps(vertexCount, 0);
+        std::vector<uint8_t> referenced(vertexCount, 0);
+        uint32_t timestamp = cacheSize + 1;
+        uint32_t misses = 0;
+        uint32_t uniqueVertices = 0;
+
+        for (uint32_t index : indices) {
+            if (timestamp - timestamps[index] > cacheSize) {
+                timestamps[index] = timestamp++;
+                ++misses;
+            }
+            if (!referenced[index]) {
+                referenced[index] = 1;
+                ++uniqueVertices;
+            }
+        }
+
+        stats.acmr = float(misses) / float(indices.size() / 3);
+        stats.atvr = float(misses) / float(uniqueVertices);
+        return stats;
+    }
+
+    void WeldVertices(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices)
+    {
+        if (vertices.empty())
+            return;
+
+        std::unordered_map<uint32_t, uint32_t, VertexHash, VertexEqual> unique(
+            vertices.size(), VertexHash{ &vertices }, VertexEqual{ &vertices });
+
+        // remap[old] = 병합된 첫 정점 (아직 압축 전 인덱스)
+        std::vector<uint32_t> remap(vertices.size());
+        std::vector<MeshVertex> welded;
+        welded.reserve(vertices.size());
+
+        for (uint32_t i = 0; i < vertices.size(); ++i) {
+            auto [it, inserted] = unique.try_emplace(i, static_cast<uint32_t>(welded.size()));
+            if (inserted)
+                welded.push_back(vertices[i]);
+            remap[i] = it->second;
+        }
+
+        for (uint32_t& index : indices)
+            index = remap[index];
+
+        vertices = std::move(welded);
+    }
+
+    void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2 || vertexCount == 0)
+            return;
+
+        static const ScoreTables tables;
+
+        // 1) 정점 → 삼각형 인접 목록 (CSR)
+        std::vector<uint32_t> remaining(vertexCount, 0);
+        for (size_t i = 0; i < triangleCount * 3; ++i)
+            ++remaining[indices[i]];
+
+        std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+        for (size_t v = 0; v < vertexCount; ++v)
+            adjacencyOffset[v + 1] = adjacencyOffset[v] + remaining[v];
+
+        std::vector<uint32_t> adjacency(adjacencyOffset[vertexCount]);
+        {
+            std::vector<uint32_t> cursor(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+            for (uint32_t t = 0; t < triangleCount; ++t)
+                for (uint32_t k = 0; k < 3; ++k)
+                    adjacency[cursor[indices[t * 3 + k]]++] = t;
+        }
+
+        // 2) 초기 점수
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScore(vertexCount);
+        for (size_t v = 0; v < vertexCount; ++v)
+            vertexScore[v] = VertexScore(tables, -1, remaining[v]);
+
+        std::vector<float> triangleScore(triangleCount);
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        int bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (uint32_t t = 0; t < triangleCount; ++t) {
+            triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+            if (triangleScore[t] > bestScore) {
+                bestScore = triangleScore[t];
+                bestTriangle = int(t);
+            }
+        }
+
+        // 3) 가장 점수가 높은 삼각형을 하나씩 출력하며 캐시/점수 갱신
+        std::vector<uint32_t> output;
+        output.reserve(triangleCount * 3);
+
+        std::array<uint32_t, kForsythCacheSize + 3> cache{};
+        std::array<uint32_t, kForsythCacheSize + 3> newCache{};
+        uint32_t cacheCount = 0;
+        uint32_t scanCursor = 0;
+
+        while (output.size() < triangleCount * 3) {
+            if (bestTriangle < 0) {
+                // 캐시 주변에 후보가 없으면 아직 안 나간 다음 삼각형부터 시작
+                while (emitted[scanCursor])
+                    ++scanCursor;
+                bestTriangle = int(scanCursor);
+            }
+
+            const uint32_t t = uint32_t(bestTriangle);
+            const uint32_t tri[3] = { indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2] };
+            output.insert(output.end(), tri, tri + 3);
+            emitted[t] = 1;
+
+            // 인접 목록에서 제거
+            for (uint32_t v : tri) {
+                uint32_t* begin = adjacency.data() + adjacencyOffset[v];
+                uint32_t* end = begin + remaining[v];
+                uint32_t* found = std::find(begin, end, t);
+                if (found != end) {
+                    *found = *(end - 1);
+                    --remaining[v];
+                }
+            }
+
+            // 새 캐시: 방금 쓴 정점이 맨 앞
+            uint32_t newCount = 0;
+            for (uint32_t v : tri) {
+                if (std::find(newCache.begin(), newCache.begin() + newCount, v) == newCache.begin() + newCount)
+                    newCache[newCount++] = v;
+            }
+            for (uint32_t i = 0; i < cacheCount; ++i) {
+                const uint32_t v = cache[i];
+                if (v != tri[0] && v != tri[1] && v != tri[2])
+                    newCache[newCount++] = v;
+            }
+
+            // 캐시 안(과 방금 밀려난) 정점 점수 갱신 → 주변 삼각형 점수 갱신
+            bestTriangle = -1;
+            bestScore = -1.0f;
+            for (uint32_t i = 0; i < newCount; ++i) {
+                const uint32_t v = newCache[i];
+                cachePosition[v] = i < kForsythCacheSize ? int(i) : -1;
+
+                const float score = VertexScore(tables, cachePosition[v], remaining[v]);
+                const float delta = score - vertexScore[v];
+                vertexScore[v] = score;
+
+                const uint32_t* begin = adjacency.data() + adjacencyOffset[v];
+                for (uint32_t a = 0; a < remaining[v]; ++a) {
+                    const uint32_t adjacent = begin[a];
+                    triangleScore[adjacent] += delta;
+                    if (triangleScore[adjacent] > bestScore) {
+                        bestScore = triangleScore[adjacent];
+                        bestTriangle = int(adjacent);
+                    }
+                }
+            }
+
+            cacheCount = std::min(newCount, kForsythCacheSize);
+            std::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+        }
+
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<MeshVertex>& vertices)
+    {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2 || vertices.empty())
+            return;
+
+        // 1) 캐시 순서에서 세 정점이 모두 미스나는 지점(새 strip 시작)마다 클러스터 분할
+        //    → 클러스터 순서를 바꿔도 캐시 효율은 거의 그대로
+        constexpr uint32_t kCacheSize = 16;
+        std::vector<uint32_t> timestamps(vertices.size(), 0);
+        uint32_t timestamp = kCacheSize + 1;
+
+        std::vector<uint32_t> clusterStart;
+        for (uint32_t t = 0; t < triangleCount; ++t) {
+            uint32_t misses = 0;
+            for (uint32_t k = 0; k < 3; ++k) {
+                const uint32_t v = indices[t * 3 + k];
+                if (timestamp - timestamps[v] > kCacheSize) {
+                    timestamps[v] = timestamp++;
+                    ++misses;
+                }
+            }
+            if (t == 0 || misses == 3)
+                clusterStart.push_back(t);
+        }
+        if (clusterStart.size() < 2)
+            return;
+        clusterStart.push_back(static_cast<uint32_t>(triangleCount));
+
+        // 2) 메시 중심 (면적 가중)
+        const size_t clusterCount = clusterStart.size() - 1;
+        std::vector<XMFLOAT3> clusterCentroid(clusterCount);
+        std::vector<XMFLOAT3> clusterNormal(clusterCount);
+        XMVECTOR meshCentroid = XMVectorZero();
+        float meshArea = 0.0f;
+
+        for (size_t c = 0; c < clusterCount; ++c) {
+            XMVECTOR centroid = XMVectorZero();
+            XMVECTOR normal = XMVectorZero();
+            float area = 0.0f;
+
+            for (uint32_t t = clusterStart[c]; t < clusterStart[c + 1]; ++t) {
+                const XMVECTOR p0 = XMLoadFloat3(&vertices[indices[t * 3]].position);
+                const XMVECTOR p1 = XMLoadFloat3(&vertices[indices[t * 3 + 1]].position);
+                const XMVECTOR p2 = XMLoadFloat3(&vertices[indices[t * 3 + 2]].position);
+
+                // CW 전면 기준 바깥쪽 노멀 (길이 = 면적 * 2)
+                const XMVECTOR n = XMVector3Cross(p1 - p0, p2 - p0);
+                const float triArea = 0.5f * XMVectorGetX(XMVector3Length(n));
+
+                centroid += (p0 + p1 + p2) * (triArea / 3.0f);
+                normal += n;
+                area += triArea;
+            }
+
+            meshCentroid += centroid;
+            meshArea += area;
+
+            XMStoreFloat3(&clusterCentroid[c], area > 0.0f ? centroid / area : centroid);
+            XMStoreFloat3(&clusterNormal[c], XMVector3Normalize(normal));
+        }
+        if (meshArea > 0.0f)
+            meshCentroid /= meshArea;
+
+        // 3) 바깥을 많이 향하는 클러스터(다른 면을 가릴 가능성이 큰 것)부터
+        std::vector<float> sortKey(clusterCount);
+        for (size_t c = 0; c < clusterCount; ++c) {
+            const XMVECTOR offset = XMLoadFloat3(&clusterCentroid[c]) - meshCentroid;
+            sortKey[c] = XMVectorGetX(XMVector3Dot(offset, XMLoadFloat3(&clusterNormal[c])));
+        }
+
+        std::vector<uint32_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(),
+            [&](uint32_t a, uint32_t b) { return sortKey[a] > sortKey[b]; });
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+        for (uint32_t c : order)
+            output.insert(output.end(), indices.begin() + clusterStart[c] * 3, indices.begin() + clusterStart[c + 1] * 3);
+
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    void OptimizeVertexFetch(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices)
+    {
+        constexpr uint32_t kUnused = ~0u;
+        std::vector<uint32_t> remap(vertices.size(), kUnused);
+        std::vector<MeshVertex> reordered;
+        reordered.reserve(vertices.size());
+
+        for (uint32_t& index : indices) {
+            if (remap[index] == kUnused) {
+                remap[index] = static_cast<uint32_t>(reordered.size());
+                reordered.push_back(vertices[index]);
+            }
+            index = remap[index];
+        }
+
+        vertices = std::move(reordered);
+    }
+
+    void Optimize(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices,
+        CacheStats* outBefore, CacheStats* outAfter)
+    {
+        if (outBefore)
+            *outBefore = AnalyzeVertexCache(indices, vertices.size());
+
+        WeldVertices(vertices, indices);
+        OptimizeVertexCache(indices, vertices.size());
+        OptimizeOverdraw(indices, vertices);
+        OptimizeVertexFetch(vertices, indices);
+
+        if (outAfter)
+            *outAfter = AnalyzeVertexCache(indices, vertices.size());
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct MeshVertex;
+
+// ---------------------------------------------------------------------------
+// 임포트 시 메시 최적화 (ModelLoader 가 캐시에 쓰기 전에 한 번 수행)
+//   1) 동일 정점 병합 (weld)
+//   2) post-transform 캐시용 삼각형 재정렬 (Forsyth)
+//   3) 오버드로우: 캐시 순서를 클러스터로 나눠 바깥쪽을 향한 것부터 그리기
+//   4) fetch 지역성: 인덱스에 처음 등장하는 순서로 정점 재배치
+// 인덱스는 입력 vertices 기준 (submesh 단위로 호출)
+// ---------------------------------------------------------------------------
+namespace MeshOptimizer
+{
+    struct CacheStats
+    {
+        float acmr = 0.0f;      // 삼각형당 캐시 미스 (최소 0.5, 3.0 이 최악)
+        float atvr = 0.0f;      // 정점당 캐시 미스 (1.0 이 이상적)
+    };
+
+    // FIFO 캐시 시뮬레이션 (일반적인 GPU post-transform 캐시 크기 기준)
+    CacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+    // 비트 단위로 같은 정점을 하나로 합치고 인덱스 갱신
+    void WeldVertices(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices);
+
+    void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount);
+
+    // OptimizeVertexCache 이후 호출 (클러스터 내부 순서는 유지)
+    void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<MeshVertex>& vertices);
+
+    // 참조되지 않는 정점은 제거됨
+    void OptimizeVertexFetch(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices);
+
+    // 위 단계를 순서대로 수행
+    void Optimize(std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices,
+        CacheStats* outBefore = nullptr, CacheStats* outAfter = nullptr);
+}
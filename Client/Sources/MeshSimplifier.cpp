@@ -0,0 +1,349 @@
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include "Mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace
+{
+    constexpr uint32_t MinLodTriangles = 32;        // 이보다 작으면 LOD 를 더 만들지 않음
+    constexpr float    MinLodReduction = 0.85f;     // 이전 LOD 대비 85% 이상 남으면 중단
+    constexpr float    MaxRelativeError = 0.1f;     // AABB 대각선 대비 허용 오차
+    constexpr float    MinFlipCosine = 0.2f;        // collapse 후 면 노멀이 이보다 많이 돌면 거부
+    constexpr int      MaxPasses = 64;
+
+    // 평면까지 거리 제곱의 합 (대칭 4x4 의 10개 성분) + 면적 가중치
+    struct Quadric
+    {
+        double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+        double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+        double a22 = 0.0, a23 = 0.0;
+        double a33 = 0.0;
+        double weight = 0.0;
+
+        void AddPlane(double a, double b, double c, double d, double w)
+        {
+            a00 += w * a * a; a01 += w * a * b; a02 += w * a * c; a03 += w * a * d;
+            a11 += w * b * b; a12 += w * b * c; a13 += w * b * d;
+            a22 += w * c * c; a23 += w * c * d;
+            a33 += w * d * d;
+            weight += w;
+        }
+
+        void Add(const Quadric& q)
+        {
+            a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+            a11 += q.a11; a12 += q.a12; a13 += q.a13;
+            a22 += q.a22; a23 += q.a23;
+            a33 += q.a33;
+            weight += q.weight;
+        }
+
+        // 면적 가중 평균 거리 제곱
+        double Evaluate(const XMFLOAT3& p) const
+        {
+            const double x = p.x, y = p.y, z = p.z;
+            const double sum =
+                a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x +
+                a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y +
+                a22 * z * z + 2.0 * a23 * z +
+                a33;
+            return weight > 0.0 ? std::max(sum, 0.0) / weight : 0.0;
+        }
+    };
+
+    struct Vec3d
+    {
+        double x, y, z;
+    };
+
+    Vec3d Sub(const XMFLOAT3& a, const XMFLOAT3& b) { return { double(a.x) - b.x, double(a.y) - b.y, double(a.z) - b.z }; }
+    Vec3d Cross(const Vec3d& a, const Vec3d& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+    double Dot(const Vec3d& a, const Vec3d& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    // 비정규화 면 노멀 (길이 = 면적 * 2)
+    Vec3d TriangleNormal(const XMFLOAT3& p0, const XMFLOAT3& p1, const XMFLOAT3& p2)
+    {
+        return Cross(Sub(p1, p0), Sub(p2, p0));
+    }
+
+    struct PositionKey
+    {
+        float x, y, z;
+        bool operator==(const PositionKey& o) const { return x == o.x && y == o.y && z == o.z; }
+    };
+
+    struct PositionKeyHash
+    {
+        size_t operator()(const PositionKey& k) const
+        {
+            const std::hash<float> h;
+            return h(k.x) ^ (h(k.y) * 0x9E3779B1u) ^ (h(k.z) * 0x85EBCA77u);
+        }
+    };
+
+    struct Collapse
+    {
+        uint32_t from;
+        uint32_t to;
+        double   cost;
+    };
+}
+
+namespace MeshSimplifier
+{
+    std::vector<uint32_t> Simplify(const std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices,
+        size_t targetIndexCount, float maxError, float* outError)
+    {
+        if (outError)
+            *outError = 0.0f;
+
+        std::vector<uint32_t> result = indices;
+        const size_t vertexCount = vertices.size();
+        if (vertexCount == 0 || result.size() <= targetIndexCount)
+            return result;
+
+        // 1) 같은 위치의 정점을 한 그룹으로 (seam 판정 / quadric 공유)
+        std::vector<uint32_t> positionGroup(vertexCount);
+        std::vector<uint32_t> groupSize;
+        {
+            std::unordered_map<PositionKey, uint32_t, PositionKeyHash> groups;
+            groups.reserve(vertexCount);
+            for (size_t v = 0; v < vertexCount; ++v) {
+                const XMFLOAT3& p = vertices[v].position;
+                auto [it, inserted] = groups.try_emplace(PositionKey{ p.x, p.y, p.z }, uint32_t(groupSize.size()));
+                if (inserted)
+                    groupSize.push_back(0);
+                positionGroup[v] = it->second;
+                ++groupSize[it->second];
+            }
+        }
+        const size_t groupCount = groupSize.size();
+
+        // 2) 면 평면 quadric 누적 (면적 가중)
+        std::vector<Quadric> quadrics(groupCount);
+        for (size_t t = 0; t + 2 < result.size(); t += 3) {
+            const XMFLOAT3& p0 = vertices[result[t + 0]].position;
+            const XMFLOAT3& p1 = vertices[result[t + 1]].position;
+            const XMFLOAT3& p2 = vertices[result[t + 2]].position;
+
+            const Vec3d n = TriangleNormal(p0, p1, p2);
+            const double length = std::sqrt(Dot(n, n));
+            if (length <= 0.0)
+                continue;
+
+            const double a = n.x / length, b = n.y / length, c = n.z / length;
+            const double d = -(a * p0.x + b * p0.y + c * p0.z);
+            const double area = length * 0.5;
+            for (int k = 0; k < 3; ++k)
+                quadrics[positionGroup[result[t + k]]].AddPlane(a, b, c, d, area);
+        }
+
+        // 3) 고정 정점: seam (그룹에 정점이 여러 개) + 경계 (위치 기준으로 삼각형 하나에만 속한 변)
+        std::vector<uint8_t> locked(vertexCount, 0);
+        {
+            std::unordered_map<uint64_t, uint32_t> edgeUse;
+            edgeUse.reserve(result.size());
+            for (size_t t = 0; t + 2 < result.size(); t += 3) {
+                for (int k = 0; k < 3; ++k) {
+                    uint32_t a = positionGroup[result[t + k]];
+                    uint32_t b = positionGroup[result[t + (k + 1) % 3]];
+                    if (a > b) std::swap(a, b);
+                    ++edgeUse[(uint64_t(a) << 32) | b];
+                }
+            }
+
+            std::vector<uint8_t> borderGroup(groupCount, 0);
+            for (const auto& [key, count] : edgeUse) {
+                if (count == 1) {
+                    borderGroup[key >> 32] = 1;
+                    borderGroup[key & 0xFFFFFFFFu] = 1;
+                }
+            }
+
+            for (size_t v = 0; v < vertexCount; ++v) {
+                const uint32_t group = positionGroup[v];
+                locked[v] = (groupSize[group] > 1 || borderGroup[group]) ? 1 : 0;
+            }
+        }
+
+        const double maxCost = double(maxError) * double(maxError);
+        double appliedCost = 0.0;
+
+        std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+        std::vector<uint32_t> adjacency;
+        std::vector<Collapse> collapses;
+        std::vector<uint32_t> collapseTarget(vertexCount);
+        std::vector<uint8_t> touched(vertexCount);
+
+        for (int pass = 0; pass < MaxPasses && result.size() > targetIndexCount; ++pass) {
+            const size_t triangleCount = result.size() / 3;
+
+            // 4) 정점 → 삼각형 인접 리스트 (CSR)
+            std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+            for (uint32_t index : result)
+                ++adjacencyOffsets[index + 1];
+            for (size_t v = 0; v < vertexCount; ++v)
+                adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+
+            adjacency.resize(result.size());
+            {
+                std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t i = 0; i < result.size(); ++i)
+                    adjacency[cursor[result[i]]++] = uint32_t(i / 3);
+            }
+
+            // 5) 후보: 고정되지 않은 끝점을 다른 끝점 위치로 옮기는 collapse
+            collapses.clear();
+            for (size_t t = 0; t < triangleCount; ++t) {
+                for (int k = 0; k < 3; ++k) {
+                    const uint32_t a = result[t * 3 + k];
+                    const uint32_t b = result[t * 3 + (k + 1) % 3];
+
+                    for (auto [from, to] : { std::pair{ a, b }, std::pair{ b, a } }) {
+                        if (locked[from])
+                            continue;
+
+                        Quadric q = quadrics[positionGroup[from]];
+                        q.Add(quadrics[positionGroup[to]]);
+                        const double cost = q.Evaluate(vertices[to].position);
+                        if (cost <= maxCost)
+                            collapses.push_back({ from, to, cost });
+                    }
+                }
+            }
+
+            if (collapses.empty())
+                break;
+
+            std::sort(collapses.begin(), collapses.end(),
+                [](const Collapse& l, const Collapse& r) { return l.cost < r.cost; });
+
+            // 6) 비용이 낮은 순으로 적용. 한 패스에서 정점의 1-ring 이 두 번 바뀌지 않도록 touched 로 막음
+            const size_t trianglesToRemove = triangleCount - targetIndexCount / 3;
+            size_t removed = 0;
+            size_t applied = 0;
+
+            for (size_t v = 0; v < vertexCount; ++v)
+                collapseTarget[v] = uint32_t(v);
+            std::fill(touched.begin(), touched.end(), 0);
+
+            for (const Collapse& collapse : collapses) {
+                if (removed >= trianglesToRemove)
+                    break;
+                if (touched[collapse.from] || touched[collapse.to])
+                    continue;
+
+                const XMFLOAT3& target = vertices[collapse.to].position;
+
+                // 뒤집히는 면이 생기면 거부
+                bool valid = true;
+                size_t collapsedTriangles = 0;
+                for (uint32_t i = adjacencyOffsets[collapse.from]; i < adjacencyOffsets[collapse.from + 1] && valid; ++i) {
+                    const uint32_t* tri = &result[adjacency[i] * 3];
+                    if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to) {
+                        ++collapsedTriangles;
+                        continue;
+                    }
+
+                    XMFLOAT3 before[3], after[3];
+                    for (int k = 0; k < 3; ++k) {
+                        before[k] = vertices[tri[k]].position;
+                        after[k] = tri[k] == collapse.from ? target : before[k];
+                    }
+
+                    const Vec3d n0 = TriangleNormal(before[0], before[1], before[2]);
+                    const Vec3d n1 = TriangleNormal(after[0], after[1], after[2]);
+                    const double length0 = std::sqrt(Dot(n0, n0));
+                    const double length1 = std::sqrt(Dot(n1, n1));
+                    if (length0 <= 0.0)
+                        continue;   // 원래 퇴화된 면
+                    if (length1 <= 0.0 || Dot(n0, n1) < MinFlipCosine * length0 * length1)
+                        valid = false;
+                }
+
+                if (!valid)
+                    continue;
+
+                collapseTarget[collapse.from] = collapse.to;
+                quadrics[positionGroup[collapse.to]].Add(quadrics[positionGroup[collapse.from]]);
+                appliedCost = std::max(appliedCost, collapse.cost);
+                removed += collapsedTriangles;
+                ++applied;
+
+                touched[collapse.from] = 1;
+                touched[collapse.to] = 1;
+                for (uint32_t i = adjacencyOffsets[collapse.from]; i < adjacencyOffsets[collapse.from + 1]; ++i) {
+                    const uint32_t* tri = &result[adjacency[i] * 3];
+                    touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+                }
+            }
+
+            if (applied == 0)
+                break;
+
+            // 7) 인덱스 갱신, 위치 기준으로 퇴화된 삼각형 제거
+            size_t write = 0;
+            for (size_t t = 0; t < triangleCount; ++t) {
+                const uint32_t i0 = collapseTarget[result[t * 3 + 0]];
+                const uint32_t i1 = collapseTarget[result[t * 3 + 1]];
+                const uint32_t i2 = collapseTarget[result[t * 3 + 2]];
+
+                const uint32_t g0 = positionGroup[i0], g1 = positionGroup[i1], g2 = positionGroup[i2];
+                if (g0 == g1 || g1 == g2 || g0 == g2)
+                    continue;
+
+                result[write++] = i0;
+                result[write++] = i1;
+                result[write++] = i2;
+            }
+            result.resize(write);
+        }
+
+        if (outError)
+            *outError = float(std::sqrt(appliedCost));
+        return result;
+    }
+
+    void BuildLodChain(const std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices,
+        std::vector<MeshLod>& outLods, uint32_t maxLodCount)
+    {
+        outLods.clear();
+        outLods.push_back({ 0, uint32_t(indices.size()), 0.0f });
+        if (vertices.empty() || indices.size() / 3 < MinLodTriangles * 2)
+            return;
+
+        // 허용 오차는 메시 크기 기준
+        XMFLOAT3 boxMin = vertices[0].position, boxMax = vertices[0].position;
+        for (const MeshVertex& v : vertices) {
+            boxMin = { std::min(boxMin.x, v.position.x), std::min(boxMin.y, v.position.y), std::min(boxMin.z, v.position.z) };
+            boxMax = { std::max(boxMax.x, v.position.x), std::max(boxMax.y, v.position.y), std::max(boxMax.z, v.position.z) };
+        }
+        const Vec3d diagonal = Sub(boxMax, boxMin);
+        const float maxError = float(std::sqrt(Dot(diagonal, diagonal))) * MaxRelativeError;
+
+        std::vector<uint32_t> previous = indices;
+        float previousError = 0.0f;
+
+        for (uint32_t lod = 1; lod < maxLodCount; ++lod) {
+            const size_t targetIndexCount = (previous.size() / 6) * 3;
+            if (targetIndexCount / 3 < MinLodTriangles)
+                break;
+
+            // 이전 LOD 를 다시 단순화하므로 오차는 누적값을 상한으로 사용
+            float error = 0.0f;
+            std::vector<uint32_t> simplified = Simplify(vertices, previous, targetIndexCount, maxError, &error);
+            if (simplified.empty() || simplified.size() > size_t(previous.size() * MinLodReduction))
+                break;
+
+            MeshOptimizer::OptimizeVertexCache(simplified, vertices.size());
+
+            previousError += error;
+            outLods.push_back({ uint32_t(indices.size()), uint32_t(simplified.size()), previousError });
+            indices.insert(indices.end(), simplified.begin(), simplified.end());
+            previous = std::move(simplified);
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct MeshVertex;
+
+// LOD 하나 = 공유 인덱스 버퍼의 한 구간 (모든 LOD 가 같은 정점 버퍼를 참조)
+struct MeshLod
+{
+    uint32_t indexStart;
+    uint32_t indexCount;
+    float    error;         // 원본 대비 기하 오차 상한 (로컬 공간 거리)
+};
+static_assert(sizeof(MeshLod) == 12, "MeshLod is stored as-is in the mesh cache");
+
+// ---------------------------------------------------------------------------
+// LOD 생성용 메시 단순화 (임포트 / 절차적 메시 생성 시 한 번 수행)
+//   Quadric error metric 기반 edge collapse. 정점은 이웃 정점 위치로만 합쳐지므로
+//   정점 버퍼는 그대로 두고 LOD 마다 인덱스만 새로 만든다
+//   경계 정점과 UV / 노멀 seam 정점(같은 위치에 정점이 여러 개)은 고정
+// ---------------------------------------------------------------------------
+namespace MeshSimplifier
+{
+    // targetIndexCount 이하가 되거나 maxError (로컬 공간 거리) 를 넘기 전까지 collapse
+    // outError: 실제로 수행한 collapse 중 가장 큰 오차
+    std::vector<uint32_t> Simplify(const std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices,
+        size_t targetIndexCount, float maxError, float* outError = nullptr);
+
+    // indices (LOD0) 뒤에 더 거친 LOD 들을 이어 붙이고 outLods 를 채움 (outLods[0] = 원본)
+    // 단계마다 삼각형 절반을 목표로 하고, 거의 줄지 않으면 (고정 정점이 많은 메시) 중단
+    void BuildLodChain(const std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices,
+        std::vector<MeshLod>& outLods, uint32_t maxLodCount = 4);
+}
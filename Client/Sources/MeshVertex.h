@@ -0,0 +1,12 @@
+#pragma once
+
+#include <DirectXMath.h>
+
+// CPU 쪽 정점 (GPU Full 레이아웃과 동일, 44 바이트)
+// d3d12 없이 정점만 다루는 코드(TangentGenerator 등)는 Mesh.h 대신 이 헤더만 include
+struct MeshVertex {
+    DirectX::XMFLOAT3 position;
+    DirectX::XMFLOAT3 normal;
+    DirectX::XMFLOAT2 texCoord;
+    DirectX::XMFLOAT3 tangent;
+};
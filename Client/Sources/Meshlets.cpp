@@ -0,0 +1,398 @@
+#include "Meshlets.h"
+#include "MeshVertex.h"
+
+#include <DirectXCollision.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace
+{
+    constexpr float MinConeSpread = 0.1f;   // 노멀 최소 내적이 이보다 작으면 콘 컬링 불가
+    constexpr float JumpSlack = 0.5f;       // 인접 삼각형이 없을 때 AABB 를 이만큼 키운 범위 안이면 이어 붙임
+
+    XMVECTOR FaceNormal(const XMFLOAT3& p0, const XMFLOAT3& p1, const XMFLOAT3& p2)
+    {
+        const XMVECTOR a = XMLoadFloat3(&p0);
+        // 이 엔진의 앞면 (CW) 기준 바깥쪽
+        return XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&p1), a), XMVectorSubtract(XMLoadFloat3(&p2), a));
+    }
+
+    // 생성 중인 메시릿 하나
+    struct Builder
+    {
+        std::vector<uint32_t> vertices;     // 전역 정점 번호
+        std::vector<uint32_t> triangles;    // 삼각형 번호
+        XMFLOAT3 boundsMin = {}, boundsMax = {};
+        XMFLOAT3 centroidSum = {};
+        XMFLOAT3 normalSum = {};
+
+        void Reset()
+        {
+            vertices.clear();
+            triangles.clear();
+            centroidSum = normalSum = { 0.0f, 0.0f, 0.0f };
+            boundsMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+            boundsMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        }
+    };
+
+    void ComputeCone(const std::vector<MeshVertex>& vertices, const uint32_t* indices,
+        const Meshlets::Meshlet& meshlet, XMFLOAT3& outApex, XMFLOAT3& outAxis, float& outCutoff)
+    {
+        const XMVECTOR center = XMLoadFloat3(&meshlet.center);
+        outApex = meshlet.center;
+        outAxis = { 0.0f, 0.0f, 0.0f };
+        outCutoff = 1.0f;
+
+        // 1) 축 = 단위 면 노멀의 평균 방향 (퇴화 삼각형 제외)
+        XMVECTOR normalSum = XMVectorZero();
+        for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+            const uint32_t* tri = &indices[(meshlet.firstTriangle + t) * 3];
+            const XMVECTOR n = FaceNormal(vertices[tri[0]].position, vertices[tri[1]].position, vertices[tri[2]].position);
+            if (XMVectorGetX(XMVector3LengthSq(n)) > 0.0f)
+                normalSum = XMVectorAdd(normalSum, XMVector3Normalize(n));
+        }
+        if (XMVectorGetX(XMVector3LengthSq(normalSum)) <= 1e-12f)
+            return;
+
+        const XMVECTOR axis = XMVector3Normalize(normalSum);
+        XMStoreFloat3(&outAxis, axis);
+
+        // 2) 축과 가장 벌어진 노멀, 모든 면 평면 뒤에 있도록 apex 를 축 반대로 이동
+        float minDot = 1.0f;
+        float maxT = 0.0f;
+        for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+            const uint32_t* tri = &indices[(meshlet.firstTriangle + t) * 3];
+            const XMVECTOR n = FaceNormal(vertices[tri[0]].position, vertices[tri[1]].position, vertices[tri[2]].position);
+            if (XMVectorGetX(XMVector3LengthSq(n)) <= 0.0f)
+                continue;
+
+            const XMVECTOR unitNormal = XMVector3Normalize(n);
+            const float dn = XMVectorGetX(XMVector3Dot(axis, unitNormal));
+            minDot = std::min(minDot, dn);
+            if (dn <= MinConeSpread)
+                return;
+
+            const XMVECTOR toCenter = XMVectorSubtract(center, XMLoadFloat3(&vertices[tri[0]].position));
+            maxT = std::max(maxT, XMVectorGetX(XMVector3Dot(toCenter, unitNormal)) / dn);
+        }
+
+        XMStoreFloat3(&outApex, XMVectorSubtract(center, XMVectorScale(axis, maxT)));
+        outCutoff = std::sqrt(1.0f - minDot * minDot);
+    }
+
+    bool InsideFrustum(const Meshlets::CullView& view, const Meshlets::Meshlet& meshlet)
+    {
+        for (const XMFLOAT4& plane : view.planes) {
+            const float distance = plane.x * meshlet.center.x + plane.y * meshlet.center.y + plane.z * meshlet.center.z + plane.w;
+            if (distance < -meshlet.radius)
+                return false;
+        }
+        return true;
+    }
+
+    // 시점에서 모든 삼각형이 뒷면이면 true
+    bool ConeCulled(const Meshlets::CullView& view, const Meshlets::Meshlet& meshlet)
+    {
+        if (!view.coneCulling || meshlet.coneCutoff >= 1.0f)
+            return false;
+
+        const XMFLOAT3& axis = meshlet.coneAxis;
+        if (view.viewer.w == 0.0f) {
+            // 직교: 시선 방향이 곧 모든 면에 대한 방향
+            return view.viewer.x * axis.x + view.viewer.y * axis.y + view.viewer.z * axis.z >= meshlet.coneCutoff;
+        }
+
+        const float dx = meshlet.coneApex.x - view.viewer.x;
+        const float dy = meshlet.coneApex.y - view.viewer.y;
+        const float dz = meshlet.coneApex.z - view.viewer.z;
+        const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+        return dx * axis.x + dy * axis.y + dz * axis.z >= meshlet.coneCutoff * length;
+    }
+}
+
+namespace Meshlets
+{
+    void Build(const std::vector<MeshVertex>& meshVertices, std::vector<uint32_t>& meshIndices,
+        size_t indexStart, size_t indexCount, MeshletData& outData)
+    {
+        if (indexStart >= meshIndices.size())
+            return;
+        const size_t triangleCount = std::min(indexCount, meshIndices.size() - indexStart) / 3;
+        if (triangleCount == 0 || meshVertices.empty())
+            return;
+
+        // 0) 구간이 참조하는 정점 범위 기준의 로컬 번호로 작업 (서브메시마다 정점 전체 크기 버퍼를 만들지 않도록)
+        const auto rangeBegin = meshIndices.begin() + indexStart;
+        const auto rangeEnd = rangeBegin + triangleCount * 3;
+        const uint32_t firstVertex = *std::min_element(rangeBegin, rangeEnd);
+        const uint32_t lastVertex = *std::max_element(rangeBegin, rangeEnd);
+        if (lastVertex >= meshVertices.size())
+            return;
+
+        const MeshVertex* vertices = meshVertices.data() + firstVertex;
+        const size_t vertexCount = size_t(lastVertex - firstVertex) + 1;
+        std::vector<uint32_t> indices(rangeBegin, rangeEnd);
+        for (uint32_t& index : indices)
+            index -= firstVertex;
+
+        const size_t firstMeshlet = outData.meshlets.size();
+
+        // 1) 정점 → 삼각형 인접 목록 (CSR), 삼각형 중심 / 단위 노멀
+        std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+        for (size_t i = 0; i < triangleCount * 3; ++i)
+            ++adjacencyOffsets[indices[i] + 1];
+        for (size_t v = 0; v < vertexCount; ++v)
+            adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+
+        std::vector<uint32_t> adjacency(triangleCount * 3);
+        {
+            std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (size_t i = 0; i < triangleCount * 3; ++i)
+                adjacency[cursor[indices[i]]++] = uint32_t(i / 3);
+        }
+
+        std::vector<XMFLOAT3> centroids(triangleCount);
+        std::vector<XMFLOAT3> normals(triangleCount);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            const XMFLOAT3& p0 = vertices[indices[t * 3 + 0]].position;
+            const XMFLOAT3& p1 = vertices[indices[t * 3 + 1]].position;
+            const XMFLOAT3& p2 = vertices[indices[t * 3 + 2]].position;
+            centroids[t] = { (p0.x + p1.x + p2.x) / 3.0f, (p0.y + p1.y + p2.y) / 3.0f, (p0.z + p1.z + p2.z) / 3.0f };
+
+            const XMVECTOR n = FaceNormal(p0, p1, p2);
+            XMStoreFloat3(&normals[t], XMVectorGetX(XMVector3LengthSq(n)) > 0.0f ? XMVector3Normalize(n) : XMVectorZero());
+        }
+
+        // 2) 탐욕적 확장: 메시릿 정점에 붙은 삼각형 중 새 정점이 적고 가깝고 노멀이 비슷한 것부터
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<uint32_t> vertexStamp(vertexCount, 0);      // 메시릿 번호 + 1 이면 현재 메시릿 소속
+        std::vector<uint8_t>  localIndex(vertexCount, 0);
+        std::vector<uint32_t> candidateStamp(triangleCount, 0);
+        std::vector<uint32_t> candidates;
+        std::vector<uint32_t> orderedIndices;
+        orderedIndices.reserve(triangleCount * 3);
+
+        Builder builder;
+        size_t seedCursor = 0;
+        uint32_t stamp = 0;
+
+        auto extraVertices = [&](uint32_t t) {
+            uint32_t extra = 0;
+            for (int k = 0; k < 3; ++k)
+                extra += vertexStamp[indices[t * 3 + k]] != stamp;
+            return extra;
+        };
+
+        auto addTriangle = [&](uint32_t t) {
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t v = indices[t * 3 + k];
+                if (vertexStamp[v] == stamp)
+                    continue;
+
+                vertexStamp[v] = stamp;
+                localIndex[v] = uint8_t(builder.vertices.size());
+                builder.vertices.push_back(v);
+
+                const XMFLOAT3& p = vertices[v].position;
+                builder.boundsMin = { std::min(builder.boundsMin.x, p.x), std::min(builder.boundsMin.y, p.y), std::min(builder.boundsMin.z, p.z) };
+                builder.boundsMax = { std::max(builder.boundsMax.x, p.x), std::max(builder.boundsMax.y, p.y), std::max(builder.boundsMax.z, p.z) };
+
+                // 새 정점에 붙은 삼각형을 후보로
+                for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a) {
+                    const uint32_t neighbor = adjacency[a];
+                    if (!emitted[neighbor] && candidateStamp[neighbor] != stamp) {
+                        candidateStamp[neighbor] = stamp;
+                        candidates.push_back(neighbor);
+                    }
+                }
+            }
+
+            emitted[t] = true;
+            builder.triangles.push_back(t);
+            builder.centroidSum = { builder.centroidSum.x + centroids[t].x, builder.centroidSum.y + centroids[t].y, builder.centroidSum.z + centroids[t].z };
+            builder.normalSum = { builder.normalSum.x + normals[t].x, builder.normalSum.y + normals[t].y, builder.normalSum.z + normals[t].z };
+        };
+
+        auto closeMeshlet = [&]() {
+            Meshlet meshlet{};
+            meshlet.vertexOffset = uint32_t(outData.vertices.size());
+            meshlet.vertexCount = uint32_t(builder.vertices.size());
+            meshlet.firstTriangle = uint32_t((indexStart + orderedIndices.size()) / 3);
+            meshlet.triangleCount = uint32_t(builder.triangles.size());
+
+            for (uint32_t v : builder.vertices)
+                outData.vertices.push_back(firstVertex + v);
+            for (uint32_t t : builder.triangles) {
+                for (int k = 0; k < 3; ++k) {
+                    orderedIndices.push_back(indices[t * 3 + k]);
+                    outData.triangles.push_back(localIndex[indices[t * 3 + k]]);
+                }
+            }
+
+            std::vector<XMFLOAT3> points(builder.vertices.size());
+            for (size_t i = 0; i < builder.vertices.size(); ++i)
+                points[i] = vertices[builder.vertices[i]].position;
+
+            BoundingSphere sphere;
+            BoundingSphere::CreateFromPoints(sphere, points.size(), points.data(), sizeof(XMFLOAT3));
+            meshlet.center = sphere.Center;
+            meshlet.radius = sphere.Radius;
+
+            outData.meshlets.push_back(meshlet);
+        };
+
+        while (true) {
+            while (seedCursor < triangleCount && emitted[seedCursor])
+                ++seedCursor;
+            if (seedCursor == triangleCount)
+                break;
+
+            ++stamp;
+            builder.Reset();
+            candidates.clear();
+            addTriangle(uint32_t(seedCursor));
+
+            while (builder.triangles.size() < MaxTriangles) {
+                const float inv = 1.0f / float(builder.triangles.size());
+                const XMFLOAT3 center = { builder.centroidSum.x * inv, builder.centroidSum.y * inv, builder.centroidSum.z * inv };
+                XMFLOAT3 averageNormal;
+                XMStoreFloat3(&averageNormal, XMVector3Normalize(XMLoadFloat3(&builder.normalSum)));
+
+                const uint32_t freeVertices = MaxVertices - uint32_t(builder.vertices.size());
+                uint32_t bestTriangle = UINT32_MAX;
+                uint32_t bestExtra = UINT32_MAX;
+                float bestCost = FLT_MAX;
+
+                for (size_t c = 0; c < candidates.size();) {
+                    const uint32_t t = candidates[c];
+                    if (emitted[t]) {
+                        candidates[c] = candidates.back();
+                        candidates.pop_back();
+                        continue;
+                    }
+                    ++c;
+
+                    const uint32_t extra = extraVertices(t);
+                    if (extra > freeVertices || extra > bestExtra)
+                        continue;
+
+                    const float dx = centroids[t].x - center.x;
+                    const float dy = centroids[t].y - center.y;
+                    const float dz = centroids[t].z - center.z;
+                    const float facing = normals[t].x * averageNormal.x + normals[t].y * averageNormal.y + normals[t].z * averageNormal.z;
+                    const float cost = (dx * dx + dy * dy + dz * dz) * (2.0f - facing);
+                    if (extra < bestExtra || cost < bestCost) {
+                        bestTriangle = t;
+                        bestExtra = extra;
+                        bestCost = cost;
+                    }
+                }
+
+                // 붙은 삼각형이 없으면 다음 순서의 삼각형이 메시릿 근처일 때만 이어 붙임 (작은 조각이 많은 메시)
+                if (bestTriangle == UINT32_MAX) {
+                    while (seedCursor < triangleCount && emitted[seedCursor])
+                        ++seedCursor;
+                    if (seedCursor == triangleCount || extraVertices(uint32_t(seedCursor)) > freeVertices)
+                        break;
+
+                    const XMFLOAT3& c = centroids[seedCursor];
+                    const XMFLOAT3 slack = {
+                        (builder.boundsMax.x - builder.boundsMin.x) * JumpSlack,
+                        (builder.boundsMax.y - builder.boundsMin.y) * JumpSlack,
+                        (builder.boundsMax.z - builder.boundsMin.z) * JumpSlack };
+                    if (c.x < builder.boundsMin.x - slack.x || c.x > builder.boundsMax.x + slack.x ||
+                        c.y < builder.boundsMin.y - slack.y || c.y > builder.boundsMax.y + slack.y ||
+                        c.z < builder.boundsMin.z - slack.z || c.z > builder.boundsMax.z + slack.z)
+                        break;
+
+                    bestTriangle = uint32_t(seedCursor);
+                }
+
+                addTriangle(bestTriangle);
+            }
+
+            closeMeshlet();
+        }
+
+        // 3) 구간 인덱스를 메시릿 순서로 교체하고 노멀 콘 계산 (재배치된 인덱스 기준)
+        for (size_t i = 0; i < orderedIndices.size(); ++i)
+            meshIndices[indexStart + i] = firstVertex + orderedIndices[i];
+        for (size_t m = firstMeshlet; m < outData.meshlets.size(); ++m) {
+            Meshlet& meshlet = outData.meshlets[m];
+            ComputeCone(meshVertices, meshIndices.data(), meshlet, meshlet.coneApex, meshlet.coneAxis, meshlet.coneCutoff);
+        }
+    }
+
+    CullView MakeCullView(FXMMATRIX world, CXMMATRIX viewProj)
+    {
+        CullView view;
+
+        // 1) 로컬 → 클립 행렬의 열로 절두체 평면 (D3D: 0 <= z <= w)
+        const XMMATRIX localToClip = XMMatrixMultiply(world, viewProj);
+        const XMMATRIX columns = XMMatrixTranspose(localToClip);
+        const XMVECTOR planes[6] = {
+            XMVectorAdd(columns.r[3], columns.r[0]),        // left
+            XMVectorSubtract(columns.r[3], columns.r[0]),   // right
+            XMVectorAdd(columns.r[3], columns.r[1]),        // bottom
+            XMVectorSubtract(columns.r[3], columns.r[1]),   // top
+            columns.r[2],                                   // near
+            XMVectorSubtract(columns.r[3], columns.r[2]),   // far
+        };
+        for (int i = 0; i < 6; ++i)
+            XMStoreFloat4(&view.planes[i], XMPlaneNormalize(planes[i]));
+
+        // 2) 클립 공간 (0, 0, 1, 0) 을 로컬로: 원근이면 시점 위치, 직교면 시선 방향
+        XMVECTOR determinant;
+        const XMMATRIX clipToLocal = XMMatrixInverse(&determinant, localToClip);
+        if (XMVectorGetX(determinant) == 0.0f)
+            return view;
+
+        const XMVECTOR viewer = XMVector4Transform(XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), clipToLocal);
+        const float w = XMVectorGetW(viewer);
+        const float length = XMVectorGetX(XMVector3Length(viewer));
+        if (std::fabs(w) > 1e-6f * length) {
+            XMStoreFloat4(&view.viewer, XMVectorSetW(XMVectorScale(viewer, 1.0f / w), 1.0f));
+        }
+        else {
+            XMStoreFloat4(&view.viewer, XMVectorSetW(XMVector3Normalize(viewer), 0.0f));
+        }
+
+        // 3) 미러링된 월드 행렬은 래스터라이저의 앞/뒷면이 반대
+        view.coneCulling = XMVectorGetX(XMMatrixDeterminant(world)) > 0.0f;
+        return view;
+    }
+
+    void Cull(const MeshletData& data, const CullView* views, size_t viewCount,
+        std::vector<DrawRange>& outRanges, CullStats& stats)
+    {
+        for (const Meshlet& meshlet : data.meshlets) {
+            ++stats.tested;
+
+            bool insideAny = false;
+            bool visible = false;
+            for (size_t i = 0; i < viewCount && !visible; ++i) {
+                if (!InsideFrustum(views[i], meshlet))
+                    continue;
+                insideAny = true;
+                visible = !ConeCulled(views[i], meshlet);
+            }
+
+            if (!visible) {
+                ++(insideAny ? stats.coneCulled : stats.frustumCulled);
+                continue;
+            }
+
+            const uint32_t indexStart = meshlet.firstTriangle * 3;
+            const uint32_t indexCount = meshlet.triangleCount * 3;
+            if (!outRanges.empty() && outRanges.back().indexStart + outRanges.back().indexCount == indexStart)
+                outRanges.back().indexCount += indexCount;
+            else
+                outRanges.push_back({ indexStart, indexCount });
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <DirectXMath.h>
+
+struct MeshVertex;
+
+// ---------------------------------------------------------------------------
+// 메시릿 (클러스터): 정점 64개 / 삼각형 124개 이하로 나눈 LOD0 조각
+//   - CPU 경로: 메시 인덱스 버퍼의 LOD0 구간을 메시릿 순서로 재배치해 두고,
+//     보이는 메시릿의 연속 구간만 DrawIndexedInstanced
+//   - 메시 / 컴퓨트 셰이더 경로용으로 메시릿 로컬 정점 목록 + uint8 삼각형도 함께 보관
+// ---------------------------------------------------------------------------
+namespace Meshlets
+{
+    static constexpr uint32_t MaxVertices = 64;
+    static constexpr uint32_t MaxTriangles = 124;
+
+    struct Meshlet
+    {
+        uint32_t vertexOffset;      // MeshletData::vertices 시작
+        uint32_t vertexCount;
+        uint32_t firstTriangle;     // LOD0 기준 삼각형 번호 (인덱스 버퍼 시작 = firstTriangle * 3, 로컬 삼각형 바이트 오프셋도 동일)
+        uint32_t triangleCount;
+
+        // 로컬 공간 바운딩 구
+        DirectX::XMFLOAT3 center;
+        float             radius;
+
+        // 노멀 콘: 정점 위치 apex 에서 본 방향이 axis 와 cutoff 이상 같으면 모든 면이 뒷면
+        DirectX::XMFLOAT3 coneApex;
+        float             coneCutoff;   // 1 이상이면 콘 컬링 불가 (노멀이 너무 퍼져 있음)
+        DirectX::XMFLOAT3 coneAxis;
+        float             reserved;
+    };
+    static_assert(sizeof(Meshlet) == 64, "Meshlet is stored as-is in the mesh cache");
+
+    struct MeshletData
+    {
+        std::vector<Meshlet>  meshlets;
+        std::vector<uint32_t> vertices;     // 메시릿 로컬 정점 → 메시 정점 인덱스
+        std::vector<uint8_t>  triangles;    // 메시릿 로컬 정점 번호 3개씩
+
+        bool Empty() const { return meshlets.empty(); }
+    };
+
+    // indices[indexStart, indexStart + indexCount) 를 메시릿 순서로 재배치하면서 outData 에 메시릿 추가
+    // (서브메시마다 호출하면 메시릿이 서브메시 경계를 넘지 않음, indexStart 는 3의 배수)
+    // 인접 삼각형 중 새 정점을 덜 추가하고 중심 / 노멀 방향이 가까운 것부터 붙여 나감
+    void Build(const std::vector<MeshVertex>& vertices, std::vector<uint32_t>& indices,
+        size_t indexStart, size_t indexCount, MeshletData& outData);
+
+    // 오브젝트 로컬 공간의 컬링 뷰 (절두체 평면 + 시점)
+    struct CullView
+    {
+        DirectX::XMFLOAT4 planes[6];    // 안쪽이 양수, xyz 정규화
+        DirectX::XMFLOAT4 viewer;       // w = 1 이면 시점 위치 (원근), 0 이면 시선 방향 (직교)
+        bool coneCulling = false;       // 월드 행렬이 뒤집혀 있으면 (det < 0) 뒷면 판정이 반대라 끔
+    };
+
+    // world: 오브젝트 월드 행렬, viewProj: 카메라 또는 라이트 면의 view * projection
+    CullView MakeCullView(DirectX::FXMMATRIX world, DirectX::CXMMATRIX viewProj);
+
+    struct CullStats
+    {
+        uint32_t tested = 0;
+        uint32_t frustumCulled = 0;
+        uint32_t coneCulled = 0;
+    };
+
+    struct DrawRange
+    {
+        uint32_t indexStart;
+        uint32_t indexCount;
+    };
+
+    // views 중 하나라도 보이면 visible (면 인스턴싱처럼 한 드로우가 여러 뷰에 그려질 때)
+    // 연속된 visible 메시릿은 한 범위로 합쳐서 outRanges 에 추가
+    void Cull(const MeshletData& data, const CullView* views, size_t viewCount,
+        std::vector<DrawRange>& outRanges, CullStats& stats);
+}
@@ -1,72 +1,25 @@
 #include "ModelLoader.h"
 #include "Mesh.h"
 #include "Renderer.h"
+#include "DebugManager.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "Meshlets.h"
+#include "TangentGenerator.h"
+
+#include <chrono>
+#include <format>
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
 
-static void ComputeTangents(
-    std::vector<ModelLoader::Vertex>& vertices,
-    const std::vector<unsigned int>& indices)
-{
-    if (vertices.empty() || indices.empty()) return;
-
-    constexpr float kEpsilon = 1e-6f;
-
-    // 1) accumulator buffer for un-normalized tangents
-    std::vector<XMFLOAT3> accum(vertices.size(), XMFLOAT3(0, 0, 0));
-
-    // 2) iterate triangles and accumulate dP / dUV based tangents
-    for (size_t f = 0; f + 2 < indices.size(); f += 3)
-    {
-        uint32_t i0 = indices[f];
-        uint32_t i1 = indices[f + 1];
-        uint32_t i2 = indices[f + 2];
-
-        const XMFLOAT3& p0 = vertices[i0].position;
-        const XMFLOAT3& p1 = vertices[i1].position;
-        const XMFLOAT3& p2 = vertices[i2].position;
-
-        const XMFLOAT2& uv0 = vertices[i0].texCoords;
-        const XMFLOAT2& uv1 = vertices[i1].texCoords;
-        const XMFLOAT2& uv2 = vertices[i2].texCoords;
-
-        XMVECTOR dp1 = XMLoadFloat3(&p1) - XMLoadFloat3(&p0);
-        XMVECTOR dp2 = XMLoadFloat3(&p2) - XMLoadFloat3(&p0);
-
-        float du1 = uv1.x - uv0.x;
-        float dv1 = uv1.y - uv0.y;
-        float du2 = uv2.x - uv0.x;
-        float dv2 = uv2.y - uv0.y;
-
-        float denom = du1 * dv2 - dv1 * du2;
-        if (fabsf(denom) < kEpsilon) denom = kEpsilon; // avoid divide-by-zero
-
-        float inv = 1.0f / denom;
-        XMVECTOR tangentVec = (dp1 * dv2 - dp2 * dv1) * inv;
-
-        XMFLOAT3 tangent;
-        XMStoreFloat3(&tangent, tangentVec);
-
-        // add the face tangent to each of the three vertices
-        for (uint32_t idx : { i0, i1, i2 })
-        {
-            accum[idx].x += tangent.x;
-            accum[idx].y += tangent.y;
-            accum[idx].z += tangent.z;
-        }
-    }
-
-    // 3) normalize accumulated tangents and write back to vertex data
-    for (size_t i = 0; i < vertices.size(); ++i)
-    {
-        XMVECTOR v = XMLoadFloat3(&accum[i]);
-        v = XMVector3Normalize(v);
-        XMStoreFloat3(&vertices[i].tangent, v);
-    }
-}
+// LoadMesh 임포트 플래그 (바뀌면 캐시 해시도 바뀜)
+static constexpr unsigned int MeshImportFlags =
+    aiProcess_Triangulate |
+    aiProcess_GenSmoothNormals |
+    aiProcess_ConvertToLeftHanded;
 
 
 bool ModelLoader::LoadModel(const std::string& filePath) {
@@ -92,36 +45,314 @@ std::shared_ptr<Mesh> ModelLoader::LoadMesh(Renderer* renderer, const std::strin
 {
     Clear();
 
-    const aiScene* scene = importer.ReadFile(filePath,
-        aiProcess_Triangulate |
-        aiProcess_GenSmoothNormals |
-        aiProcess_ConvertToLeftHanded
-    );
+    const auto startTime = std::chrono::steady_clock::now();
+    const CacheKey key = MakeCacheKey(filePath);
 
-    if (!scene || !scene->HasMeshes()) {
+    // 1) 캐시 (hot path)
+    if (auto cached = LoadMeshFromCache(renderer, key.cachePath, key.GetExpectedHash())) {
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        DebugManager::GetInstance().LogMessage(std::format(
+            L"[Mesh] {} loaded from cache in {:.2f} ms", key.sourcePath.wstring(), ms));
+        return cached;
+    }
+
+    // 2) Assimp 임포트 (cold path) + 업로드
+    MeshData data;
+    if (!ImportMesh(filePath, key, renderer->GetThreadPool(), data)) {
         return nullptr;
     }
+    return CreateMesh(renderer, data);
+}
 
-    XMMATRIX identity = XMMatrixIdentity();
-    ProcessNode(scene->mRootNode, scene, identity);
+bool ModelLoader::LoadMeshData(const std::string& filePath, ThreadPool* tangentPool, MeshData& outData)
+{
+    Clear();
 
-    if (needTangentFix) {
-        ComputeTangents(vertices, indices);
+    const auto startTime = std::chrono::steady_clock::now();
+    const CacheKey key = MakeCacheKey(filePath);
+
+    // 1) 캐시: 업로드가 나중에 렌더 스레드에서 일어나므로 매핑된 뷰 대신 복사본으로 넘김
+    MeshCache::MappedFile file;
+    if (file.Open(key.cachePath, key.GetExpectedHash())) {
+        const MeshCache::FileHeader& header = file.GetHeader();
+        outData.vertices.assign(file.GetVertices(), file.GetVertices() + header.vertexCount);
+        outData.indices.assign(file.GetIndices(), file.GetIndices() + header.indexCount);
+        outData.submeshes.assign(file.GetSubmeshes(), file.GetSubmeshes() + header.submeshCount);
+        outData.lods.assign(file.GetLods(), file.GetLods() + header.lodCount);
+        outData.meshlets = header.meshletCount > 0 ? file.ReadMeshlets() : Meshlets::MeshletData{};
+        outData.bounds = file.GetBounds();
+        submeshes = outData.submeshes;
+
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        DebugManager::GetInstance().LogMessage(std::format(
+            L"[Mesh] {} read from cache in {:.2f} ms", key.sourcePath.wstring(), ms));
+        return true;
+    }
+
+    // 2) Assimp 임포트 (cold path)
+    return ImportMesh(filePath, key, tangentPool, outData);
+}
+
+std::shared_ptr<Mesh> ModelLoader::CreateMesh(Renderer* renderer, const MeshData& data)
+{
+    auto mesh = std::make_shared<Mesh>();
+    if (!mesh->Initialize(renderer,
+        data.vertices.data(), data.vertices.size(),
+        data.indices.data(), data.indices.size(),
+        data.bounds,
+        renderer->IsCompactVerticesEnabled() ? VertexFormat::Compact : VertexFormat::Full,
+        data.lods)) {
+        return nullptr;
+    }
+    mesh->SetSubmeshes(data.submeshes);
+    mesh->SetMeshlets(data.meshlets);
+    return mesh;
+}
+
+ModelLoader::CacheKey ModelLoader::MakeCacheKey(const std::string& filePath) const
+{
+    CacheKey key;
+    key.sourcePath = filePath;
+    key.cachePath = MeshCache::GetCachePath(filePath);
+
+    // 배포 빌드처럼 소스가 없으면 캐시를 그대로 신뢰
+    key.hasSource = std::filesystem::exists(key.sourcePath);
+    key.sourceHash = key.hasSource ? MeshCache::HashSource(key.sourcePath, MeshImportFlags, static_cast<uint32_t>(tangentMode)) : 0;
+    return key;
+}
+
+bool ModelLoader::ImportMesh(const std::string& filePath, const CacheKey& key, ThreadPool* tangentPool, MeshData& outData)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    const std::wstring name = key.sourcePath.wstring();
+
+    const aiScene* scene = importer.ReadFile(filePath, MeshImportFlags);
+
+    if (!scene || !scene->HasMeshes()) {
+        return false;
     }
 
+    XMMATRIX identity = XMMatrixIdentity();
+    ProcessNode(scene->mRootNode, scene, identity);
 
     // Vertex 포맷 변환
     std::vector<MeshVertex> meshVertices;
+    meshVertices.reserve(vertices.size());
     for (const auto& v : vertices) {
         meshVertices.push_back({ v.position, v.normal, v.texCoords, v.tangent });
     }
 
+    if (needTangentFix) {
+        GenerateTangents(meshVertices, tangentPool, name);
+    }
+
+    // 정점 병합 + 캐시/오버드로우/fetch 재정렬 (캐시에는 최적화된 결과가 저장됨)
+    OptimizeSubmeshes(meshVertices, name);
+
+    if (meshVertices.empty() || indices.empty()) {
+        return false;
+    }
+
+    // 서브메시별 로컬 AABB (최적화로 정점 구간이 바뀐 뒤 계산)
+    ComputeSubmeshBounds(meshVertices);
+    LogSubmeshes(name, submeshes);
+
+    // 메시릿 (서브메시 구간마다 LOD0 인덱스를 메시릿 순서로 재배치) + LOD 체인 (LOD 인덱스는 indices 뒤에 이어 붙음)
+    // 인덱스가 메시 전체 기준이라 LOD 는 메시 전체를 한 번에 단순화 (서브메시끼리는 정점을 공유하지 않아 경계가 고정됨)
+    Meshlets::MeshletData meshlets;
+    BuildMeshlets(meshVertices, meshlets, name);
+
+    std::vector<MeshLod> lods;
+    MeshSimplifier::BuildLodChain(meshVertices, indices, lods);
+    LogLods(name, lods);
+
+    BoundingSphere localBounds;
+    BoundingSphere::CreateFromPoints(localBounds, meshVertices.size(), &meshVertices[0].position, sizeof(MeshVertex));
+
+    // 3) 다음 실행을 위해 캐시 기록 (실패해도 로드는 성공)
+    if (key.hasSource && !MeshCache::Write(key.cachePath, key.sourceHash, meshVertices, indices, submeshes, lods, meshlets, localBounds)) {
+        DebugManager::GetInstance().LogMessage(L"[Mesh] Failed to write cache " + key.cachePath.wstring());
+    }
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[Mesh] {} imported with Assimp in {:.2f} ms ({} vertices, {} indices)",
+        name, ms, meshVertices.size(), indices.size()));
+
+    outData.vertices = std::move(meshVertices);
+    outData.indices = indices;
+    outData.submeshes = submeshes;
+    outData.lods = std::move(lods);
+    outData.meshlets = std::move(meshlets);
+    outData.bounds = localBounds;
+    return true;
+}
+
+void ModelLoader::GenerateTangents(std::vector<MeshVertex>& meshVertices, ThreadPool* threadPool, const std::wstring& name)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // 인덱스가 메시 전체 기준이고 서브메시끼리 정점을 공유하지 않으므로 한 번에 생성
+    TangentGenerator::Generate(
+        meshVertices.data(), meshVertices.size(),
+        indices.data(), indices.size(),
+        tangentMode, threadPool);
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[Mesh] {} tangents generated in {:.2f} ms ({})",
+        name, ms, tangentMode == TangentGenerator::Mode::MikkTSpace ? L"MikkTSpace" : L"legacy"));
+}
+
+void ModelLoader::OptimizeSubmeshes(std::vector<MeshVertex>& meshVertices, const std::wstring& name)
+{
+    // 서브메시 단위로 최적화 (정점 구간 로컬 인덱스로 바꿔서 실행) 후 다시 메시 전체 기준으로 이어 붙임
+    std::vector<MeshVertex> optimizedVertices;
+    std::vector<uint32_t> optimizedIndices;
+    optimizedVertices.reserve(meshVertices.size());
+    optimizedIndices.reserve(indices.size());
+
+    // ACMR = misses / triangles, ATVR = misses / vertices 이므로 합산해서 메시 전체 값 계산
+    double missesBefore = 0.0, missesAfter = 0.0;
+    double verticesBefore = 0.0, verticesAfter = 0.0;
+    double triangleCount = 0.0;
+
+    for (size_t i = 0; i < submeshes.size(); ++i) {
+        MeshCache::SubmeshRecord& submesh = submeshes[i];
+
+        std::vector<MeshVertex> subVertices(meshVertices.begin() + submesh.baseVertex, meshVertices.begin() + submesh.baseVertex + submesh.vertexCount);
+        std::vector<uint32_t> subIndices(indices.begin() + submesh.indexStart, indices.begin() + submesh.indexStart + submesh.indexCount);
+        for (uint32_t& index : subIndices) {
+            index -= submesh.baseVertex;
+        }
+
+        // 빈 서브메시도 머티리얼 슬롯 순서를 위해 남겨 둠
+        submesh.baseVertex = static_cast<uint32_t>(optimizedVertices.size());
+        submesh.indexStart = static_cast<uint32_t>(optimizedIndices.size());
+        if (subVertices.empty() || subIndices.size() < 3) {
+            submesh.vertexCount = 0;
+            submesh.indexCount = 0;
+            continue;
+        }
+
+        MeshOptimizer::CacheStats before, after;
+        MeshOptimizer::Optimize(subVertices, subIndices, &before, &after);
+
+        const double triangles = double(subIndices.size() / 3);
+        triangleCount += triangles;
+        missesBefore += before.acmr * triangles;
+        missesAfter += after.acmr * triangles;
+        verticesBefore += before.atvr > 0.0f ? before.acmr * triangles / before.atvr : 0.0;
+        verticesAfter += after.atvr > 0.0f ? after.acmr * triangles / after.atvr : 0.0;
+
+        submesh.vertexCount = static_cast<uint32_t>(subVertices.size());
+        submesh.indexCount = static_cast<uint32_t>(subIndices.size());
+
+        optimizedVertices.insert(optimizedVertices.end(), subVertices.begin(), subVertices.end());
+        for (uint32_t index : subIndices) {
+            optimizedIndices.push_back(submesh.baseVertex + index);
+        }
+    }
+
+    if (triangleCount > 0.0) {
+        DebugManager::GetInstance().LogMessage(std::format(
+            L"[Mesh] {} optimized: vertices {} -> {}, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}",
+            name, meshVertices.size(), optimizedVertices.size(),
+            missesBefore / triangleCount, missesAfter / triangleCount,
+            verticesBefore > 0.0 ? missesBefore / verticesBefore : 0.0,
+            verticesAfter > 0.0 ? missesAfter / verticesAfter : 0.0));
+    }
+
+    meshVertices = std::move(optimizedVertices);
+    indices = std::move(optimizedIndices);
+}
+
+void ModelLoader::ComputeSubmeshBounds(const std::vector<MeshVertex>& meshVertices)
+{
+    for (MeshCache::SubmeshRecord& submesh : submeshes) {
+        XMFLOAT3 boundsMin = { 0.0f, 0.0f, 0.0f };
+        XMFLOAT3 boundsMax = { 0.0f, 0.0f, 0.0f };
+        if (submesh.vertexCount > 0) {
+            BoundingBox box;
+            BoundingBox::CreateFromPoints(box, submesh.vertexCount, &meshVertices[submesh.baseVertex].position, sizeof(MeshVertex));
+            boundsMin = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z };
+            boundsMax = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z };
+        }
+
+        submesh.boundsMin[0] = boundsMin.x; submesh.boundsMin[1] = boundsMin.y; submesh.boundsMin[2] = boundsMin.z;
+        submesh.boundsMax[0] = boundsMax.x; submesh.boundsMax[1] = boundsMax.y; submesh.boundsMax[2] = boundsMax.z;
+    }
+}
+
+void ModelLoader::BuildMeshlets(const std::vector<MeshVertex>& meshVertices, Meshlets::MeshletData& outMeshlets, const std::wstring& name)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // 서브메시마다 따로 만들어 메시릿이 서브메시 경계를 넘지 않도록 (서브메시 구간 = 메시릿 구간의 합)
+    for (const MeshCache::SubmeshRecord& submesh : submeshes) {
+        Meshlets::Build(meshVertices, indices, submesh.indexStart, submesh.indexCount, outMeshlets);
+    }
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    const size_t meshletCount = outMeshlets.meshlets.size();
+    if (meshletCount == 0) {
+        return;
+    }
+
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[Mesh] {} meshlets built in {:.2f} ms ({} meshlets, avg {:.1f} vertices / {:.1f} triangles)",
+        name, ms, meshletCount,
+        double(outMeshlets.vertices.size()) / meshletCount,
+        double(outMeshlets.triangles.size() / 3) / meshletCount));
+}
+
+void ModelLoader::LogSubmeshes(const std::wstring& name, const std::vector<MeshCache::SubmeshRecord>& submeshes)
+{
+    std::wstring summary;
+    for (const MeshCache::SubmeshRecord& submesh : submeshes) {
+        summary += std::format(L" [material {}: {} tris, {} vertices]", submesh.materialIndex, submesh.indexCount / 3, submesh.vertexCount);
+    }
+    DebugManager::GetInstance().LogMessage(std::format(L"[Mesh] {} submeshes:{}", name, summary));
+}
+
+void ModelLoader::LogLods(const std::wstring& name, const std::vector<MeshLod>& lods)
+{
+    std::wstring summary;
+    for (const MeshLod& lod : lods) {
+        summary += std::format(L" {}({:.4f})", lod.indexCount / 3, lod.error);
+    }
+    DebugManager::GetInstance().LogMessage(std::format(L"[Mesh] {} LOD triangles(error):{}", name, summary));
+}
+
+std::shared_ptr<Mesh> ModelLoader::LoadMeshFromCache(Renderer* renderer,
+    const std::filesystem::path& cachePath, const uint64_t* sourceHash)
+{
+    MeshCache::MappedFile file;
+    if (!file.Open(cachePath, sourceHash)) {
+        return nullptr;
+    }
+
+    const MeshCache::FileHeader& header = file.GetHeader();
+    submeshes.assign(file.GetSubmeshes(), file.GetSubmeshes() + header.submeshCount);
+    const std::vector<MeshLod> lods(file.GetLods(), file.GetLods() + header.lodCount);
+
+    // 매핑된 뷰에서 업로드 버퍼로 바로 복사 (UploadBuffers 가 Copy 큐 완료까지 대기하므로 이후 Unmap 해도 안전)
     auto mesh = std::make_shared<Mesh>();
-    
-    if (!mesh->Initialize(renderer, meshVertices, indices)) {
+    if (!mesh->Initialize(renderer,
+        file.GetVertices(), header.vertexCount,
+        file.GetIndices(), header.indexCount,
+        file.GetBounds(),
+        renderer->IsCompactVerticesEnabled() ? VertexFormat::Compact : VertexFormat::Full,
+        lods)) {
+        submeshes.clear();
         return nullptr;
     }
 
+    mesh->SetSubmeshes(submeshes);
+    if (header.meshletCount > 0) {
+        mesh->SetMeshlets(file.ReadMeshlets());
+    }
+
     return mesh;
 }
 
@@ -143,6 +374,13 @@ void ModelLoader::ProcessNode(aiNode* node, const aiScene* scene, const XMMATRIX
 }
 
 void ModelLoader::ProcessMesh(aiMesh* mesh, const aiScene* scene, const XMMATRIX& transform) {
+    // 정점은 이어 붙이고 인덱스는 baseVertex 만큼 더해 메시 전체 기준 값으로 기록
+    MeshCache::SubmeshRecord submesh{};
+    submesh.indexStart = static_cast<uint32_t>(indices.size());
+    submesh.baseVertex = static_cast<uint32_t>(vertices.size());
+    submesh.vertexCount = mesh->mNumVertices;
+    submesh.materialIndex = mesh->mMaterialIndex;
+
     for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
         Vertex vertex;
 
@@ -179,17 +417,25 @@ void ModelLoader::ProcessMesh(aiMesh* mesh, const aiScene* scene, const XMMATRIX
         vertices.push_back(vertex);
     }
 
+    // Triangulate 후에도 남는 점/선 프리미티브는 삼각형 리스트에 섞이지 않도록 제외
     for (unsigned int i = 0; i < mesh->mNumFaces; i++) {
-        aiFace face = mesh->mFaces[i];
+        const aiFace& face = mesh->mFaces[i];
+        if (face.mNumIndices != 3) {
+            continue;
+        }
         for (unsigned int j = 0; j < face.mNumIndices; j++) {
-            indices.push_back(face.mIndices[j]);
+            indices.push_back(submesh.baseVertex + face.mIndices[j]);
         }
     }
+
+    submesh.indexCount = static_cast<uint32_t>(indices.size()) - submesh.indexStart;
+    submeshes.push_back(submesh);
 }
 
 void ModelLoader::Clear() {
     vertices.clear();
     indices.clear();
+    submeshes.clear();
     needTangentFix = false;
 }
 
@@ -7,11 +7,15 @@
 #include <assimp/postprocess.h>
 #include <DirectXMath.h>
 #include <memory>
+#include "Mesh.h"
+#include "MeshCache.h"
+#include "TangentGenerator.h"
 
 using namespace DirectX;
 
 class Renderer;
 class Mesh;
+class ThreadPool;
 
 class ModelLoader {
 public:
@@ -26,22 +30,79 @@ public:
     ~ModelLoader() = default;
 
     bool LoadModel(const std::string& filePath);
+
+    // Cache/Meshes 의 바이너리 캐시가 유효하면 Assimp 없이 로드, 아니면 임포트 후 캐시 기록
     std::shared_ptr<Mesh> LoadMesh(Renderer* renderer, const std::string& filePath);
 
+    // LoadMesh 를 CPU / GPU 단계로 나눈 것 (AssetLoader 가 로더 스레드에서 LoadMeshData, 렌더 스레드에서 CreateMesh)
+    struct MeshData
+    {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+        std::vector<MeshCache::SubmeshRecord> submeshes;
+        std::vector<MeshLod> lods;
+        Meshlets::MeshletData meshlets;
+        BoundingSphere bounds;
+    };
+
+    // 캐시 읽기 또는 Assimp 임포트 + 캐시 기록 (Renderer 를 쓰지 않음)
+    // tangentPool: 탄젠트 생성용. ThreadPool 작업 안에서 부를 때는 Wait 교착을 피하도록 nullptr
+    bool LoadMeshData(const std::string& filePath, ThreadPool* tangentPool, MeshData& outData);
+    static std::shared_ptr<Mesh> CreateMesh(Renderer* renderer, const MeshData& data);
+
+    // Assimp 로 임포트했을 때만 채워짐 (캐시 히트 시 비어 있음)
     const std::vector<Vertex>& GetVertices() const;
     const std::vector<unsigned int>& GetIndices() const;
+    const std::vector<MeshCache::SubmeshRecord>& GetSubmeshes() const { return submeshes; }
+
+    // 소스에 탄젠트가 없을 때 생성 방식 (바뀌면 캐시 해시도 바뀜)
+    void SetTangentMode(TangentGenerator::Mode mode) { tangentMode = mode; }
 
 
 private:
+    struct CacheKey
+    {
+        std::filesystem::path sourcePath;
+        std::filesystem::path cachePath;
+        bool hasSource = false;
+        uint64_t sourceHash = 0;
+
+        const uint64_t* GetExpectedHash() const { return hasSource ? &sourceHash : nullptr; }
+    };
+    CacheKey MakeCacheKey(const std::string& filePath) const;
+
+    // Assimp 임포트 → 탄젠트 → 최적화 → 메시릿 / LOD → 캐시 기록
+    bool ImportMesh(const std::string& filePath, const CacheKey& key, ThreadPool* tangentPool, MeshData& outData);
+
     void ProcessNode(aiNode* node, const aiScene* scene, const XMMATRIX& parentTransform);
     void ProcessMesh(aiMesh* mesh, const aiScene* scene, const XMMATRIX& transform);
 
+    // 서브메시별 TangentGenerator 실행 (threadPool 이 있으면 병렬)
+    void GenerateTangents(std::vector<MeshVertex>& meshVertices, ThreadPool* threadPool, const std::wstring& name);
+
+    // 서브메시별 MeshOptimizer 실행 후 indices / submeshes 갱신
+    void OptimizeSubmeshes(std::vector<MeshVertex>& meshVertices, const std::wstring& name);
+
+    // 서브메시 정점 구간의 로컬 AABB 를 submeshes 에 기록
+    void ComputeSubmeshBounds(const std::vector<MeshVertex>& meshVertices);
+
+    // 서브메시마다 LOD0 를 메시릿으로 분할 (indices 의 각 서브메시 구간을 메시릿 순서로 재배치)
+    void BuildMeshlets(const std::vector<MeshVertex>& meshVertices, Meshlets::MeshletData& outMeshlets, const std::wstring& name);
+
+    static void LogSubmeshes(const std::wstring& name, const std::vector<MeshCache::SubmeshRecord>& submeshes);
+    static void LogLods(const std::wstring& name, const std::vector<MeshLod>& lods);
+
+    std::shared_ptr<Mesh> LoadMeshFromCache(Renderer* renderer,
+        const std::filesystem::path& cachePath, const uint64_t* sourceHash);
+
     void Clear();
 
     std::vector<Vertex> vertices;
     std::vector<unsigned int> indices;
+    std::vector<MeshCache::SubmeshRecord> submeshes;
 
     bool needTangentFix = false;
+    TangentGenerator::Mode tangentMode = TangentGenerator::Mode::Legacy;
 
     Assimp::Importer importer;
 };
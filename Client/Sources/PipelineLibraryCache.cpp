@@ -0,0 +1,265 @@
+#include "PipelineLibraryCache.h"
+#include "HashUtil.h"
+#include <fstream>
+#include <filesystem>
+#include <cassert>
+
+bool PipelineLibraryCache::Initialize(ID3D12Device* device, const std::wstring& cacheFilePath)
+{
+    filePath = cacheFilePath;
+
+    // ID3D12PipelineLibrary 는 ID3D12Device1 이상 필요
+    if (FAILED(device->QueryInterface(IID_PPV_ARGS(&device1))))
+        return false;
+
+    D3D12_FEATURE_DATA_SHADER_CACHE shaderCache{};
+    if (FAILED(device1->CheckFeatureSupport(D3D12_FEATURE_SHADER_CACHE, &shaderCache, sizeof(shaderCache)))
+        || !(shaderCache.SupportFlags & D3D12_SHADER_CACHE_SUPPORT_LIBRARY))
+    {
+        device1.Reset();
+        return false;
+    }
+
+    if (ReadCacheFile())
+        return true;
+
+    return CreateEmptyLibrary();
+}
+
+bool PipelineLibraryCache::ReadCacheFile()
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file)
+        return false;
+
+    FileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != FileMagic || header.version != FileVersion)
+        return false;
+
+    std::unordered_set<std::wstring> keys;
+    for (uint32_t i = 0; i < header.keyCount; ++i)
+    {
+        uint32_t length = 0;
+        file.read(reinterpret_cast<char*>(&length), sizeof(length));
+        std::wstring key(length, L'\0');
+        file.read(reinterpret_cast<char*>(key.data()), length * sizeof(wchar_t));
+        if (!file)
+            return false;
+        keys.insert(std::move(key));
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(header.libraryBytes));
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+    if (!file)
+        return false;
+
+    // 드라이버 버전/어댑터가 다르면 실패 (D3D12_ERROR_DRIVER_VERSION_MISMATCH 등)
+    ComPtr<ID3D12PipelineLibrary> loaded;
+    if (FAILED(device1->CreatePipelineLibrary(data.data(), data.size(), IID_PPV_ARGS(&loaded))))
+        return false;
+
+    libraryData = std::move(data);
+    library = loaded;
+    storedKeys = std::move(keys);
+    return true;
+}
+
+bool PipelineLibraryCache::CreateEmptyLibrary()
+{
+    libraryData.clear();
+    storedKeys.clear();
+    library.Reset();
+
+    if (FAILED(device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&library))))
+        return false;
+
+    dirty = true;
+    return true;
+}
+
+ComPtr<ID3D12PipelineState> PipelineLibraryCache::LoadOrCreate(
+    const PipelineStateDesc& desc,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC& psoDesc,
+    bool* outCacheHit)
+{
+    assert(library && "PipelineLibraryCache is not initialized");
+
+    if (outCacheHit)
+        *outCacheHit = false;
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    const std::wstring key = desc.name + L"_" + HashToHex(HashDesc(desc));
+
+    // 1) 캐시 히트
+    bool stored = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stored = storedKeys.contains(key);
+    }
+
+    if (stored &&
+        SUCCEEDED(library->LoadGraphicsPipeline(key.c_str(), &psoDesc, IID_PPV_ARGS(&pipelineState))))
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++hitCount;
+        usedPipelines[key] = pipelineState;
+        if (outCacheHit)
+            *outCacheHit = true;
+        return pipelineState;
+    }
+
+    // 2) 미스: 새로 생성 후 라이브러리에 저장
+    if (FAILED(device1->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState))))
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++missCount;
+
+    // 같은 키가 다른 desc(루트 시그니처 변경 등)로 저장되어 있으면 E_INVALIDARG → 저장 시 재구성
+    if (FAILED(library->StorePipeline(key.c_str(), pipelineState.Get())))
+        needsRebuild = true;
+
+    storedKeys.insert(key);
+    usedPipelines[key] = pipelineState;
+    dirty = true;
+    return pipelineState;
+}
+
+bool PipelineLibraryCache::Save(bool pruneUnused)
+{
+    if (!library)
+        return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // 이번 실행에서 쓰이지 않은 항목이 남아있으면 stale 로 보고 정리
+    if (pruneUnused)
+    {
+        for (const auto& key : storedKeys)
+        {
+            if (!usedPipelines.contains(key))
+            {
+                needsRebuild = true;
+                break;
+            }
+        }
+    }
+
+    // 재구성은 쓰이지 않은 항목을 잃으므로 정리할 때만 (그 전에는 있는 그대로 기록)
+    const bool rebuild = needsRebuild && pruneUnused;
+    if (!dirty && !rebuild)
+        return true;
+
+    if (rebuild)
+    {
+        ComPtr<ID3D12PipelineLibrary> rebuilt;
+        if (FAILED(device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&rebuilt))))
+            return false;
+
+        for (const auto& [key, pipelineState] : usedPipelines)
+            rebuilt->StorePipeline(key.c_str(), pipelineState.Get());
+
+        library = rebuilt;
+        storedKeys.clear();
+        for (const auto& [key, pipelineState] : usedPipelines)
+            storedKeys.insert(key);
+        needsRebuild = false;
+    }
+
+    const SIZE_T librarySize = library->GetSerializedSize();
+    std::vector<uint8_t> serialized(librarySize);
+    if (FAILED(library->Serialize(serialized.data(), librarySize)))
+        return false;
+
+    std::filesystem::create_directories(std::filesystem::path(filePath).parent_path());
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    FileHeader header{};
+    header.magic = FileMagic;
+    header.version = FileVersion;
+    header.keyCount = static_cast<uint32_t>(storedKeys.size());
+    header.libraryBytes = librarySize;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const auto& key : storedKeys)
+    {
+        const uint32_t length = static_cast<uint32_t>(key.size());
+        file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        file.write(reinterpret_cast<const char*>(key.data()), length * sizeof(wchar_t));
+    }
+    file.write(reinterpret_cast<const char*>(serialized.data()), serialized.size());
+
+    dirty = false;
+    return static_cast<bool>(file);
+}
+
+uint64_t PipelineLibraryCache::HashDesc(const PipelineStateDesc& desc)
+{
+    Hasher hasher;
+
+    // 셰이더 바이트코드
+    for (const auto& blob : { desc.vsBlob, desc.gsBlob, desc.psBlob })
+    {
+        if (blob)
+            hasher.Add(blob->GetBufferPointer(), blob->GetBufferSize());
+        hasher.AddValue(blob ? blob->GetBufferSize() : SIZE_T(0));
+    }
+
+    // 입력 레이아웃
+    for (const auto& element : desc.inputLayout)
+    {
+        hasher.AddString(std::string_view(element.SemanticName));
+        hasher.AddValue(element.SemanticIndex);
+        hasher.AddValue(element.Format);
+        hasher.AddValue(element.InputSlot);
+        hasher.AddValue(element.AlignedByteOffset);
+        hasher.AddValue(element.InputSlotClass);
+        hasher.AddValue(element.InstanceDataStepRate);
+    }
+
+    // 래스터라이저 (4바이트 필드만 있어 통째로 해시 가능)
+    hasher.AddValue(desc.rasterizerDesc);
+
+    // 블렌드 (UINT8 필드 뒤 패딩이 있어 필드 단위로)
+    hasher.AddValue(desc.blendDesc.AlphaToCoverageEnable);
+    hasher.AddValue(desc.blendDesc.IndependentBlendEnable);
+    for (const auto& rt : desc.blendDesc.RenderTarget)
+    {
+        hasher.AddValue(rt.BlendEnable);
+        hasher.AddValue(rt.LogicOpEnable);
+        hasher.AddValue(rt.SrcBlend);
+        hasher.AddValue(rt.DestBlend);
+        hasher.AddValue(rt.BlendOp);
+        hasher.AddValue(rt.SrcBlendAlpha);
+        hasher.AddValue(rt.DestBlendAlpha);
+        hasher.AddValue(rt.BlendOpAlpha);
+        hasher.AddValue(rt.LogicOp);
+        hasher.AddValue(rt.RenderTargetWriteMask);
+    }
+
+    // 깊이/스텐실
+    const auto& ds = desc.depthStencilDesc;
+    hasher.AddValue(ds.DepthEnable);
+    hasher.AddValue(ds.DepthWriteMask);
+    hasher.AddValue(ds.DepthFunc);
+    hasher.AddValue(ds.StencilEnable);
+    hasher.AddValue(ds.StencilReadMask);
+    hasher.AddValue(ds.StencilWriteMask);
+    hasher.AddValue(ds.FrontFace);
+    hasher.AddValue(ds.BackFace);
+
+    // 출력 포맷 / 기타
+    hasher.AddValue(desc.numRenderTargets);
+    for (UINT i = 0; i < desc.numRenderTargets; ++i)
+        hasher.AddValue(desc.rtvFormats[i]);
+    hasher.AddValue(desc.dsvFormat);
+    hasher.AddValue(desc.topologyType);
+    hasher.AddValue(desc.sampleMask);
+    hasher.AddValue(desc.sampleDesc);
+
+    return hasher.Value();
+}
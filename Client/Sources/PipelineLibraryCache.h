@@ -0,0 +1,79 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdint>
+#include <mutex>
+
+#include "PipelineStateDesc.h"
+
+using Microsoft::WRL::ComPtr;
+
+// ---------------------------------------------------------------------------
+// PipelineLibraryCache
+// ID3D12PipelineLibrary 를 파일로 직렬화하여 다음 실행 때 PSO 생성을 건너뛴다.
+//   - 키: PSO 이름 + PipelineStateDesc(셰이더 바이트코드 포함) 해시
+//     → 셰이더나 상태가 바뀌면 키가 달라져 자동으로 새로 생성됨
+//   - 종료 시 저장(Save(true))에서만 이번 실행에 쓰이지 않은 항목(stale)을 정리
+//     (초기화 직후 저장은 나중에 요청될 퍼뮤테이션 PSO 를 지우지 않도록 정리하지 않음)
+//   - 드라이버/어댑터가 바뀌어 라이브러리를 못 읽으면 빈 캐시로 시작
+// ---------------------------------------------------------------------------
+class PipelineLibraryCache
+{
+public:
+    bool Initialize(ID3D12Device* device, const std::wstring& cacheFilePath);
+
+    // 캐시에 있으면 로드, 없으면 생성 후 라이브러리에 저장 (IsEnabled() 일 때만 호출)
+    // 여러 스레드에서 동시에 호출 가능 (PSO 생성 자체는 잠금 밖에서 진행)
+    ComPtr<ID3D12PipelineState> LoadOrCreate(
+        const PipelineStateDesc& desc,
+        const D3D12_GRAPHICS_PIPELINE_STATE_DESC& psoDesc,
+        bool* outCacheHit = nullptr);
+
+    // 변경 사항이 있을 때만 파일에 기록 (pruneUnused: 이번 실행에서 쓰이지 않은 항목 제거)
+    bool Save(bool pruneUnused);
+
+    bool IsEnabled() const { return library != nullptr; }
+    UINT GetHitCount() const { return hitCount; }
+    UINT GetMissCount() const { return missCount; }
+
+    static uint64_t HashDesc(const PipelineStateDesc& desc);
+
+private:
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t keyCount;
+        uint32_t reserved;
+        uint64_t libraryBytes;
+    };
+
+    static constexpr uint32_t FileMagic = 0x434F5350;   // 'PSOC'
+    static constexpr uint32_t FileVersion = 1;
+
+    bool ReadCacheFile();
+    bool CreateEmptyLibrary();
+
+    ComPtr<ID3D12Device1> device1;
+    ComPtr<ID3D12PipelineLibrary> library;
+    std::wstring filePath;
+
+    // 라이브러리는 생성에 쓰인 메모리를 계속 참조하므로 살려둔다
+    std::vector<uint8_t> libraryData;
+
+    std::unordered_set<std::wstring> storedKeys;        // 파일에서 읽은 키
+    std::unordered_map<std::wstring, ComPtr<ID3D12PipelineState>> usedPipelines;   // 이번 실행에서 사용한 키
+
+    // storedKeys / usedPipelines / 카운터 / StorePipeline 보호
+    std::mutex mutex;
+
+    bool dirty = false;
+    bool needsRebuild = false;
+    UINT hitCount = 0;
+    UINT missCount = 0;
+};
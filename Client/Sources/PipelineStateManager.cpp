@@ -3,8 +3,34 @@
 #include <stdexcept>
 #include <format>
 #include <codecvt>
+#include <chrono>
+#include "DebugManager.h"
+#include "ThreadPool.h"
 
 
+namespace
+{
+    // PipelineStateId 순서와 동일
+    constexpr const wchar_t* PipelineStateNames[] = {
+        L"TrianglePSO",
+        L"PhongPSO",
+        L"PbrPSO",
+        L"PbrBindlessPSO",
+        L"SkyboxPSO",
+        L"DebugNormalPSO",
+        L"OutlinePostEffectPSO",
+        L"ToneMappingPostEffectPSO",
+        L"ShadowMapPassPSO",
+        L"ShadowMapInstancedPSO",
+        L"PbrCompactPSO",
+        L"PbrBindlessCompactPSO",
+        L"ShadowMapPassCompactPSO",
+        L"ShadowMapInstancedCompactPSO",
+        L"ShadowTileCopyPSO",
+    };
+    static_assert(_countof(PipelineStateNames) == static_cast<size_t>(PipelineStateId::Count));
+}
+
 PipelineStateManager::PipelineStateManager(Renderer* renderer_)
     : renderer(renderer_)
     , device(renderer_->GetDevice())
@@ -14,65 +40,90 @@ PipelineStateManager::~PipelineStateManager() {
     Cleanup();
 }
 
-bool PipelineStateManager::InitializePSOs()
+bool PipelineStateManager::InitializePSOs(ThreadPool* threadPool)
 {
     psoMap.clear();         // 캐시 비우기
+    permutationPool = std::make_unique<ThreadPool>(PermutationThreadCount, true);
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    // 디스크 캐시 로드 (지원 안 하면 매번 생성)
+    if (!pipelineCache.Initialize(device, PipelineCachePath))
+        DebugManager::GetInstance().LogMessage(L"[PSO] PipelineLibrary not supported, cache disabled");
+
+    // 1) desc 구성 (메인 스레드): 루트 시그니처 / 셰이더가 모두 준비된 뒤여야 한다
+    std::vector<PipelineStateDesc> descs;
+    descs.push_back(CreateTrianglePSODesc());               // 1. Triangle
+    descs.push_back(CreatePhongPSODesc());                  // 2. Phong-Lighting
+    descs.push_back(CreatePbrPSODesc());                    // 3. PBR-Lighting
+    descs.push_back(CreatePbrBindlessPSODesc());            // 3-1. PBR-Lighting (bindless 머티리얼)
+    descs.push_back(CreateSkyboxPSODesc());                 // 4. Skybox
+    descs.push_back(CreateDebugNormalPSODesc());            // 5. 노말 디버그용 PSO
+    descs.push_back(CreateOutlinePostEffectPSODesc());      // 6. OutlinePostEffect PSO
+    descs.push_back(CreateToneMappingPostEffectPSODesc());  // 7. ToneMappingPostEffect PSO
+    descs.push_back(CreateShadowMapPassPSODesc());          // 8. ShadowMapPass PSO
+    descs.push_back(CreateShadowMapInstancedPSODesc());     // 8-1. ShadowMapPass PSO (면 인스턴싱)
+
+    // 9. CompactMeshVertex 메시용 (상태는 위와 동일, VS/입력 레이아웃만 다름)
+    descs.push_back(ToCompactVertexDesc(CreatePbrPSODesc(), L"PbrCompactPSO", L"PbrCompactVS", false));
+    descs.push_back(ToCompactVertexDesc(CreatePbrBindlessPSODesc(), L"PbrBindlessCompactPSO", L"PbrCompactVS", false));
+    descs.push_back(ToCompactVertexDesc(CreateShadowMapPassPSODesc(), L"ShadowMapPassCompactPSO", L"ShadowMapPassCompactVS", true));
+    descs.push_back(ToCompactVertexDesc(CreateShadowMapInstancedPSODesc(), L"ShadowMapInstancedCompactPSO", L"ShadowMapInstancedCompactVS", true));
+
+    descs.push_back(CreateShadowTileCopyPSODesc());         // 10. 정적 섀도우 레이어 타일 복사
+
+    const auto descTime = std::chrono::high_resolution_clock::now();
+
+    // 2) PSO 생성: 서로 의존성이 없으므로 병렬 (device / PipelineLibraryCache 는 스레드 안전)
+    std::vector<ComPtr<ID3D12PipelineState>> pipelineStates(descs.size());
+    auto buildJob = [this, &descs, &pipelineStates](size_t index) {
+        try {
+            pipelineStates[index] = BuildPipelineState(descs[index]);
+        }
+        catch (const std::exception&) {
+            pipelineStates[index].Reset();      // 에러 보고는 메인 스레드에서
+        }
+    };
 
-    // 1. Triangle
-    {
-        PipelineStateDesc desc = CreateTrianglePSODesc();
-        if (GetOrCreate(desc) == nullptr)
-            return false;
-    }
-
-    // 2. Phong-Lighting
-    {
-        PipelineStateDesc desc = CreatePhongPSODesc();
-        if (GetOrCreate(desc) == nullptr)
-            return false;
-    }
-
-    // 3. PBR-Lighting
-    {
-        PipelineStateDesc desc = CreatePbrPSODesc();
-        if (GetOrCreate(desc) == nullptr)
-            return false;
-    }
-
-    // 4. Skybox
-    {
-        PipelineStateDesc desc = CreateSkyboxPSODesc();
-        if (GetOrCreate(desc) == nullptr)
-            return false;
+    if (threadPool && descs.size() > 1) {
+        for (size_t i = 0; i < descs.size(); ++i)
+            threadPool->Submit([&buildJob, i]() { buildJob(i); });
+        threadPool->Wait();
     }
-
-    // 5. 노말 디버그용 PSO
-    {
-        PipelineStateDesc desc = CreateDebugNormalPSODesc();
-        if (GetOrCreate(desc) == nullptr)
-            return false;
+    else {
+        for (size_t i = 0; i < descs.size(); ++i)
+            buildJob(i);
     }
 
-    // 6. OutlinePostEffect PSO
-    {
-        PipelineStateDesc desc = CreateOutlinePostEffectPSODesc();
-        if (GetOrCreate(desc) == nullptr)
+    // 3) 결과 등록 (메인 스레드)
+    for (size_t i = 0; i < descs.size(); ++i) {
+        if (!pipelineStates[i]) {
+            DebugManager::GetInstance().LogMessage(L"[PSO] Failed to create " + descs[i].name);
             return false;
+        }
+        psoMap[descs[i].name] = pipelineStates[i];
     }
 
-    // 7. ToneMappingPostEffect PSO
-    {
-        PipelineStateDesc desc = CreateToneMappingPostEffectPSODesc();
-        if (GetOrCreate(desc) == nullptr)
-            return false;
-    }
-
-    // 8. ShadowMapPass PSO
-    {
-        PipelineStateDesc desc = CreateShadowMapPassPSODesc();
-        if (GetOrCreate(desc) == nullptr)
-            return false;
-    }
+    // 핸들 테이블 갱신 (이후 드로우 경로는 배열 조회만)
+    for (size_t i = 0; i < pipelineHandles.size(); ++i)
+        pipelineHandles[i] = Get(PipelineStateNames[i]);
+
+    // 캐시 저장 + 시작 시간 리포트 (hit 0 = cold, miss 0 = warm)
+    // 퍼뮤테이션은 아직 요청 전이므로 stale 정리는 종료 시에만
+    if (pipelineCache.IsEnabled())
+        pipelineCache.Save(false);
+
+    const auto endTime = std::chrono::high_resolution_clock::now();
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[PSO] InitializePSOs: {:.2f} ms (desc {:.2f} ms, create {:.2f} ms on {} threads, {} PSOs, cache hit {}, miss {}, {})",
+        std::chrono::duration<double, std::milli>(endTime - startTime).count(),
+        std::chrono::duration<double, std::milli>(descTime - startTime).count(),
+        std::chrono::duration<double, std::milli>(endTime - descTime).count(),
+        threadPool ? threadPool->GetThreadCount() : 1,
+        psoMap.size(),
+        pipelineCache.GetHitCount(),
+        pipelineCache.GetMissCount(),
+        pipelineCache.GetMissCount() == 0 && pipelineCache.IsEnabled() ? L"warm" : L"cold"));
 
     return true;
 }
@@ -209,6 +260,22 @@ PipelineStateDesc PipelineStateManager::CreatePbrPSODesc() const
     return desc;
 }
 
+PipelineStateDesc PipelineStateManager::CreatePbrBindlessPSODesc() const
+{
+    // VS 와 InputLayout 은 PbrPSO 와 동일, PS 만 BINDLESS_MATERIALS 버전
+    PipelineStateDesc desc = CreatePbrPSODesc();
+
+    auto rs = renderer->GetRootSignatureManager()->Get(L"PbrBindlessRS");
+    if (!rs)
+        throw std::runtime_error("PbrBindlessRS not created");
+
+    desc.name = L"PbrBindlessPSO";
+    desc.rootSignature = rs;
+    desc.psBlob = renderer->GetShaderManager()->GetShaderBlob(L"PbrBindlessPS");
+
+    return desc;
+}
+
 PipelineStateDesc PipelineStateManager::CreateSkyboxPSODesc() const
 {
     auto rootSig = renderer->GetRootSignatureManager()->Get(L"SkyboxRS");
@@ -446,6 +513,81 @@ PipelineStateDesc PipelineStateManager::CreateShadowMapPassPSODesc() const
     return desc;
 }
 
+PipelineStateDesc PipelineStateManager::CreateShadowMapInstancedPSODesc() const
+{
+    // ShadowMapPass PSO 와 같은 상태, 셰이더/루트 시그니처만 다름
+    PipelineStateDesc desc = CreateShadowMapPassPSODesc();
+
+    auto rootSig = renderer->GetRootSignatureManager()->Get(L"ShadowMapInstancedRS");
+    if (!rootSig)
+        throw std::runtime_error("ShadowMapInstancedRS not created");
+
+    desc.name = L"ShadowMapInstancedPSO";
+    desc.rootSignature = rootSig;
+    desc.vsBlob = renderer->GetShaderManager()->GetShaderBlob(L"ShadowMapInstancedVS");
+    desc.psBlob = renderer->GetShaderManager()->GetShaderBlob(L"ShadowMapInstancedPS");
+
+    return desc;
+}
+
+PipelineStateDesc PipelineStateManager::ToCompactVertexDesc(
+    PipelineStateDesc desc, const wchar_t* name, const wchar_t* vsName, bool positionOnly) const
+{
+    // CompactMeshVertex (VertexCompression.h) 와 오프셋을 맞출 것
+    std::vector<D3D12_INPUT_ELEMENT_DESC> inputLayout =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0,  0,
+          D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+    };
+
+    if (!positionOnly) {
+        inputLayout.push_back({ "NORMAL",   0, DXGI_FORMAT_R16G16_SNORM, 0,  8,
+            D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 });
+        inputLayout.push_back({ "TANGENT",  0, DXGI_FORMAT_R16G16_SNORM, 0, 12,
+            D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 });
+        inputLayout.push_back({ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 16,
+            D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 });
+    }
+
+    desc.name = name;
+    desc.vsBlob = renderer->GetShaderManager()->GetShaderBlob(vsName);
+    desc.inputLayout = std::move(inputLayout);
+
+    return desc;
+}
+
+PipelineStateDesc PipelineStateManager::CreateShadowTileCopyPSODesc() const
+{
+    auto rootSig = renderer->GetRootSignatureManager()->Get(L"ShadowTileCopyRS");
+    if (!rootSig)
+        throw std::runtime_error("ShadowTileCopyRS not created");
+
+    PipelineStateDesc desc;
+    desc.name = L"ShadowTileCopyPSO";
+    desc.rootSignature = rootSig;
+    desc.vsBlob = renderer->GetShaderManager()->GetShaderBlob(L"ShadowTileCopyVS");
+    desc.psBlob = renderer->GetShaderManager()->GetShaderBlob(L"ShadowTileCopyPS");
+    desc.topologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;     // 입력 레이아웃 없음 (SV_VertexID)
+
+    // 깊이만 기록, RTV 없음
+    desc.rtvFormats[0] = DXGI_FORMAT_UNKNOWN;
+    desc.numRenderTargets = 0;
+
+    // 타일 안의 기존 깊이와 무관하게 덮어씀 (클리어 + 복사)
+    desc.depthStencilDesc = CD3DX12_DEPTH_STENCIL_DESC(D3D12_DEFAULT);
+    desc.depthStencilDesc.DepthEnable = TRUE;
+    desc.depthStencilDesc.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
+    desc.depthStencilDesc.DepthFunc = D3D12_COMPARISON_FUNC_ALWAYS;
+    desc.depthStencilDesc.StencilEnable = FALSE;
+
+    desc.rasterizerDesc = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
+    desc.rasterizerDesc.CullMode = D3D12_CULL_MODE_NONE;
+    desc.sampleMask = UINT_MAX;
+    desc.sampleDesc.Count = 1;
+
+    return desc;
+}
+
 PipelineStateDesc PipelineStateManager::CreateVolumetricCloudPSODesc() const
 {
 
@@ -512,8 +654,103 @@ ID3D12PipelineState* PipelineStateManager::GetOrCreate(
     return psoMap[desc.name].Get();
 }
 
+ID3D12PipelineState* PipelineStateManager::GetPbrPermutation(uint32_t featureMask, bool bindless, bool compactVertex) const
+{
+    const size_t variant = GetPbrVariant(bindless, compactVertex);
+    if (ID3D12PipelineState* permutation =
+        pbrPermutationHandles[variant][featureMask & MATERIAL_FEATURE_MASK].load(std::memory_order_acquire))
+        return permutation;
+
+    // 아직 생성 중이거나 실패: 런타임 분기하는 기본 PSO
+    static constexpr PipelineStateId BaseIds[PbrVariantCount] = {
+        PipelineStateId::PbrPSO,
+        PipelineStateId::PbrBindlessPSO,
+        PipelineStateId::PbrCompactPSO,
+        PipelineStateId::PbrBindlessCompactPSO,
+    };
+    return Get(BaseIds[variant]);
+}
+
+void PipelineStateManager::PrebuildPbrPermutations(uint32_t featureMasks)
+{
+    featureMasks &= (1u << MATERIAL_FEATURE_PERMUTATION_COUNT) - 1;
+    const uint32_t newMasks = featureMasks & ~requestedFeatureMasks;
+    if (newMasks == 0)
+        return;
+    requestedFeatureMasks |= newMasks;
+
+    // desc 는 렌더 스레드에서 구성 (루트 시그니처 / 기본 셰이더 조회), PS 컴파일과 PSO 생성은 풀에서
+    const PipelineStateDesc baseDescs[PbrVariantCount] = {
+        CreatePbrPSODesc(),
+        CreatePbrBindlessPSODesc(),
+        ToCompactVertexDesc(CreatePbrPSODesc(), L"PbrCompactPSO", L"PbrCompactVS", false),
+        ToCompactVertexDesc(CreatePbrBindlessPSODesc(), L"PbrBindlessCompactPSO", L"PbrCompactVS", false),
+    };
+
+    for (uint32_t featureMask = 0; featureMask < MATERIAL_FEATURE_PERMUTATION_COUNT; ++featureMask)
+    {
+        if (!(newMasks & (1u << featureMask)))
+            continue;
+
+        for (size_t variant = 0; variant < PbrVariantCount; ++variant)
+        {
+            permutationPool->Submit([this, variant, featureMask, desc = baseDescs[variant]]() mutable {
+                BuildPbrPermutation(variant, featureMask, std::move(desc));
+            });
+        }
+    }
+}
+
+void PipelineStateManager::BuildPbrPermutation(size_t variant, uint32_t featureMask, PipelineStateDesc desc)
+{
+    // MATERIAL_FEATURES define 값 (D3D_SHADER_MACRO 가 포인터만 보관하므로 정적 문자열)
+    static const char* const FeatureMaskDefines[] = {
+        "0", "1", "2", "3", "4", "5", "6", "7",
+        "8", "9", "10", "11", "12", "13", "14", "15"
+    };
+    static_assert(_countof(FeatureMaskDefines) == MATERIAL_FEATURE_PERMUTATION_COUNT);
+
+    const bool bindless = (variant & 1) != 0;
+    const std::wstring suffix = L"F" + std::to_wstring(featureMask);
+    const std::wstring name = desc.name + L"_" + suffix;
+
+    try {
+        // 1) PS 만 특수화, 나머지 상태는 기본 PBR PSO 와 동일
+        ComPtr<ID3DBlob> psBlob = renderer->GetShaderManager()->GetOrCompilePermutation(
+            bindless ? L"PbrBindlessPS" : L"PbrPS",
+            suffix,
+            { { "MATERIAL_FEATURES", FeatureMaskDefines[featureMask] } });
+
+        // 2) 변형을 만들 수 없으면 기본 PSO 를 계속 사용
+        if (psBlob) {
+            desc.name = name;
+            desc.psBlob = psBlob;
+
+            bool cacheHit = false;
+            ComPtr<ID3D12PipelineState> permutation = BuildPipelineState(desc, &cacheHit);
+
+            pbrPermutationStates[variant][featureMask] = permutation;
+            pbrPermutationHandles[variant][featureMask].store(permutation.Get(), std::memory_order_release);
+
+            DebugManager::GetInstance().LogMessage(std::format(L"[PSO] Permutation {} ready (cache {})",
+                name, !pipelineCache.IsEnabled() ? L"disabled" : cacheHit ? L"hit" : L"miss"));
+        }
+    }
+    catch (const std::exception&) {
+        DebugManager::GetInstance().LogMessage(L"[PSO] Failed to create permutation " + name);
+    }
+}
+
 bool PipelineStateManager::CreatePSO(
     const PipelineStateDesc& desc)
+{
+    psoMap[desc.name] = BuildPipelineState(desc);
+    return true;
+}
+
+ComPtr<ID3D12PipelineState> PipelineStateManager::BuildPipelineState(
+    const PipelineStateDesc& desc,
+    bool* outCacheHit)
 {
     D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
     psoDesc.pRootSignature = desc.rootSignature.Get();
@@ -539,13 +776,18 @@ bool PipelineStateManager::CreatePSO(
     psoDesc.Flags = D3D12_PIPELINE_STATE_FLAG_NONE;
 
     ComPtr<ID3D12PipelineState> pipelineState;
-    HRESULT hr = device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState));
-    if (FAILED(hr)) {
-        throw std::runtime_error("CreateGraphicsPipelineState failed");
+    if (pipelineCache.IsEnabled()) {
+        pipelineState = pipelineCache.LoadOrCreate(desc, psoDesc, outCacheHit);
+        if (!pipelineState)
+            throw std::runtime_error("CreateGraphicsPipelineState failed");
     }
-    psoMap[desc.name] = pipelineState;
-
-    return true;
+    else {
+        HRESULT hr = device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState));
+        if (FAILED(hr)) {
+            throw std::runtime_error("CreateGraphicsPipelineState failed");
+        }
+    }
+    return pipelineState;
 }
 
 ID3D12PipelineState* PipelineStateManager::Get(
@@ -555,8 +797,30 @@ ID3D12PipelineState* PipelineStateManager::Get(
     return it != psoMap.end() ? it->second.Get() : nullptr;
 }
 
+const wchar_t* PipelineStateManager::GetName(PipelineStateId id)
+{
+    return PipelineStateNames[static_cast<size_t>(id)];
+}
+
 void PipelineStateManager::Cleanup() {
+    // 풀에서 생성 중인 퍼뮤테이션이 끝나야 캐시에 모두 들어간다
+    if (permutationPool)
+        permutationPool->Wait();
+    permutationPool.reset();
+
+    // 초기화 이후 추가된 PSO / 퍼뮤테이션도 저장하고, 이번 실행에서 쓰이지 않은 항목은 정리
+    if (pipelineCache.IsEnabled())
+        pipelineCache.Save(true);
+
     psoMap.clear();
+    pipelineHandles.fill(nullptr);
+    for (size_t variant = 0; variant < PbrVariantCount; ++variant) {
+        for (auto& handle : pbrPermutationHandles[variant])
+            handle.store(nullptr, std::memory_order_relaxed);
+        for (auto& permutation : pbrPermutationStates[variant])
+            permutation.Reset();
+    }
+    requestedFeatureMasks = 0;
     renderer = nullptr;
     device = nullptr;
 }
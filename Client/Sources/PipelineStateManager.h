@@ -2,15 +2,42 @@
 
 #include <d3d12.h>
 #include <wrl.h>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "PipelineStateDesc.h"
+#include "PipelineLibraryCache.h"
+#include "ConstantBuffers.h"
 
 using Microsoft::WRL::ComPtr;
 
 class Renderer;
+class ThreadPool;
+
+// 드로우 경로용 정수 핸들 (초기화 후 배열 조회만 하므로 문자열 해시 없음)
+// PipelineStateNames 와 순서를 맞출 것
+enum class PipelineStateId : uint8_t {
+    TrianglePSO = 0,
+    PhongPSO,
+    PbrPSO,
+    PbrBindlessPSO,
+    SkyboxPSO,
+    DebugNormalPSO,
+    OutlinePostEffectPSO,
+    ToneMappingPostEffectPSO,
+    ShadowMapPassPSO,
+    ShadowMapInstancedPSO,
+    PbrCompactPSO,
+    PbrBindlessCompactPSO,
+    ShadowMapPassCompactPSO,
+    ShadowMapInstancedCompactPSO,
+    ShadowTileCopyPSO,
+    Count
+};
 
 class PipelineStateManager {
 public:
@@ -19,14 +46,29 @@ public:
     ~PipelineStateManager();
 
     // 초기화 단계에서 전용 PSO 생성
-    bool InitializePSOs();
+    // desc 는 메인 스레드에서 구성하고, 생성은 threadPool 에서 병렬 (nullptr 이면 순차)
+    // threadPool 은 초기화 동안에만 쓰고, 이후 퍼뮤테이션은 전용 풀에서 만든다
+    bool InitializePSOs(ThreadPool* threadPool = nullptr);
 
     // 필요 시 PSO를 생성하거나 기존 캐시 반환
     ID3D12PipelineState* GetOrCreate(const PipelineStateDesc& desc);
 
-    // 캐시된 PSO 직접 조회
+    // 캐시된 PSO 직접 조회 (툴/디버그용)
     ID3D12PipelineState* Get(const std::wstring& name) const;
 
+    // 핸들 조회 (핫패스용, O(1))
+    ID3D12PipelineState* Get(PipelineStateId id) const { return pipelineHandles[static_cast<size_t>(id)]; }
+
+    static const wchar_t* GetName(PipelineStateId id);
+
+    // 머티리얼 feature mask(USE_*_MAP)로 특수화된 PBR PSO (드로우 경로, 여러 스레드에서 호출 가능)
+    // 배열 조회만 하고, 아직 만들어지지 않았으면 런타임 분기하는 기본 PBR PSO 를 돌려준다
+    ID3D12PipelineState* GetPbrPermutation(uint32_t featureMask, bool bindless, bool compactVertex = false) const;
+
+    // featureMasks 비트 i = feature mask i 의 퍼뮤테이션 (4 가지 변형) 을 permutationPool 에서 만든다
+    // 렌더 스레드에서 호출, 이미 요청한 mask 는 무시 (제출만 하고 바로 반환)
+    void PrebuildPbrPermutations(uint32_t featureMasks);
+
     // 앱 종료 시 리소스 정리
     void Cleanup();
 
@@ -35,16 +77,32 @@ private:
     PipelineStateDesc CreateTrianglePSODesc() const;
     PipelineStateDesc CreatePhongPSODesc() const;
     PipelineStateDesc CreatePbrPSODesc() const;
+    PipelineStateDesc CreatePbrBindlessPSODesc() const;
     PipelineStateDesc CreateSkyboxPSODesc() const;
     PipelineStateDesc CreateDebugNormalPSODesc() const;
     PipelineStateDesc CreateOutlinePostEffectPSODesc() const;
     PipelineStateDesc CreateToneMappingPostEffectPSODesc() const;
     PipelineStateDesc CreateShadowMapPassPSODesc() const;
+    PipelineStateDesc CreateShadowMapInstancedPSODesc() const;
+    PipelineStateDesc CreateShadowTileCopyPSODesc() const;
     PipelineStateDesc CreateVolumetricCloudPSODesc() const;
 
+    // 같은 상태에 CompactMeshVertex 입력 레이아웃 + COMPACT_VERTEX VS 로 교체
+    PipelineStateDesc ToCompactVertexDesc(PipelineStateDesc desc, const wchar_t* name, const wchar_t* vsName, bool positionOnly) const;
+
 
     // PSO 생성 내부 로직
     bool CreatePSO(const PipelineStateDesc& desc);
+    ComPtr<ID3D12PipelineState> BuildPipelineState(const PipelineStateDesc& desc, bool* outCacheHit = nullptr);
+
+    // 퍼뮤테이션 변형: bit 0 = bindless, bit 1 = compact vertex
+    static constexpr size_t PbrVariantCount = 4;
+    static size_t GetPbrVariant(bool bindless, bool compactVertex) { return (bindless ? 1 : 0) | (compactVertex ? 2 : 0); }
+    void BuildPbrPermutation(size_t variant, uint32_t featureMask, PipelineStateDesc desc);
+
+    // 디스크 PSO 캐시 (ID3D12PipelineLibrary)
+    PipelineLibraryCache pipelineCache;
+    static constexpr const wchar_t* PipelineCachePath = L"Cache/PipelineLibrary.bin";
 
     Renderer* renderer;  // 렌더러 참조
     ID3D12Device* device;    // device = renderer->GetDevice()
@@ -52,4 +110,20 @@ private:
         std::wstring,
         ComPtr<ID3D12PipelineState>
     > psoMap;  // 이름 → PSO 캐시
+
+    // PipelineStateId → PSO (psoMap 이 소유, InitializePSOs 에서 갱신)
+    std::array<ID3D12PipelineState*, static_cast<size_t>(PipelineStateId::Count)> pipelineHandles{};
+
+    // [variant][feature mask] → PBR 퍼뮤테이션 PSO
+    // 워커가 pbrPermutationStates 에 저장한 뒤 handles 에 공개 (드로우 경로는 atomic load 만)
+    using PbrPermutationArray = std::array<ComPtr<ID3D12PipelineState>, MATERIAL_FEATURE_PERMUTATION_COUNT>;
+    using PbrPermutationHandles = std::array<std::atomic<ID3D12PipelineState*>, MATERIAL_FEATURE_PERMUTATION_COUNT>;
+    std::array<PbrPermutationArray, PbrVariantCount> pbrPermutationStates;
+    std::array<PbrPermutationHandles, PbrVariantCount> pbrPermutationHandles{};
+
+    // 퍼뮤테이션 셰이더 컴파일 + PSO 생성 전용 (낮은 우선순위)
+    // 렌더러의 ThreadPool 은 멀티스레드 렌더링 워커가 barrier 로 전부 점유하므로, 긴 작업이 하나라도 끼면 프레임 전체가 기다린다
+    static constexpr size_t PermutationThreadCount = 2;
+    std::unique_ptr<ThreadPool> permutationPool;
+    uint32_t requestedFeatureMasks = 0;         // 렌더 스레드만 접근
 };
\ No newline at end of file
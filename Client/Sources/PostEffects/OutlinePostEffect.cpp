@@ -57,15 +57,15 @@ void OutlinePostEffect::Render(ID3D12GraphicsCommandList* commandList, Renderer*
 
     // 루트 시그니처 & PSO 바인딩
     commandList->SetGraphicsRootSignature(
-       renderer->GetRootSignatureManager()->Get(L"PostProcessRS"));
+       renderer->GetRootSignatureManager()->Get(RootSignatureId::PostProcessRS));
     commandList->SetPipelineState(
-        renderer->GetPSOManager()->Get(L"OutlinePostEffectPSO"));
+        renderer->GetPSOManager()->Get(PipelineStateId::OutlinePostEffectPSO));
 
     // 상수 버퍼 (b0) 바인딩
     commandList->SetGraphicsRootConstantBufferView(0, frameResource->cbOutline->GetGPUVirtualAddress(0));
 
     // SRV 테이블 (t0) 바인딩
-    commandList->SetGraphicsRootDescriptorTable(1, frameResource->sceneColorSrv.gpuHandle);
+    commandList->SetGraphicsRootDescriptorTable(1, frameResource->sceneTargets->sceneColorSrv.gpuHandle);
 
     // 풀스크린 쿼드 Draw
     commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
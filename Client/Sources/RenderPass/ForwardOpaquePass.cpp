@@ -20,19 +20,17 @@ void ForwardOpaquePass::RenderSingleThreaded(Renderer* renderer)
 	auto descriptorHeapManager = renderer->GetDescriptorHeapManager();
 	UINT backBufferIndex = renderer->GetBackBufferIndex();
 
-	// ShadowMap 리소스들 : DEPTH_WRITE → PIXEL_SHADER_RESOURCE
-	const auto& shadowMaps = frameResource->shadowMaps;
-	for (const auto& shadowMap : shadowMaps)
+	// ShadowAtlas : DEPTH_WRITE → PIXEL_SHADER_RESOURCE
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			shadowMap.depthBuffer.Get(),
+			frameResource->shadowAtlas->depthBuffer.Get(),
 			D3D12_RESOURCE_STATE_DEPTH_WRITE,
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 		commandList->ResourceBarrier(1, &barrier);
 	}
 
-	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = frameResource->sceneColorRtv.cpuHandle;
-	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->depthStencilDsv.cpuHandle;
+	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = frameResource->sceneTargets->sceneColorRtv.cpuHandle;
+	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->sceneTargets->depthStencilDsv.cpuHandle;
 
 	commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
 
@@ -58,21 +56,13 @@ void ForwardOpaquePass::RenderSingleThreaded(Renderer* renderer)
 	commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
 
 
-	const auto& opaqueObjects = renderer->GetOpaqueObjects();
-	for (UINT objectIndex = 0; objectIndex < opaqueObjects.size(); ++objectIndex)
-	{
-		opaqueObjects[objectIndex]->Render(
-			commandList,
-			renderer,
-			objectIndex);
-	}
+	RenderObjects(commandList, renderer, 0, 1);
 
 
-	// ShadowMap 리소스들 : PIXEL_SHADER_RESOURCE → DEPTH_WRITE
-	for (const auto& shadowMap : shadowMaps)
+	// ShadowAtlas : PIXEL_SHADER_RESOURCE → DEPTH_WRITE
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			shadowMap.depthBuffer.Get(),
+			frameResource->shadowAtlas->depthBuffer.Get(),
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
 			D3D12_RESOURCE_STATE_DEPTH_WRITE);
 		commandList->ResourceBarrier(1, &barrier);
@@ -86,19 +76,17 @@ void ForwardOpaquePass::RecordPreCommand(ID3D12GraphicsCommandList* commandList,
 	auto descriptorHeapManager = renderer->GetDescriptorHeapManager();
 	UINT backBufferIndex = renderer->GetBackBufferIndex();
 
-	// ShadowMap 리소스들 : DEPTH_WRITE → PIXEL_SHADER_RESOURCE
-	const auto& shadowMaps = frameResource->shadowMaps;
-	for (const auto& shadowMap : shadowMaps)
+	// ShadowAtlas : DEPTH_WRITE → PIXEL_SHADER_RESOURCE
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			shadowMap.depthBuffer.Get(),
+			frameResource->shadowAtlas->depthBuffer.Get(),
 			D3D12_RESOURCE_STATE_DEPTH_WRITE,
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 		commandList->ResourceBarrier(1, &barrier);
 	}
 
-	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = frameResource->sceneColorRtv.cpuHandle;
-	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->depthStencilDsv.cpuHandle;
+	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = frameResource->sceneTargets->sceneColorRtv.cpuHandle;
+	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->sceneTargets->depthStencilDsv.cpuHandle;
 
 	commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
 
@@ -114,8 +102,8 @@ void ForwardOpaquePass::RecordParallelCommand(ID3D12GraphicsCommandList* command
 	FrameResource* frameResource = renderer->GetCurrentFrameResource();
 
 
-	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = frameResource->sceneColorRtv.cpuHandle;
-	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->depthStencilDsv.cpuHandle;
+	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = frameResource->sceneTargets->sceneColorRtv.cpuHandle;
+	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->sceneTargets->depthStencilDsv.cpuHandle;
 
 	commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
 
@@ -137,30 +125,43 @@ void ForwardOpaquePass::RecordParallelCommand(ID3D12GraphicsCommandList* command
 
 
 
-	const auto& opaqueObjects = renderer->GetOpaqueObjects();
-
-	UINT objectCount = static_cast<UINT>(opaqueObjects.size());
-	UINT numThreads = frameResource->numThreads;
-
-	for (UINT i = threadIndex; i < objectCount; i += numThreads)
-	{
-		opaqueObjects[i]->Render(commandList, renderer, i);
-	}
+	RenderObjects(commandList, renderer, threadIndex, frameResource->numThreads);
 }
 
 void ForwardOpaquePass::RecordPostCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer)
 {
 	FrameResource* frameResource = renderer->GetCurrentFrameResource();
 
-	const auto& shadowMaps = frameResource->shadowMaps;
-
-	// ShadowMap 리소스들 : PIXEL_SHADER_RESOURCE → DEPTH_WRITE
-	for (const auto& shadowMap : shadowMaps)
+	// ShadowAtlas : PIXEL_SHADER_RESOURCE → DEPTH_WRITE
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			shadowMap.depthBuffer.Get(),
+			frameResource->shadowAtlas->depthBuffer.Get(),
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
 			D3D12_RESOURCE_STATE_DEPTH_WRITE);
 		commandList->ResourceBarrier(1, &barrier);
 	}
 }
+
+void ForwardOpaquePass::RenderObjects(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT firstIndex, UINT stride)
+{
+	const auto& opaqueObjects = renderer->GetOpaqueObjects();
+	const UINT objectCount = static_cast<UINT>(opaqueObjects.size());
+	const bool bindless = renderer->IsBindlessMaterialsEnabled();
+
+	bool bindlessStateBound = false;
+	for (UINT i = firstIndex; i < objectCount; i += stride)
+	{
+		const bool usesBindless = bindless && opaqueObjects[i]->UsesBindlessPbr();
+		if (usesBindless && !bindlessStateBound)
+		{
+			renderer->BindBindlessPbrState(commandList);
+			bindlessStateBound = true;
+		}
+
+		opaqueObjects[i]->Render(commandList, renderer, i);
+
+		// 다른 RS/PSO 를 바인딩했을 수 있으므로 다음 bindless 오브젝트에서 재바인딩
+		if (!usesBindless)
+			bindlessStateBound = false;
+	}
+}
@@ -21,4 +21,8 @@ public:
     void RecordParallelCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT threadIndex) override;
     void RecordPostCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer) override;
 
+private:
+    // [firstIndex, firstIndex + stride, ...] 오브젝트를 그린다
+    // bindless 오브젝트는 공통 상태를 한 번만 바인딩하고, 다른 RS 를 쓰는 오브젝트 뒤에만 다시 바인딩
+    void RenderObjects(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT firstIndex, UINT stride);
 };
\ No newline at end of file
@@ -38,7 +38,7 @@ void PostProcessPass::RenderSingleThreaded(Renderer* renderer)
 	// Resource Barrier 로 용도변경
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			frameResource->sceneColorBuffer.Get(),
+			frameResource->sceneTargets->sceneColorBuffer.Get(),
 			D3D12_RESOURCE_STATE_RENDER_TARGET,
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 
@@ -46,7 +46,7 @@ void PostProcessPass::RenderSingleThreaded(Renderer* renderer)
 	}
 
 	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = swapChainRtvs[backBufferIndex].cpuHandle;
-	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->depthStencilDsv.cpuHandle;
+	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = frameResource->sceneTargets->depthStencilDsv.cpuHandle;
 
 	commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
 
@@ -60,7 +60,7 @@ void PostProcessPass::RenderSingleThreaded(Renderer* renderer)
 	// Resource Barrier 로 용도변경
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			frameResource->sceneColorBuffer.Get(),
+			frameResource->sceneTargets->sceneColorBuffer.Get(),
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
 			D3D12_RESOURCE_STATE_RENDER_TARGET);
 
@@ -76,7 +76,7 @@ void PostProcessPass::RecordPreCommand(ID3D12GraphicsCommandList* commandList, R
 	// Resource Barrier 로 용도변경
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			frameResource->sceneColorBuffer.Get(),
+			frameResource->sceneTargets->sceneColorBuffer.Get(),
 			D3D12_RESOURCE_STATE_RENDER_TARGET,
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 
@@ -130,7 +130,7 @@ void PostProcessPass::RecordPostCommand(ID3D12GraphicsCommandList* commandList,
 	// Resource Barrier 로 용도변경
 	{
 		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-			frameResource->sceneColorBuffer.Get(),
+			frameResource->sceneTargets->sceneColorBuffer.Get(),
 			D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
 			D3D12_RESOURCE_STATE_RENDER_TARGET);
 
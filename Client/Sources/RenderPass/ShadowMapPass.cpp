@@ -4,176 +4,469 @@
 #include "DescriptorHeapManager.h"
 #include "ShadowMap.h"
 #include "Lights/BaseLight.h"
+#include "ShadowCascades.h"
+#include "HashUtil.h"
+#include <directx/d3dx12.h>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+
+namespace
+{
+    // 아틀라스 타일 하나를 viewport/scissor 로 설정하고 그 사각형을 돌려줌
+    D3D12_RECT BindTileViewport(ID3D12GraphicsCommandList* commandList, const ShadowAtlasTile& tile)
+    {
+        D3D12_VIEWPORT viewport = {
+            static_cast<float>(tile.x), static_cast<float>(tile.y),
+            static_cast<float>(tile.size), static_cast<float>(tile.size),
+            0.0f, 1.0f };
+        D3D12_RECT scissorRect = {
+            static_cast<LONG>(tile.x), static_cast<LONG>(tile.y),
+            static_cast<LONG>(tile.x + tile.size), static_cast<LONG>(tile.y + tile.size) };
+
+        commandList->RSSetViewports(1, &viewport);
+        commandList->RSSetScissorRects(1, &scissorRect);
+        return scissorRect;
+    }
+
+    D3D12_RECT TileRect(const ShadowAtlasTile& tile)
+    {
+        return { LONG(tile.x), LONG(tile.y), LONG(tile.x + tile.size), LONG(tile.y + tile.size) };
+    }
+
+    bool SameTile(const ShadowAtlasTile& a, const ShadowAtlasTile& b)
+    {
+        return a.x == b.x && a.y == b.y && a.size == b.size;
+    }
+
+    // 캐스터 목록 + 각 오브젝트의 transform 버전 / 메시 / LOD → 움직이거나 LOD 가 바뀐 캐스터가 있으면 값이 바뀜
+    // (섀도우도 카메라 기준 LOD 로 그리므로 LOD 가 바뀌면 캐시된 타일과 실루엣이 달라짐)
+    uint64_t CasterSignature(const std::vector<UINT>& casters, const std::vector<std::shared_ptr<GameObject>>& objects)
+    {
+        Hasher hasher;
+        for (UINT objectIndex : casters)
+        {
+            hasher.AddValue(objectIndex);
+            hasher.AddValue(objects[objectIndex]->GetTransformVersion());
+            hasher.AddValue(objects[objectIndex]->GetMesh().get());
+            hasher.AddValue(objects[objectIndex]->GetCurrentLod());
+        }
+        hasher.AddValue(static_cast<uint64_t>(casters.size()));
+        return hasher.Value();
+    }
+}
 
 void ShadowMapPass::Initialize(Renderer* renderer)
 {
+    // 정적 캐스터 레이어: dirty 타일만 셰이더로 읽어 메인 아틀라스에 복사하므로 SRV 필요
+    staticLayer = FrameResource::CreateShadowAtlas(
+        renderer->GetDevice(), renderer->GetDescriptorHeapManager(), true);
 }
 
 void ShadowMapPass::Update(float deltaTime, Renderer* renderer)
 {
     auto& objects = renderer->GetOpaqueObjects();
-    auto& lights = renderer->GetLightingManager()->GetLights();
+    LightingManager* lightingManager = renderer->GetLightingManager();
+    auto& lights = lightingManager->GetLights();
+    const ShadowAtlas& shadowAtlas = lightingManager->GetShadowAtlas();
 
     UINT objectCount = static_cast<UINT>(objects.size());
-    UINT shadowMapIndex = 0;
-    
+
+    // 정적 캐시를 켜고 끄면 타일 내용의 의미가 바뀌므로 전부 무효화
+    const bool useStaticCache = renderer->IsStaticShadowCacheEnabled();
+    if (useStaticCache != staticCacheEnabled)
+    {
+        faceCache.clear();
+        staticCacheEnabled = useStaticCache;
+    }
+
+    instancedFaces = renderer->IsInstancedShadowFacesEnabled();
+    lightGroups.clear();
+
+    faceCache.resize(MAX_SHADOW_DSV_COUNT);
+    faceWork.resize(MAX_SHADOW_DSV_COUNT);
+    for (auto& work : faceWork)
+    {
+        work.staticCasters.clear();
+        work.dynamicCasters.clear();
+        work.renderStatic = false;
+        work.compositeStatic = false;
+        work.renderDynamic = false;
+    }
+
+    // 1) 오브젝트 월드 바운딩 구 (면마다 다시 계산하지 않도록 한 번만)
+    std::vector<BoundingSphere> objectBounds(objectCount);
+    std::vector<bool> hasBounds(objectCount);
+    for (UINT objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+    {
+        hasBounds[objectIndex] = objects[objectIndex]->GetWorldBoundingSphere(objectBounds[objectIndex]);
+    }
+
     for (UINT lightIndex = 0; lightIndex < lights.size(); ++lightIndex)
     {
-        auto& light = lights[lightIndex];
-        if (!light->IsShadowCastingEnabled())
+        const int firstSlot = lightingManager->GetShadowSlot(lightIndex);
+        if (firstSlot < 0)
             continue;
 
-        auto viewProjectionMatrices = light->GetShadowViewProjMatrices();
+        const auto& viewProjectionMatrices = lights[lightIndex]->GetShadowViewProjMatrices();
+        if (static_cast<size_t>(firstSlot) < shadowAtlas.GetTileCount())
+        {
+            LightFaceGroup& group = lightGroups.emplace_back();
+            group.firstFace = firstSlot;
+            group.faceCount = static_cast<UINT>(std::min(viewProjectionMatrices.size(), shadowAtlas.GetTileCount() - firstSlot));
+        }
+
         for (UINT faceIndex = 0; faceIndex < viewProjectionMatrices.size(); ++faceIndex)
         {
+            const UINT shadowMapIndex = firstSlot + faceIndex;
+            if (shadowMapIndex >= shadowAtlas.GetTileCount())
+                break;
+
             const XMMATRIX& lightViewProjection = viewProjectionMatrices[faceIndex];
+            const ShadowAtlasTile& tile = shadowAtlas.GetTile(shadowMapIndex);
+            FaceCache& cache = faceCache[shadowMapIndex];
+            FaceWork& work = faceWork[shadowMapIndex];
+
+            // 아틀라스 타일이 배정되지 않은 면은 그리지 않음
+            if (tile.size == 0)
+            {
+                cache.valid = false;
+                continue;
+            }
+
+            // 2) 면(캐스케이드) 절두체 밖의 캐스터는 제외, 정적/동적으로 나눔
             for (UINT objectIndex = 0; objectIndex < objectCount; ++objectIndex)
             {
-                objects[objectIndex]->UpdateShadowMap(
-                    renderer,
-                    objectIndex,
-                    shadowMapIndex,
-                    lightViewProjection
-                );
+                if (!hasBounds[objectIndex] ||
+                    !ShadowCascades::Intersects(lightViewProjection, objectBounds[objectIndex]))
+                    continue;
+
+                if (staticCacheEnabled && objects[objectIndex]->IsStaticShadowCaster())
+                    work.staticCasters.push_back(objectIndex);
+                else
+                    work.dynamicCasters.push_back(objectIndex);
             }
-            ++shadowMapIndex;
+
+            // 3) dirty 판정: 라이트 행렬/타일 변경, 또는 면 안의 캐스터가 움직이거나 들고 남
+            XMFLOAT4X4 viewProj;
+            XMStoreFloat4x4(&viewProj, lightViewProjection);
+
+            const bool lightChanged = !cache.valid
+                || std::memcmp(&viewProj, &cache.viewProj, sizeof(XMFLOAT4X4)) != 0
+                || !SameTile(tile, cache.tile);
+
+            const uint64_t staticSignature = CasterSignature(work.staticCasters, objects);
+            const uint64_t dynamicSignature = CasterSignature(work.dynamicCasters, objects);
+
+            work.renderStatic = staticCacheEnabled && (lightChanged || staticSignature != cache.staticSignature);
+            work.renderDynamic = lightChanged || dynamicSignature != cache.dynamicSignature;
+
+            cache.viewProj = viewProj;
+            cache.tile = tile;
+            cache.staticSignature = staticSignature;
+            cache.dynamicSignature = dynamicSignature;
+            cache.valid = true;
         }
     }
-}
 
-void ShadowMapPass::RenderSingleThreaded(Renderer* renderer)
-{
-    auto* frameResource = renderer->GetCurrentFrameResource();
+    // 4) 정적 레이어 합성: 바뀐 면의 타일만 복사하고, 복사가 덮어쓴 타일에만 동적 캐스터를 다시 그림
+    compositeStaticLayer = false;
+    if (staticCacheEnabled)
+    {
+        for (auto& work : faceWork)
+        {
+            work.compositeStatic = work.renderStatic || work.renderDynamic;
+            work.renderDynamic = work.compositeStatic && !work.dynamicCasters.empty();
+            compositeStaticLayer |= work.compositeStatic;
+        }
+    }
 
-    auto commandList = frameResource->commandList.Get();
-    auto& objects = renderer->GetOpaqueObjects();
-    auto& lights = renderer->GetLightingManager()->GetLights();
-    const UINT objectCount = static_cast<UINT>(objects.size());
+    // 5) 면 인스턴싱: 캐스터별로 그릴 면을 마스크로 모음 (면 행렬은 cbShadowViewProj 를 그대로 사용)
+    if (instancedFaces)
+    {
+        std::vector<uint32_t> staticMasks(objectCount);
+        std::vector<uint32_t> dynamicMasks(objectCount);
+        for (LightFaceGroup& group : lightGroups)
+        {
+            std::fill(staticMasks.begin(), staticMasks.end(), 0u);
+            std::fill(dynamicMasks.begin(), dynamicMasks.end(), 0u);
 
-    UINT shadowMapIndex = 0;
-    const float width = static_cast<float>(SHADOW_MAP_WIDTH);
-    const float height = static_cast<float>(SHADOW_MAP_HEIGHT);
+            for (UINT face = 0; face < group.faceCount; ++face)
+            {
+                const FaceWork& work = faceWork[group.firstFace + face];
+                if (work.renderStatic)
+                {
+                    for (UINT objectIndex : work.staticCasters)
+                        staticMasks[objectIndex] |= 1u << face;
+                }
+                if (work.renderDynamic)
+                {
+                    for (UINT objectIndex : work.dynamicCasters)
+                        dynamicMasks[objectIndex] |= 1u << face;
+                }
+            }
 
+            for (UINT objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+            {
+                if (staticMasks[objectIndex])
+                    group.staticDraws.emplace_back(objectIndex, staticMasks[objectIndex]);
+                if (dynamicMasks[objectIndex])
+                    group.dynamicDraws.emplace_back(objectIndex, dynamicMasks[objectIndex]);
+            }
+        }
+        return;
+    }
 
+    // 6) 면마다 그리는 경로: 이번 프레임에 그릴 캐스터만 상수 버퍼 갱신
     for (UINT lightIndex = 0; lightIndex < lights.size(); ++lightIndex)
     {
-        auto& light = lights[lightIndex];
-        if (!light->IsShadowCastingEnabled())
+        const int firstSlot = lightingManager->GetShadowSlot(lightIndex);
+        if (firstSlot < 0)
             continue;
 
-        auto viewProjMatrices = light->GetShadowViewProjMatrices();
-        for (UINT faceIndex = 0; faceIndex < viewProjMatrices.size(); ++faceIndex)
+        const auto& viewProjectionMatrices = lights[lightIndex]->GetShadowViewProjMatrices();
+        for (UINT faceIndex = 0; faceIndex < viewProjectionMatrices.size() && firstSlot + faceIndex < faceWork.size(); ++faceIndex)
         {
-            // viewport & scissor
-            D3D12_VIEWPORT     viewport = { 0.0f, 0.0f, width, height, 0.0f, 1.0f };
-            D3D12_RECT         scissorRect = { 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) };
-            commandList->RSSetViewports(1, &viewport);
-            commandList->RSSetScissorRects(1, &scissorRect);
-
-            // render target & clear
-            auto& dsvHandle = frameResource->shadowDsv[shadowMapIndex].cpuHandle;
-            commandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
-            commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
-
-            // draw each object
-            for (UINT objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+            const UINT shadowMapIndex = firstSlot + faceIndex;
+            const FaceWork& work = faceWork[shadowMapIndex];
+            if (work.renderStatic)
             {
-                objects[objectIndex]->RenderShadowMap(
-                    commandList,
-                    renderer,
-                    objectIndex,
-                    shadowMapIndex
-                );
+                for (UINT objectIndex : work.staticCasters)
+                    objects[objectIndex]->UpdateShadowMap(renderer, objectIndex, shadowMapIndex, viewProjectionMatrices[faceIndex]);
+            }
+            if (work.renderDynamic)
+            {
+                for (UINT objectIndex : work.dynamicCasters)
+                    objects[objectIndex]->UpdateShadowMap(renderer, objectIndex, shadowMapIndex, viewProjectionMatrices[faceIndex]);
             }
-
-            ++shadowMapIndex;
         }
     }
 }
 
-void ShadowMapPass::RecordPreCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer)
+void ShadowMapPass::RecordStaticLayer(ID3D12GraphicsCommandList* commandList, Renderer* renderer)
 {
     auto* frameResource = renderer->GetCurrentFrameResource();
+    const ShadowAtlas& shadowAtlas = renderer->GetLightingManager()->GetShadowAtlas();
+    auto& atlasDsv = frameResource->shadowAtlas->dsvHandle.cpuHandle;
 
-    auto& lights = renderer->GetLightingManager()->GetLights();
+    const UINT faceCount = static_cast<UINT>(std::min(shadowAtlas.GetTileCount(), faceWork.size()));
 
-    UINT shadowMapIndex = 0;
-    const float width = static_cast<float>(SHADOW_MAP_WIDTH);
-    const float height = static_cast<float>(SHADOW_MAP_HEIGHT);
+    if (!staticCacheEnabled)
+    {
+        // 캐시만 사용: 다시 그릴 타일만 클리어
+        commandList->OMSetRenderTargets(0, nullptr, FALSE, &atlasDsv);
+        for (UINT shadowMapIndex = 0; shadowMapIndex < faceCount; ++shadowMapIndex)
+        {
+            if (!faceWork[shadowMapIndex].renderDynamic)
+                continue;
 
+            D3D12_RECT tileRect = TileRect(shadowAtlas.GetTile(shadowMapIndex));
+            commandList->ClearDepthStencilView(atlasDsv, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 1, &tileRect);
+        }
+        return;
+    }
 
-    for (UINT lightIndex = 0; lightIndex < lights.size(); ++lightIndex)
+    // 1) 바뀐 면만 정적 레이어에 다시 그림
+    auto& staticDsv = staticLayer->dsvHandle.cpuHandle;
+    commandList->OMSetRenderTargets(0, nullptr, FALSE, &staticDsv);
+    if (instancedFaces)
     {
-        auto& light = lights[lightIndex];
-        if (!light->IsShadowCastingEnabled())
-            continue;
+        // 클리어는 viewport 와 무관하므로 먼저 전부 하고, 라이트마다 캐스터당 드로우 1번
+        for (UINT shadowMapIndex = 0; shadowMapIndex < faceCount; ++shadowMapIndex)
+        {
+            if (!faceWork[shadowMapIndex].renderStatic)
+                continue;
+
+            D3D12_RECT tileRect = TileRect(shadowAtlas.GetTile(shadowMapIndex));
+            commandList->ClearDepthStencilView(staticDsv, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 1, &tileRect);
+        }
 
-        auto viewProjMatrices = light->GetShadowViewProjMatrices();
-        for (UINT faceIndex = 0; faceIndex < viewProjMatrices.size(); ++faceIndex)
+        for (const LightFaceGroup& group : lightGroups)
         {
-            // viewport & scissor
-            D3D12_VIEWPORT     viewport = { 0.0f, 0.0f, width, height, 0.0f, 1.0f };
-            D3D12_RECT         scissorRect = { 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) };
-            commandList->RSSetViewports(1, &viewport);
-            commandList->RSSetScissorRects(1, &scissorRect);
-
-            // render target & clear
-            auto& dsvHandle = frameResource->shadowDsv[shadowMapIndex].cpuHandle;
-            commandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
-            commandList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
-
-            ++shadowMapIndex;
+            if (group.staticDraws.empty())
+                continue;
+
+            BindGroupViewports(commandList, shadowAtlas, group);
+            DrawInstancedCasters(commandList, renderer, group, group.staticDraws, 0, 1);
+        }
+    }
+    else
+    {
+        for (UINT shadowMapIndex = 0; shadowMapIndex < faceCount; ++shadowMapIndex)
+        {
+            const FaceWork& work = faceWork[shadowMapIndex];
+            if (!work.renderStatic)
+                continue;
+
+            D3D12_RECT tileRect = BindTileViewport(commandList, shadowAtlas.GetTile(shadowMapIndex));
+            commandList->ClearDepthStencilView(staticDsv, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 1, &tileRect);
+            DrawCasters(commandList, renderer, work.staticCasters, shadowMapIndex, 0, 1);
         }
     }
+
+    // 2) 정적 레이어 → 메인 아틀라스 (바뀐 타일만)
+    commandList->OMSetRenderTargets(0, nullptr, FALSE, &atlasDsv);
+    if (compositeStaticLayer)
+        CompositeStaticTiles(commandList, renderer);
 }
 
-void ShadowMapPass::RecordParallelCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT threadIndex)
+void ShadowMapPass::CompositeStaticTiles(ID3D12GraphicsCommandList* commandList, Renderer* renderer)
 {
-    auto* frameResource = renderer->GetCurrentFrameResource();
+    const ShadowAtlas& shadowAtlas = renderer->GetLightingManager()->GetShadowAtlas();
+    const UINT faceCount = static_cast<UINT>(std::min(shadowAtlas.GetTileCount(), faceWork.size()));
+
+    // 깊이 리소스는 CopyTextureRegion 으로 부분 복사가 안 되므로 타일마다 SV_Depth 삼각형을 그림
+    D3D12_RESOURCE_BARRIER toRead = CD3DX12_RESOURCE_BARRIER::Transition(staticLayer->depthBuffer.Get(),
+        D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    commandList->ResourceBarrier(1, &toRead);
+
+    ID3D12DescriptorHeap* heaps[] = {
+        renderer->GetDescriptorHeapManager()->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)
+    };
+    commandList->SetDescriptorHeaps(_countof(heaps), heaps);
+    commandList->SetGraphicsRootSignature(renderer->GetRootSignatureManager()->Get(RootSignatureId::ShadowTileCopyRS));
+    commandList->SetPipelineState(renderer->GetPSOManager()->Get(PipelineStateId::ShadowTileCopyPSO));
+    commandList->SetGraphicsRootDescriptorTable(0, staticLayer->srvHandle.gpuHandle);
+    commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    for (UINT shadowMapIndex = 0; shadowMapIndex < faceCount; ++shadowMapIndex)
+    {
+        if (!faceWork[shadowMapIndex].compositeStatic)
+            continue;
+
+        BindTileViewport(commandList, shadowAtlas.GetTile(shadowMapIndex));
+        commandList->DrawInstanced(3, 1, 0, 0);
+    }
+
+    D3D12_RESOURCE_BARRIER toDepth = CD3DX12_RESOURCE_BARRIER::Transition(staticLayer->depthBuffer.Get(),
+        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+    commandList->ResourceBarrier(1, &toDepth);
+}
 
+void ShadowMapPass::DrawCasters(ID3D12GraphicsCommandList* commandList, Renderer* renderer,
+    const std::vector<UINT>& casters, UINT shadowMapIndex, UINT firstIndex, UINT stride)
+{
     auto& objects = renderer->GetOpaqueObjects();
-    auto& lights = renderer->GetLightingManager()->GetLights();
-    const UINT objectCount = static_cast<UINT>(objects.size());
+    const UINT casterCount = static_cast<UINT>(casters.size());
 
-    UINT shadowMapIndex = 0;
-    const float width = static_cast<float>(SHADOW_MAP_WIDTH);
-    const float height = static_cast<float>(SHADOW_MAP_HEIGHT);
+    // Update 에서 기록해 둔 이번 프레임 면 행렬 (메시릿 컬링용)
+    const XMMATRIX lightViewProj = XMLoadFloat4x4(&faceCache[shadowMapIndex].viewProj);
 
+    for (UINT i = firstIndex; i < casterCount; i += stride)
+    {
+        objects[casters[i]]->RenderShadowMap(
+            commandList,
+            renderer,
+            casters[i],
+            shadowMapIndex,
+            lightViewProj
+        );
+    }
+}
 
-    for (UINT lightIndex = 0; lightIndex < lights.size(); ++lightIndex)
+void ShadowMapPass::BindGroupViewports(ID3D12GraphicsCommandList* commandList, const ShadowAtlas& shadowAtlas, const LightFaceGroup& group)
+{
+    assert(group.faceCount <= D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE);
+
+    // SV_ViewportArrayIndex = 그룹 안의 면 번호
+    D3D12_VIEWPORT viewports[D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE] = {};
+    D3D12_RECT scissorRects[D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE] = {};
+    for (UINT face = 0; face < group.faceCount; ++face)
     {
-        auto& light = lights[lightIndex];
-        if (!light->IsShadowCastingEnabled())
-            continue;
+        const ShadowAtlasTile& tile = shadowAtlas.GetTile(group.firstFace + face);
+        viewports[face] = {
+            static_cast<float>(tile.x), static_cast<float>(tile.y),
+            static_cast<float>(tile.size), static_cast<float>(tile.size),
+            0.0f, 1.0f };
+        scissorRects[face] = TileRect(tile);
+    }
 
-        auto viewProjMatrices = light->GetShadowViewProjMatrices();
-        for (UINT faceIndex = 0; faceIndex < viewProjMatrices.size(); ++faceIndex)
-        {
-            // viewport & scissor
-            D3D12_VIEWPORT     viewport = { 0.0f, 0.0f, width, height, 0.0f, 1.0f };
-            D3D12_RECT         scissorRect = { 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) };
-            commandList->RSSetViewports(1, &viewport);
-            commandList->RSSetScissorRects(1, &scissorRect);
+    commandList->RSSetViewports(group.faceCount, viewports);
+    commandList->RSSetScissorRects(group.faceCount, scissorRects);
+}
 
-            // render target & clear
-            auto& dsvHandle = frameResource->shadowDsv[shadowMapIndex].cpuHandle;
-            commandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
+void ShadowMapPass::DrawInstancedCasters(ID3D12GraphicsCommandList* commandList, Renderer* renderer, const LightFaceGroup& group,
+    const std::vector<std::pair<UINT, uint32_t>>& draws, UINT firstIndex, UINT stride)
+{
+    auto& objects = renderer->GetOpaqueObjects();
+    auto* frameResource = renderer->GetCurrentFrameResource();
 
-            UINT objectCount = static_cast<UINT>(objects.size());
-            UINT numThreads = frameResource->numThreads;
+    commandList->SetGraphicsRootSignature(renderer->GetRootSignatureManager()->Get(RootSignatureId::ShadowMapInstancedRS));
+    commandList->SetPipelineState(renderer->GetPSOManager()->Get(PipelineStateId::ShadowMapInstancedPSO));
+    commandList->SetGraphicsRootConstantBufferView(1, frameResource->cbShadowViewProj->GetGPUVirtualAddress(0));
+    commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-            // draw each object
-            for (UINT i = threadIndex; i < objectCount; i += numThreads)
-            {
-                objects[i]->RenderShadowMap(
-                    commandList,
-                    renderer,
-                    i,
-                    shadowMapIndex
-                );
-            }
+    XMMATRIX faceViewProjs[D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+
+    const UINT drawCount = static_cast<UINT>(draws.size());
+    for (UINT i = firstIndex; i < drawCount; i += stride)
+    {
+        const auto& [objectIndex, faceMask] = draws[i];
+        const UINT constants[2] = { faceMask, group.firstFace };
+        commandList->SetGraphicsRoot32BitConstants(2, _countof(constants), constants, 0);
+
+        // 마스크에 든 면 행렬만 모아서 메시릿 컬링 (어느 면에라도 보이면 그림)
+        UINT faceCount = 0;
+        for (uint32_t mask = faceMask; mask != 0; mask &= mask - 1)
+            faceViewProjs[faceCount++] = XMLoadFloat4x4(&faceCache[group.firstFace + std::countr_zero(mask)].viewProj);
+
+        objects[objectIndex]->RenderShadowMapInstanced(commandList, renderer, objectIndex, faceCount, faceViewProjs);
+    }
+}
+
+void ShadowMapPass::RecordDynamicCasters(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT firstIndex, UINT stride)
+{
+    const ShadowAtlas& shadowAtlas = renderer->GetLightingManager()->GetShadowAtlas();
 
-            ++shadowMapIndex;
+    if (instancedFaces)
+    {
+        for (const LightFaceGroup& group : lightGroups)
+        {
+            if (group.dynamicDraws.empty())
+                continue;
+
+            BindGroupViewports(commandList, shadowAtlas, group);
+            DrawInstancedCasters(commandList, renderer, group, group.dynamicDraws, firstIndex, stride);
         }
+        return;
     }
+
+    const UINT faceCount = static_cast<UINT>(std::min(shadowAtlas.GetTileCount(), faceWork.size()));
+    for (UINT shadowMapIndex = 0; shadowMapIndex < faceCount; ++shadowMapIndex)
+    {
+        const FaceWork& work = faceWork[shadowMapIndex];
+        if (!work.renderDynamic)
+            continue;
+
+        BindTileViewport(commandList, shadowAtlas.GetTile(shadowMapIndex));
+        DrawCasters(commandList, renderer, work.dynamicCasters, shadowMapIndex, firstIndex, stride);
+    }
+}
+
+void ShadowMapPass::RenderSingleThreaded(Renderer* renderer)
+{
+    auto* frameResource = renderer->GetCurrentFrameResource();
+    auto commandList = frameResource->commandList.Get();
+
+    // 정적 레이어 갱신/합성 후 메인 아틀라스 DSV 가 바인딩된 상태로 돌아옴
+    RecordStaticLayer(commandList, renderer);
+    RecordDynamicCasters(commandList, renderer, 0, 1);
+}
+
+void ShadowMapPass::RecordPreCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer)
+{
+    // 클리어/정적 레이어/복사는 워커 리스트보다 먼저 실행되는 pre 리스트에서
+    RecordStaticLayer(commandList, renderer);
+}
+
+void ShadowMapPass::RecordParallelCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT threadIndex)
+{
+    auto* frameResource = renderer->GetCurrentFrameResource();
+
+    auto& dsvHandle = frameResource->shadowAtlas->dsvHandle.cpuHandle;
+    commandList->OMSetRenderTargets(0, nullptr, FALSE, &dsvHandle);
+
+    // 캐스터(드로우)를 스레드 수만큼 나눠 기록
+    RecordDynamicCasters(commandList, renderer, threadIndex, frameResource->numThreads);
 }
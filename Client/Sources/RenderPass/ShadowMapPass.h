@@ -2,6 +2,11 @@
 
 #include "RenderPass.h"
 #include <wrl.h>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <DirectXMath.h>
+#include "ShadowAtlas.h"
 
 class Renderer;
 
@@ -19,4 +24,60 @@ public:
     void RecordPreCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer) override;
     void RecordParallelCommand(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT threadIndex) override;
 
+private:
+    // 면(섀도우맵 인덱스)별로 마지막으로 그린 상태. 바뀐 게 없으면 아틀라스 타일을 그대로 재사용
+    struct FaceCache
+    {
+        XMFLOAT4X4      viewProj = {};
+        ShadowAtlasTile tile;
+        uint64_t        staticSignature = 0;    // 정적 캐스터 (인덱스 + transform 버전)
+        uint64_t        dynamicSignature = 0;   // 동적 캐스터
+        bool            valid = false;
+    };
+
+    // 이번 프레임에 면마다 할 일
+    struct FaceWork
+    {
+        std::vector<UINT> staticCasters;
+        std::vector<UINT> dynamicCasters;       // 정적 캐시가 꺼져 있으면 모든 캐스터
+        bool renderStatic = false;              // 정적 레이어 타일 재생성
+        bool compositeStatic = false;           // 정적 레이어 타일 → 메인 아틀라스 타일 복사
+        bool renderDynamic = false;             // 메인 아틀라스 타일에 동적 캐스터
+    };
+
+    // 라이트 하나의 연속된 면 [firstFace, firstFace + faceCount). 캐스터마다 그릴 면을 비트마스크로
+    struct LightFaceGroup
+    {
+        UINT firstFace = 0;
+        UINT faceCount = 0;
+        std::vector<std::pair<UINT, uint32_t>> staticDraws;     // (objectIndex, faceMask)
+        std::vector<std::pair<UINT, uint32_t>> dynamicDraws;
+    };
+
+    // 정적 레이어 갱신 + (필요하면) 메인 아틀라스로 복사. 동적 캐스터 전에 기록
+    void RecordStaticLayer(ID3D12GraphicsCommandList* commandList, Renderer* renderer);
+
+    // dirty 타일만 정적 레이어 → 메인 아틀라스 (타일 viewport 에 SV_Depth 삼각형)
+    void CompositeStaticTiles(ID3D12GraphicsCommandList* commandList, Renderer* renderer);
+
+    // 메인 아틀라스에 동적 캐스터 (firstIndex/stride 로 워커 스레드 분배)
+    void RecordDynamicCasters(ID3D12GraphicsCommandList* commandList, Renderer* renderer, UINT firstIndex, UINT stride);
+
+    void DrawCasters(ID3D12GraphicsCommandList* commandList, Renderer* renderer,
+        const std::vector<UINT>& casters, UINT shadowMapIndex, UINT firstIndex, UINT stride);
+
+    // 면 인스턴싱: 그룹의 면 타일을 viewport/scissor 배열로 묶고 캐스터당 드로우 1번
+    void BindGroupViewports(ID3D12GraphicsCommandList* commandList, const ShadowAtlas& shadowAtlas, const LightFaceGroup& group);
+    void DrawInstancedCasters(ID3D12GraphicsCommandList* commandList, Renderer* renderer, const LightFaceGroup& group,
+        const std::vector<std::pair<UINT, uint32_t>>& draws, UINT firstIndex, UINT stride);
+
+    std::vector<FaceCache> faceCache;
+    std::vector<FaceWork>  faceWork;
+    std::vector<LightFaceGroup> lightGroups;
+    bool instancedFaces = false;
+
+    // 정적 캐스터만 그려 두는 아틀라스 (메인 아틀라스와 같은 타일 배치)
+    std::shared_ptr<ShadowMap> staticLayer;
+    bool staticCacheEnabled = false;
+    bool compositeStaticLayer = false;      // 이번 프레임 복사할 타일이 하나라도 있음
 };
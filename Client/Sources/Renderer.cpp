@@ -8,7 +8,9 @@
 #include "Lights/PointLight.h"
 #include "Lights/SpotLight.h"
 #include "ThreadPool.h"
+#include "DebugManager.h"
 #include <stdexcept>
+#include <chrono>
 
 Renderer::Renderer()
 {
@@ -27,15 +29,36 @@ Renderer::~Renderer() {
 }
 
 bool Renderer::Initialize(HWND hwnd, int width, int height) {
+    using Clock = std::chrono::high_resolution_clock;
+    auto elapsedMs = [](Clock::time_point from, Clock::time_point to) {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    };
+
+    startupStartTime = Clock::now();
+
     if (!InitD3D(hwnd, width, height))
         return false;
 
+    const auto d3dTime = Clock::now();
+
+    // VS 에서 SV_ViewportArrayIndex 를 쓰려면 GS 에뮬레이션 없는 지원이 필요 (아니면 면마다 드로우)
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options{};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options))) ||
+        !options.VPAndRTArrayIndexFromAnyShaderFeedingRasterizerSupportedWithoutGSEmulation)
+    {
+        useInstancedShadowFaces = false;
+        DebugManager::GetInstance().LogMessage(L"[Shadow] Viewport array index from VS not supported, drawing shadow faces one by one");
+    }
+
     // Managers
+    // 루트 시그니처는 직렬화만 하고 생성은 풀에서 셰이더 컴파일과 겹쳐 진행
     rootSignatureManager = std::make_unique<RootSignatureManager>(device.Get());
     assert(rootSignatureManager && "rootSignatureManager nullptr!");
-    if (!rootSignatureManager->InitializeDescs())
+    if (!rootSignatureManager->InitializeDescs(threadPool.get()))
         return false;
 
+    const auto rootSignatureTime = Clock::now();
+
     shaderManager = std::make_unique<ShaderManager>(device.Get());
     std::vector<ShaderCompileDesc> shaderDescs = {
         { L"TriangleVS", L"Shaders/TriangleVS.hlsl", "VSMain", "vs_5_0" },
@@ -44,6 +67,10 @@ bool Renderer::Initialize(HWND hwnd, int width, int height) {
         { L"PhongPS",     L"Shaders/PhongPS.hlsl",     "PSMain", "ps_5_1" },
         { L"PbrVS",      L"Shaders/PbrVS.hlsl",      "VSMain", "vs_5_1" },
         { L"PbrPS",       L"Shaders/PbrPS.hlsl",       "PSMain", "ps_5_1" },
+        { L"PbrBindlessPS", L"Shaders/PbrPS.hlsl",     "PSMain", "ps_5_1",
+            D3DCOMPILE_OPTIMIZATION_LEVEL3, { { "BINDLESS_MATERIALS", "1" } } },
+        { L"PbrCompactVS", L"Shaders/PbrVS.hlsl",      "VSMain", "vs_5_1",
+            D3DCOMPILE_OPTIMIZATION_LEVEL3, { { "COMPACT_VERTEX", "1" } } },
 
         { L"SkyboxVS",     L"Shaders/SkyboxVS.hlsl",     "VSMain", "vs_5_0" },
         { L"SkyboxPS",      L"Shaders/SkyboxPS.hlsl",      "PSMain", "ps_5_0" },
@@ -60,18 +87,41 @@ bool Renderer::Initialize(HWND hwnd, int width, int height) {
 
         { L"ShadowMapPassVS", L"Shaders/ShadowMapPass.hlsl", "VSMain", "vs_5_0" },
         { L"ShadowMapPassPS", L"Shaders/ShadowMapPass.hlsl", "PSMain", "ps_5_0" },
+        { L"ShadowMapPassCompactVS", L"Shaders/ShadowMapPass.hlsl", "VSMain", "vs_5_0",
+            D3DCOMPILE_OPTIMIZATION_LEVEL3, { { "COMPACT_VERTEX", "1" } } },
+        { L"ShadowMapInstancedVS", L"Shaders/ShadowMapInstanced.hlsl", "VSMain", "vs_5_1" },
+        { L"ShadowMapInstancedPS", L"Shaders/ShadowMapInstanced.hlsl", "PSMain", "ps_5_1" },
+        { L"ShadowMapInstancedCompactVS", L"Shaders/ShadowMapInstanced.hlsl", "VSMain", "vs_5_1",
+            D3DCOMPILE_OPTIMIZATION_LEVEL3, { { "COMPACT_VERTEX", "1" } } },
+        { L"ShadowTileCopyVS", L"Shaders/ShadowTileCopy.hlsl", "VSMain", "vs_5_0" },
+        { L"ShadowTileCopyPS", L"Shaders/ShadowTileCopy.hlsl", "PSMain", "ps_5_0" },
 
     };
 
-    if (!shaderManager->CompileAll(shaderDescs))
+    // 오프라인 쿠킹된 아카이브가 최신이면 그대로 사용, 아니면 런타임 컴파일
+    // (Shaders/ShaderManifest.txt 는 위 목록과 동일하게 유지할 것)
+    if (!shaderManager->LoadArchive(L"Shaders/Shaders.pak", shaderDescs))
+    {
+        if (!shaderManager->CompileAll(shaderDescs, threadPool.get()))
+            return false;
+    }
+
+    const auto shaderTime = Clock::now();
+
+    // PSO 는 루트 시그니처가 필요하므로 비동기 생성 완료를 먼저 기다린다
+    if (!rootSignatureManager->WaitForPendingCreates())
         return false;
 
+    const auto rootSignatureWaitTime = Clock::now();
+
     psoManager = std::make_unique<PipelineStateManager>(this);
-    if (!psoManager->InitializePSOs())
+    if (!psoManager->InitializePSOs(threadPool.get()))
         return false;
 
+    const auto psoTime = Clock::now();
+
     {
-        auto pso = psoManager->Get(L"PhongPSO");
+        auto pso = psoManager->Get(PipelineStateId::PhongPSO);
         assert(pso && "PhongPSO not found! Did InitializePSOs() register it?");
         if (!pso)
             throw std::runtime_error("Failed to find PhongPSO after initialization");
@@ -82,6 +132,13 @@ bool Renderer::Initialize(HWND hwnd, int width, int height) {
     if (!textureManager->Initialize(this, descriptorHeapManager.get()))
         return false;
 
+    materialTable = std::make_unique<MaterialTable>();
+
+    textureStreamer = std::make_unique<TextureStreamer>();
+    textureStreamer->Initialize(this);
+
+    assetLoader = std::make_unique<AssetLoader>(this);
+
 
     // Setup camera
     mainCamera = std::make_shared<Camera>();
@@ -138,13 +195,22 @@ bool Renderer::Initialize(HWND hwnd, int width, int height) {
 
     frameResources.clear();
     frameResources.reserve(BackBufferCount);
+
+    // 섀도우 아틀라스는 모든 FrameResource 가 공유 (캐시된 타일 유지)
+    auto shadowAtlas = FrameResource::CreateShadowAtlas(device.Get(), descriptorHeapManager.get());
+
+    // Off-screen 컬러 / 깊이도 공유
+    // 모든 프레임이 같은 direct queue 에서 순서대로 실행되므로 추가 펜스 불필요
+    auto sceneTargets = FrameResource::CreateSceneTargets(
+        device.Get(), descriptorHeapManager.get(), GetViewportWidth(), GetViewportHeight());
+
     for (UINT i = 0; i < BackBufferCount; ++i) {
         frameResources.emplace_back(std::make_unique<FrameResource>(
             device.Get(),
             descriptorHeapManager.get(),
             static_cast<UINT>(/*GameObject 최대 수=*/1000),
-            GetViewportWidth(),
-            GetViewportHeight(),
+            sceneTargets,
+            shadowAtlas,
             threadPool->GetThreadCount(),
             IsMultithreadedRenderingEnabled()
         ));
@@ -165,6 +231,16 @@ bool Renderer::Initialize(HWND hwnd, int width, int height) {
         renderPasses[i]->Initialize(this);
     }
 
+    const auto endTime = Clock::now();
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[Startup] Renderer::Initialize {:.2f} ms (D3D {:.2f}, RS serialize {:.2f}, shaders {:.2f}, RS wait {:.2f}, PSOs {:.2f}, rest {:.2f})",
+        elapsedMs(startupStartTime, endTime),
+        elapsedMs(startupStartTime, d3dTime),
+        elapsedMs(d3dTime, rootSignatureTime),
+        elapsedMs(rootSignatureTime, shaderTime),
+        elapsedMs(shaderTime, rootSignatureWaitTime),
+        elapsedMs(rootSignatureWaitTime, psoTime),
+        elapsedMs(psoTime, endTime)));
 
     return true;
 }
@@ -172,6 +248,10 @@ bool Renderer::Initialize(HWND hwnd, int width, int height) {
 void Renderer::Cleanup() {
     WaitForDirectQueue();
 
+    // 텍스쳐 스트리밍 업로드는 Copy 큐에서 기다리지 않고 진행되므로 리소스 해제 전에 완료 대기
+    if (copyQueue)
+        WaitCopyFence(SignalCopyFence());
+
     ShutdownImGui();
 
     if (directFenceEvent != nullptr && directFenceEvent != INVALID_HANDLE_VALUE) {
@@ -249,12 +329,42 @@ void Renderer::Update(float deltaTime) {
         WaitForSingleObject(directFenceEvent, INFINITE);
     }
 
+    // GPU 가 끝낸 프레임에서 해제된 디스크립터 회수 + 이번 프레임 transient 구간 리셋
+    descriptorHeapManager->ProcessDeferredFrees(directFence->GetCompletedValue());
+    descriptorHeapManager->BeginFrame(currentFrameIndex);
+
+    // 로더 스레드가 디코드/임포트를 끝낸 에셋을 업로드 (오브젝트 Update 전이라 이번 프레임부터 사용)
+    // 스트리밍 밉 읽기가 끝난 것도 여기서 복사를 기록하고 textureStreamer->Update 에서 제출
+    assetLoader->ProcessCompleted();
+
+    // 직전 프레임 Render 에서 누적된 삼각형 수를 확정하고 이번 프레임용으로 리셋
+    lastFrameTriangles = submittedTriangles.exchange(0, std::memory_order_relaxed);
+    lastFrameClusters.tested = clustersTested.exchange(0, std::memory_order_relaxed);
+    lastFrameClusters.frustumCulled = clustersFrustumCulled.exchange(0, std::memory_order_relaxed);
+    lastFrameClusters.coneCulled = clustersConeCulled.exchange(0, std::memory_order_relaxed);
+    lastFrameClusters.cullNanoseconds = clusterCullNanoseconds.exchange(0, std::memory_order_relaxed);
+    UpdateStatsImGui();
+
     lightingManager->Update(this);
 
     for (UINT i = 0; i < gameObjects.size(); ++i) {
         gameObjects[i]->Update(deltaTime, this, i);
     }
 
+    // 이번 프레임 오브젝트 위치 기준으로 밉을 올리고 내림 (SRV 인덱스가 바뀌므로 머티리얼 테이블 업로드 전)
+    textureStreamer->Update(gameObjects);
+
+    // SRV 가 바뀐 텍스쳐를 쓰는 머티리얼만 t0~t3 테이블을 다시 만듦 (드로우 경로는 조회만)
+    materialTable->UpdateTextureTables(textureManager.get());
+
+    // ImGui 등으로 바뀐 머티리얼 파라미터까지 반영하여 이번 프레임 테이블 업로드
+    materialTable->Upload(currentFrameResource->materialTable.get());
+
+    // 머티리얼이 쓰는 퍼뮤테이션을 PSO 전용 풀에서 미리 생성 (드로우 경로는 조회만, mask 0 은 Box/Sphere 의 CB 경로용)
+    // 렌더 워커 풀에 넣으면 barrier 로 묶인 워커 하나가 컴파일 뒤에 밀려 프레임이 멈춘다
+    if (useShaderPermutations)
+        psoManager->PrebuildPbrPermutations(materialTable->GetFeatureMaskSet() | 1u);
+
     for (auto& pass : renderPasses) {
         pass->Update(deltaTime, this);
     }
@@ -268,6 +378,15 @@ void Renderer::Render() {
     else {
         RenderSingleThreaded();
     }
+
+    // 시작 ~ 첫 프레임 제출까지 (씬 로딩 포함)
+    if (!firstFrameLogged) {
+        firstFrameLogged = true;
+        DebugManager::GetInstance().LogMessage(std::format(
+            L"[Startup] Time to first frame: {:.2f} ms",
+            std::chrono::duration<double, std::milli>(
+                std::chrono::high_resolution_clock::now() - startupStartTime).count()));
+    }
 }
 
 void Renderer::RenderSingleThreaded()
@@ -505,6 +624,14 @@ ID3D12CommandQueue* Renderer::GetDirectQueue() const {
     return directQueue.Get();
 }
 
+UINT64 Renderer::GetDirectFenceValue() const {
+    return directFenceValue;
+}
+
+UINT64 Renderer::GetCompletedDirectFenceValue() const {
+    return directFence->GetCompletedValue();
+}
+
 ID3D12CommandQueue* Renderer::GetCopyQueue() const {
     return copyQueue.Get();
 }
@@ -560,11 +687,26 @@ TextureManager* Renderer::GetTextureManager() const
     return textureManager.get();
 }
 
+TextureStreamer* Renderer::GetTextureStreamer() const
+{
+    return textureStreamer.get();
+}
+
+AssetLoader* Renderer::GetAssetLoader() const
+{
+    return assetLoader.get();
+}
+
 LightingManager* Renderer::GetLightingManager() const
 {
     return lightingManager.get();
 }
 
+MaterialTable* Renderer::GetMaterialTable() const
+{
+    return materialTable.get();
+}
+
 ThreadPool* Renderer::GetThreadPool()
 {
     return threadPool.get();
@@ -728,11 +870,12 @@ bool Renderer::InitD3D(HWND hwnd, int width, int height)
     descriptorHeapManager = std::make_unique<DescriptorHeapManager>();
     if (!descriptorHeapManager->Initialize(
         device.Get(),
-        /*CBV_SRV_UAV*/ 10000,
+        /*CBV_SRV_UAV*/ 16384,
         /*Sampler*/      128,
         /*RTV*/          100,
         /*DSV*/          300,
-        /*backBuffers*/  BackBufferCount))
+        /*backBuffers*/  BackBufferCount,
+        /*transient*/    2048))
     {
         return false;
     }
@@ -841,3 +984,158 @@ bool Renderer::IsMultithreadedRenderingEnabled() const
 {
     return useMultiThreadedRendering;
 }
+
+bool Renderer::IsBindlessMaterialsEnabled() const
+{
+    return useBindlessMaterials;
+}
+
+bool Renderer::IsStaticShadowCacheEnabled() const
+{
+    return useStaticShadowCache;
+}
+
+bool Renderer::IsInstancedShadowFacesEnabled() const
+{
+    return useInstancedShadowFaces;
+}
+
+bool Renderer::IsCompactVerticesEnabled() const
+{
+    return useCompactVertices;
+}
+
+bool Renderer::IsMeshLodEnabled() const
+{
+    return useMeshLods;
+}
+
+bool Renderer::IsClusterCullingEnabled() const
+{
+    return useClusterCulling;
+}
+
+bool Renderer::IsStatsWindowVisible() const
+{
+    return statsWindowVisible;
+}
+
+bool Renderer::IsTextureStreamingEnabled() const
+{
+    return useTextureStreaming && textureStreamer->IsAvailable();
+}
+
+void Renderer::AddClusterCullStats(const Meshlets::CullStats& stats, uint64_t cullNanoseconds)
+{
+    clustersTested.fetch_add(stats.tested, std::memory_order_relaxed);
+    clustersFrustumCulled.fetch_add(stats.frustumCulled, std::memory_order_relaxed);
+    clustersConeCulled.fetch_add(stats.coneCulled, std::memory_order_relaxed);
+    clusterCullNanoseconds.fetch_add(cullNanoseconds, std::memory_order_relaxed);
+}
+
+void Renderer::UpdateStatsImGui()
+{
+    statsWindowVisible = ImGui::Begin("Renderer Stats");
+    if (!statsWindowVisible)
+    {
+        ImGui::End();
+        return;
+    }
+
+    ImGui::Text("Triangles submitted: %llu", static_cast<unsigned long long>(lastFrameTriangles));
+    ImGui::Text("Assets loading: %zu", assetLoader->GetPendingCount());
+
+    // 텍스쳐 스트리밍 (이미 로드된 텍스쳐는 플래그를 바꿔도 그대로)
+    ImGui::Checkbox("Texture streaming", &useTextureStreaming);
+    if (textureStreamer->IsAvailable())
+    {
+        int budgetMB = int(textureStreamer->GetBudgetBytes() >> 20);
+        if (ImGui::SliderInt("Texture budget (MB)", &budgetMB, 16, 2048))
+            textureStreamer->SetBudgetBytes(uint64_t(budgetMB) << 20);
+
+        const TextureStreamer::Stats& streamStats = textureStreamer->GetStats();
+        ImGui::Text("Streamed textures: %u, resident %.1f / target %.1f MB (+%u / -%u mips)",
+            streamStats.textureCount,
+            streamStats.residentBytes / (1024.0 * 1024.0),
+            streamStats.targetBytes / (1024.0 * 1024.0),
+            streamStats.loads, streamStats.evictions);
+    }
+    ImGui::Checkbox("Mesh LOD", &useMeshLods);
+    ImGui::SliderFloat("LOD error (px)", &lodErrorThresholdPixels, 0.25f, 8.0f, "%.2f");
+
+    // 메시릿 컬링 (메인 + 섀도우 패스 합계)
+    ImGui::Checkbox("Cluster culling", &useClusterCulling);
+    if (lastFrameClusters.tested > 0)
+    {
+        const double tested = double(lastFrameClusters.tested);
+        ImGui::Text("Clusters tested: %llu (frustum %.1f%%, cone %.1f%%), CPU %.3f ms",
+            static_cast<unsigned long long>(lastFrameClusters.tested),
+            100.0 * lastFrameClusters.frustumCulled / tested,
+            100.0 * lastFrameClusters.coneCulled / tested,
+            lastFrameClusters.cullNanoseconds * 1e-6);
+    }
+
+    // 오브젝트별 선택된 LOD
+    for (size_t i = 0; i < gameObjects.size(); ++i)
+    {
+        const auto& mesh = gameObjects[i]->GetMesh();
+        if (!mesh || mesh->GetLodCount() <= 1)
+            continue;
+
+        const MeshLod& lod = mesh->GetLod(gameObjects[i]->GetCurrentLod());
+        ImGui::Text("  object %zu : LOD %u / %u (%u tris)", i,
+            gameObjects[i]->GetCurrentLod(), mesh->GetLodCount() - 1, lod.indexCount / 3);
+    }
+
+    ImGui::End();
+}
+
+bool Renderer::IsShaderPermutationsEnabled() const
+{
+    return useShaderPermutations;
+}
+
+ID3D12PipelineState* Renderer::GetPbrPipelineState(uint32_t featureMask, bool bindless, bool compactVertex)
+{
+    if (useShaderPermutations)
+        return psoManager->GetPbrPermutation(featureMask, bindless, compactVertex);
+
+    if (compactVertex)
+        return psoManager->Get(bindless ? PipelineStateId::PbrBindlessCompactPSO : PipelineStateId::PbrCompactPSO);
+
+    return psoManager->Get(bindless ? PipelineStateId::PbrBindlessPSO : PipelineStateId::PbrPSO);
+}
+
+void Renderer::BindBindlessPbrState(ID3D12GraphicsCommandList* commandList)
+{
+    FrameResource* frameResource = GetCurrentFrameResource();
+
+    ID3D12DescriptorHeap* heaps[] = {
+        descriptorHeapManager->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV),
+        descriptorHeapManager->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER)
+    };
+    commandList->SetDescriptorHeaps(_countof(heaps), heaps);
+
+    commandList->SetGraphicsRootSignature(rootSignatureManager->Get(RootSignatureId::PbrBindlessRS));
+    commandList->SetPipelineState(psoManager->Get(PipelineStateId::PbrBindlessPSO));
+
+    // b1: Lighting, b3: Global, b4: ShadowViewProj
+    commandList->SetGraphicsRootConstantBufferView(1, frameResource->cbLighting->GetGPUVirtualAddress(0));
+    commandList->SetGraphicsRootConstantBufferView(3, frameResource->cbGlobal->GetGPUVirtualAddress(0));
+    commandList->SetGraphicsRootConstantBufferView(4, frameResource->cbShadowViewProj->GetGPUVirtualAddress(0));
+
+    // t0 space1: 머티리얼 테이블, t0.. space2: 힙 시작부터 전체 SRV
+    commandList->SetGraphicsRootShaderResourceView(5, frameResource->materialTable->GetGPUVirtualAddress(0));
+    commandList->SetGraphicsRootDescriptorTable(6,
+        descriptorHeapManager->GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)->GetGPUDescriptorHandleForHeapStart());
+
+    environmentMaps.Bind(commandList, 7, 8, 9);
+    commandList->SetGraphicsRootDescriptorTable(10, descriptorHeapManager->GetLinearWrapSamplerGpuHandle());
+    commandList->SetGraphicsRootDescriptorTable(11, frameResource->shadowAtlas->srvHandle.gpuHandle);
+
+    // t8: 클러스터 라이트, t9: 클러스터 목록
+    commandList->SetGraphicsRootShaderResourceView(12, frameResource->clusterLights->GetGPUVirtualAddress(0));
+    commandList->SetGraphicsRootShaderResourceView(13, frameResource->clusterData->GetGPUVirtualAddress(0));
+
+    commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
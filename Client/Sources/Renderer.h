@@ -6,6 +6,8 @@
 #include <vector>
 #include <memory>
 #include <barrier>
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <format>
 #include <imgui.h>
@@ -19,7 +21,10 @@
 #include "RootSignatureManager.h"
 #include "DescriptorHeapManager.h"
 #include "TextureManager.h"
+#include "AssetLoader.h"
+#include "TextureStreamer.h"
 #include "LightingManager.h"
+#include "MaterialTable.h"
 #include "RenderPass/RenderPass.h"
 #include "FrameResource/FrameResource.h"
 #include "Camera.h"
@@ -59,12 +64,41 @@ public:
     void UpdateGlobalTime(float seconds);
 
     bool IsMultithreadedRenderingEnabled() const;
+    bool IsBindlessMaterialsEnabled() const;
+    bool IsShaderPermutationsEnabled() const;
+    bool IsStaticShadowCacheEnabled() const;
+    bool IsInstancedShadowFacesEnabled() const;
+    bool IsCompactVerticesEnabled() const;
+    bool IsMeshLodEnabled() const;
+    bool IsClusterCullingEnabled() const;
+    bool IsStatsWindowVisible() const;
+    bool IsTextureStreamingEnabled() const;    // 플래그 + tiled 리소스 지원 (로드 시점에 적용)
+
+    // LOD 선택 기준: 단순화 오차가 화면에서 이 픽셀 수 이하인 가장 거친 LOD
+    float GetLodErrorThreshold() const { return lodErrorThresholdPixels; }
+
+    // 드로우마다 제출한 삼각형 수 누적 (워커 쓰레드에서도 호출), Update 에서 프레임 단위로 리셋
+    void AddSubmittedTriangles(uint64_t count) { submittedTriangles.fetch_add(count, std::memory_order_relaxed); }
+    uint64_t GetLastFrameTriangles() const { return lastFrameTriangles; }
+
+    // 메시릿 CPU 컬링 결과 누적 (워커 쓰레드에서도 호출), 제출 삼각형 수와 같이 프레임 단위로 리셋
+    void AddClusterCullStats(const Meshlets::CullStats& stats, uint64_t cullNanoseconds);
+
+    // PBR PSO 선택: 퍼뮤테이션이 켜져 있으면 feature mask 로 특수화된 PSO, 아니면 런타임 분기 PSO
+    // compactVertex 면 CompactMeshVertex 입력 레이아웃 + 디코드 VS 버전
+    ID3D12PipelineState* GetPbrPipelineState(uint32_t featureMask, bool bindless, bool compactVertex = false);
+
+    // Bindless PBR 패스 공통 상태 (heap, RS, PSO, 패스 상수/테이블) 바인딩
+    // 이후 드로우는 b0 와 materialIndex root constant 만 설정하면 된다
+    void BindBindlessPbrState(ID3D12GraphicsCommandList* commandList);
 
 
     // Direct queue(그래픽스) 접근자
     ID3D12Device* GetDevice() const;
     ID3D12CommandQueue* GetDirectQueue() const;
     void WaitForDirectQueue();
+    UINT64 GetDirectFenceValue() const;     // 다음에 Signal 될 값 (디스크립터 지연 해제 기준)
+    UINT64 GetCompletedDirectFenceValue() const;
 
     // Copy queue(업로드 전용) 접근자
     ID3D12CommandQueue* GetCopyQueue() const;
@@ -81,7 +115,10 @@ public:
     ShaderManager* GetShaderManager() const;
     DescriptorHeapManager* GetDescriptorHeapManager() const;
     TextureManager* GetTextureManager() const;
+    TextureStreamer* GetTextureStreamer() const;
+    AssetLoader* GetAssetLoader() const;
     LightingManager* GetLightingManager() const;
+    MaterialTable* GetMaterialTable() const;
 
     ThreadPool* GetThreadPool();
 
@@ -113,6 +150,8 @@ private:
     void RecordCommandList_SingleThreaded();
 
     void RenderMultiThreaded();
+
+    void UpdateStatsImGui();
     void WorkerThread(UINT threadIndex, FrameResource* frameResource, std::barrier<>& syncPoint);
 
 public:
@@ -156,6 +195,37 @@ private:
     UINT numWorkerThreads;
 
     bool useMultiThreadedRendering = false;
+    bool useBindlessMaterials = true;
+    bool useShaderPermutations = true;
+    bool useStaticShadowCache = true;       // 정적 캐스터를 별도 레이어에 캐시하고 동적 캐스터와 합성
+    bool useInstancedShadowFaces = true;    // 캐스터당 드로우 1번으로 라이트의 모든 면 기록 (VS 의 SV_ViewportArrayIndex 를 지원할 때만)
+    bool useCompactVertices = true;         // ModelLoader 메시를 CompactMeshVertex(20B) 로 업로드
+    bool useMeshLods = true;                // 화면 크기에 따라 메시 LOD 선택 (끄면 항상 LOD0)
+    bool useClusterCulling = true;          // LOD0 메시릿을 절두체 / 노멀 콘으로 컬링하고 보이는 구간만 드로우
+    bool useTextureStreaming = true;        // 2D 텍스쳐를 tiled 리소스로 만들고 화면 텍셀 밀도 / VRAM 예산에 따라 밉 단위로 상주
+
+    float lodErrorThresholdPixels = 1.0f;
+
+    // 제출 삼각형 통계
+    std::atomic<uint64_t> submittedTriangles = 0;
+    uint64_t lastFrameTriangles = 0;
+
+    // 메시릿 컬링 통계
+    struct ClusterCullFrameStats
+    {
+        uint64_t tested = 0;
+        uint64_t frustumCulled = 0;
+        uint64_t coneCulled = 0;
+        uint64_t cullNanoseconds = 0;
+    };
+    std::atomic<uint64_t> clustersTested = 0;
+    std::atomic<uint64_t> clustersFrustumCulled = 0;
+    std::atomic<uint64_t> clustersConeCulled = 0;
+    std::atomic<uint64_t> clusterCullNanoseconds = 0;
+    ClusterCullFrameStats lastFrameClusters;
+
+    // 통계 창이 접혀 있으면 드로우별 시간 측정 생략
+    bool statsWindowVisible = true;
 
     // Direct queue
     ComPtr<ID3D12CommandQueue>           directQueue;
@@ -186,6 +256,9 @@ private:
     std::unique_ptr<DescriptorHeapManager>   descriptorHeapManager;
     std::unique_ptr<TextureManager>          textureManager;
     std::unique_ptr<LightingManager>         lightingManager;
+    std::unique_ptr<MaterialTable>           materialTable;
+    std::unique_ptr<TextureStreamer>         textureStreamer;
+    std::unique_ptr<AssetLoader>             assetLoader;      // TextureManager 보다 먼저 소멸 (로더 스레드 join)
 
     std::vector<std::shared_ptr<GameObject>> gameObjects;
     std::vector<std::shared_ptr<GameObject>> opaqueObjects;
@@ -204,5 +277,9 @@ private:
     UINT currentFrameIndex = 0;
     FrameResource* currentFrameResource = nullptr;
 
+    // 시작 시간 측정 (Initialize 진입 ~ 첫 Render)
+    std::chrono::high_resolution_clock::time_point startupStartTime;
+    bool firstFrameLogged = false;
+
 
 };
@@ -1,17 +1,39 @@
 #include "RootSignatureManager.h"
 #include "ShadowMap.h"
+#include "ThreadPool.h"
 #include <stdexcept>
 #include <format>
 #include <assert.h>
+#include <climits>
+
+namespace
+{
+    // RootSignatureId 순서와 동일
+    constexpr const wchar_t* RootSignatureNames[] = {
+        L"TriangleRS",
+        L"PhongRS",
+        L"PbrRS",
+        L"PbrBindlessRS",
+        L"SkyboxRS",
+        L"DebugNormalRS",
+        L"PostProcessRS",
+        L"ShadowMapPassRS",
+        L"ShadowMapInstancedRS",
+        L"ShadowTileCopyRS",
+    };
+    static_assert(_countof(RootSignatureNames) == static_cast<size_t>(RootSignatureId::Count));
+}
 
 RootSignatureManager::RootSignatureManager(ID3D12Device* device_)
     : device(device_)
 {
 }
 
-bool RootSignatureManager::InitializeDescs()
+bool RootSignatureManager::InitializeDescs(ThreadPool* threadPool)
 {
     signatureMap.clear();
+    pendingSignatures.clear();
+    creationPool = threadPool;
 
     // 1) TriangleRS 생성
     {
@@ -88,7 +110,7 @@ bool RootSignatureManager::InitializeDescs()
     // 3) PBR용 루트 시그니처 PbrRS 생성
     {
         // b0~b4: CBV (b0=MVP, b1=Lighting, b2=Material, b3=Global, b4=ShadowViewProj)
-        D3D12_ROOT_PARAMETER params[11] = {};
+        D3D12_ROOT_PARAMETER params[13] = {};
         for (UINT i = 0; i < 5; ++i)
         {
             params[i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
@@ -157,10 +179,10 @@ bool RootSignatureManager::InitializeDescs()
         params[9].DescriptorTable.pDescriptorRanges = &sampRange;
         params[9].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
-        // ShadowMap → root 10
+        // ShadowAtlas → root 10
         D3D12_DESCRIPTOR_RANGE shadowRange{};
         shadowRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
-        shadowRange.NumDescriptors = MAX_SHADOW_DSV_COUNT;       // t7 ~ t7+N-1
+        shadowRange.NumDescriptors = 1;                       // t7: ShadowAtlas
         shadowRange.BaseShaderRegister = 7;                   // t7
         shadowRange.RegisterSpace = 0;
         shadowRange.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
@@ -170,7 +192,15 @@ bool RootSignatureManager::InitializeDescs()
         params[10].DescriptorTable.pDescriptorRanges = &shadowRange;
         params[10].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
-   
+        // 클러스터드 라이팅 (root SRV) → root 11 (t8: 라이트), root 12 (t9: 클러스터 목록)
+        for (UINT i = 0; i < 2; ++i)
+        {
+            params[11 + i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+            params[11 + i].Descriptor.ShaderRegister = 8 + i;
+            params[11 + i].Descriptor.RegisterSpace = 0;
+            params[11 + i].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+        }
+
 
         D3D12_STATIC_SAMPLER_DESC shadowMapSamplerDesc{};
         shadowMapSamplerDesc.Filter = D3D12_FILTER_COMPARISON_MIN_MAG_MIP_LINEAR;
@@ -200,6 +230,134 @@ bool RootSignatureManager::InitializeDescs()
     }
 
 
+    // 3-1) Bindless PBR 루트 시그니처 PbrBindlessRS
+    //  - 머티리얼은 StructuredBuffer(root SRV) 한 줄, 텍스쳐는 힙 전체를 unbounded 테이블로 본다
+    //  - 드로우마다 바뀌는 건 b0(MVP) 와 root constant(materialIndex) 뿐
+    {
+        D3D12_ROOT_PARAMETER1 params[14] = {};
+
+        // b0 MVP (VS), b1 Lighting, b3 Global, b4 ShadowViewProj
+        const UINT cbvSlots[4] = { 0, 1, 3, 4 };
+        for (UINT slot : cbvSlots)
+        {
+            params[slot].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+            params[slot].Descriptor.ShaderRegister = slot;
+            params[slot].Descriptor.RegisterSpace = 0;
+            params[slot].Descriptor.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_NONE;
+            params[slot].ShaderVisibility = (slot == 0)
+                ? D3D12_SHADER_VISIBILITY_VERTEX
+                : D3D12_SHADER_VISIBILITY_PIXEL;
+        }
+
+        // b2: materialIndex (root constant 1개)
+        params[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+        params[2].Constants.ShaderRegister = 2;
+        params[2].Constants.RegisterSpace = 0;
+        params[2].Constants.Num32BitValues = 1;
+        params[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+        // t0, space1: 머티리얼 테이블 (root SRV) → root 5
+        params[5].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+        params[5].Descriptor.ShaderRegister = 0;
+        params[5].Descriptor.RegisterSpace = 1;
+        params[5].Descriptor.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE;
+        params[5].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+        // t0.., space2: 힙 전체 텍스쳐 (unbounded) → root 6
+        D3D12_DESCRIPTOR_RANGE1 textureRange{};
+        textureRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+        textureRange.NumDescriptors = UINT_MAX;
+        textureRange.BaseShaderRegister = 0;
+        textureRange.RegisterSpace = 2;
+        textureRange.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DESCRIPTORS_VOLATILE;
+        textureRange.OffsetInDescriptorsFromTableStart = 0;
+
+        params[6].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+        params[6].DescriptorTable.NumDescriptorRanges = 1;
+        params[6].DescriptorTable.pDescriptorRanges = &textureRange;
+        params[6].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+        // IBL (t4, t5, t6) → root 7, 8, 9
+        D3D12_DESCRIPTOR_RANGE1 iblRanges[3] = {};
+        for (UINT i = 0; i < 3; ++i)
+        {
+            iblRanges[i].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+            iblRanges[i].NumDescriptors = 1;
+            iblRanges[i].BaseShaderRegister = 4 + i;
+            iblRanges[i].RegisterSpace = 0;
+            iblRanges[i].Flags = D3D12_DESCRIPTOR_RANGE_FLAG_NONE;
+            iblRanges[i].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+
+            params[7 + i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+            params[7 + i].DescriptorTable.NumDescriptorRanges = 1;
+            params[7 + i].DescriptorTable.pDescriptorRanges = &iblRanges[i];
+            params[7 + i].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+        }
+
+        // Sampler (s0~s1) → root 10
+        D3D12_DESCRIPTOR_RANGE1 samplerRange{};
+        samplerRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER;
+        samplerRange.NumDescriptors = 2;
+        samplerRange.BaseShaderRegister = 0;
+        samplerRange.RegisterSpace = 0;
+        samplerRange.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_NONE;
+        samplerRange.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+
+        params[10].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+        params[10].DescriptorTable.NumDescriptorRanges = 1;
+        params[10].DescriptorTable.pDescriptorRanges = &samplerRange;
+        params[10].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+        // ShadowAtlas (t7) → root 11
+        D3D12_DESCRIPTOR_RANGE1 shadowRange{};
+        shadowRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+        shadowRange.NumDescriptors = 1;
+        shadowRange.BaseShaderRegister = 7;
+        shadowRange.RegisterSpace = 0;
+        shadowRange.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_NONE;
+        shadowRange.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+
+        params[11].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+        params[11].DescriptorTable.NumDescriptorRanges = 1;
+        params[11].DescriptorTable.pDescriptorRanges = &shadowRange;
+        params[11].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+        // 클러스터드 라이팅 (root SRV) → root 12 (t8: 라이트), root 13 (t9: 클러스터 목록)
+        for (UINT i = 0; i < 2; ++i)
+        {
+            params[12 + i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+            params[12 + i].Descriptor.ShaderRegister = 8 + i;
+            params[12 + i].Descriptor.RegisterSpace = 0;
+            params[12 + i].Descriptor.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE;
+            params[12 + i].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+        }
+
+        D3D12_STATIC_SAMPLER_DESC shadowMapSamplerDesc{};
+        shadowMapSamplerDesc.Filter = D3D12_FILTER_COMPARISON_MIN_MAG_MIP_LINEAR;
+        shadowMapSamplerDesc.AddressU = D3D12_TEXTURE_ADDRESS_MODE_BORDER;
+        shadowMapSamplerDesc.AddressV = D3D12_TEXTURE_ADDRESS_MODE_BORDER;
+        shadowMapSamplerDesc.AddressW = D3D12_TEXTURE_ADDRESS_MODE_BORDER;
+        shadowMapSamplerDesc.ComparisonFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL;
+        shadowMapSamplerDesc.BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE;
+        shadowMapSamplerDesc.MinLOD = 0;
+        shadowMapSamplerDesc.MaxLOD = D3D12_FLOAT32_MAX;
+        shadowMapSamplerDesc.ShaderRegister = 2;
+        shadowMapSamplerDesc.RegisterSpace = 0;
+        shadowMapSamplerDesc.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+        D3D12_VERSIONED_ROOT_SIGNATURE_DESC desc{};
+        desc.Version = D3D_ROOT_SIGNATURE_VERSION_1_1;
+        desc.Desc_1_1.NumParameters = _countof(params);
+        desc.Desc_1_1.pParameters = params;
+        desc.Desc_1_1.NumStaticSamplers = 1;
+        desc.Desc_1_1.pStaticSamplers = &shadowMapSamplerDesc;
+        desc.Desc_1_1.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+
+        if (!Create(L"PbrBindlessRS", desc))
+            throw std::runtime_error("RootSignatureManager::Create(\"PbrBindlessRS\") failed");
+    }
+
+
     // 4) Skybox(큐브맵)용 루트 시그니처
     {
         // b0 : CB_MVP (world-view-proj)
@@ -343,10 +501,131 @@ bool RootSignatureManager::InitializeDescs()
         Create(L"ShadowMapPassRS", shadowDesc);
     }
 
+    // ShadowMapInstanced RS : 캐스터 1번 드로우로 라이트의 모든 면 기록 (SV_ViewportArrayIndex)
+    {
+        // b0 : CBV (오브젝트 MVP 의 model), b1 : CBV (면별 lightViewProj), b2 : root constant (faceMask, firstFace)
+        D3D12_ROOT_PARAMETER instancedParams[3] = {};
+
+        for (UINT i = 0; i < 2; ++i)
+        {
+            instancedParams[i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+            instancedParams[i].Descriptor.ShaderRegister = i;  // b0, b1
+            instancedParams[i].Descriptor.RegisterSpace = 0;
+            instancedParams[i].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+        }
+
+        instancedParams[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+        instancedParams[2].Constants.ShaderRegister = 2;   // b2
+        instancedParams[2].Constants.RegisterSpace = 0;
+        instancedParams[2].Constants.Num32BitValues = 2;
+        instancedParams[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+        D3D12_ROOT_SIGNATURE_DESC instancedDesc = {};
+        instancedDesc.NumParameters = _countof(instancedParams);
+        instancedDesc.pParameters = instancedParams;
+        instancedDesc.NumStaticSamplers = 0;
+        instancedDesc.pStaticSamplers = nullptr;
+        instancedDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+
+        Create(L"ShadowMapInstancedRS", instancedDesc);
+    }
+
+    // ShadowTileCopy RS : 정적 레이어 타일 → 메인 아틀라스 타일 깊이 복사 (풀스크린 삼각형, SV_Depth)
+    {
+        // t0 : 정적 레이어 깊이 SRV 테이블
+        D3D12_DESCRIPTOR_RANGE copyRange = {};
+        copyRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+        copyRange.NumDescriptors = 1;
+        copyRange.BaseShaderRegister = 0;      // t0
+        copyRange.RegisterSpace = 0;
+        copyRange.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+
+        D3D12_ROOT_PARAMETER copyParams[1] = {};
+        copyParams[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+        copyParams[0].DescriptorTable.NumDescriptorRanges = 1;
+        copyParams[0].DescriptorTable.pDescriptorRanges = &copyRange;
+        copyParams[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+        // 정점 버퍼 없이 SV_VertexID 로 삼각형을 만들므로 IA 플래그 불필요
+        D3D12_ROOT_SIGNATURE_DESC copyDesc = {};
+        copyDesc.NumParameters = _countof(copyParams);
+        copyDesc.pParameters = copyParams;
+        copyDesc.NumStaticSamplers = 0;
+        copyDesc.pStaticSamplers = nullptr;
+        copyDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
+
+        Create(L"ShadowTileCopyRS", copyDesc);
+    }
+
+    // 비동기 모드면 WaitForPendingCreates 에서 갱신
+    if (!creationPool)
+        ResolveHandles();
 
     return true;
 }
 
+void RootSignatureManager::ResolveHandles()
+{
+    for (size_t i = 0; i < signatureHandles.size(); ++i)
+        signatureHandles[i] = Get(RootSignatureNames[i]);
+}
+
+const wchar_t* RootSignatureManager::GetName(RootSignatureId id)
+{
+    return RootSignatureNames[static_cast<size_t>(id)];
+}
+
+bool RootSignatureManager::WaitForPendingCreates()
+{
+    // 풀 전체 대기 (셰이더 컴파일 등 다른 작업이 남아있으면 같이 기다림)
+    if (creationPool && !pendingSignatures.empty())
+        creationPool->Wait();
+    creationPool = nullptr;
+
+    bool succeeded = true;
+    for (auto& pending : pendingSignatures) {
+        if (!pending->succeeded) {
+            OutputDebugStringA("CreateRootSignature failed\n");
+            succeeded = false;
+            continue;
+        }
+        signatureMap[pending->name] = pending->signature;
+    }
+
+    pendingSignatures.clear();
+    ResolveHandles();
+    return succeeded;
+}
+
+bool RootSignatureManager::CreateFromBlob(const std::wstring& name, ComPtr<ID3DBlob> blob)
+{
+    auto pending = std::make_unique<PendingSignature>();
+    pending->name = name;
+    pending->blob = std::move(blob);
+
+    // CreateRootSignature 는 free-threaded
+    auto createJob = [this, job = pending.get()]() {
+        job->succeeded = SUCCEEDED(device->CreateRootSignature(
+            0,
+            job->blob->GetBufferPointer(),
+            job->blob->GetBufferSize(),
+            IID_PPV_ARGS(&job->signature)));
+    };
+
+    if (creationPool) {
+        creationPool->Submit(createJob);
+        pendingSignatures.push_back(std::move(pending));
+        return true;
+    }
+
+    createJob();
+    if (!pending->succeeded)
+        return false;
+
+    signatureMap[name] = pending->signature;
+    return true;
+}
+
 
 bool RootSignatureManager::Create(
     const std::wstring& name,
@@ -371,18 +650,7 @@ bool RootSignatureManager::Create(
         return false;
     }
 
-    ComPtr<ID3D12RootSignature> rootSignature;
-    hr = device->CreateRootSignature(
-        0,
-        blob->GetBufferPointer(),
-        blob->GetBufferSize(),
-        IID_PPV_ARGS(&rootSignature)
-    );
-    if (FAILED(hr))
-        return false;
-
-    signatureMap[name] = rootSignature;
-    return true;
+    return CreateFromBlob(name, blob);
 }
 
 bool RootSignatureManager::Create(const std::wstring& name,
@@ -418,29 +686,8 @@ bool RootSignatureManager::Create(const std::wstring& name,
         return false;
     }
 
-    // 4) CreateRootSignature 호출
-    //    v1.1 지원 시 ID3D12Device1, 아니면 ID3D12Device
-    ComPtr<ID3D12RootSignature> signature;
-    if (supportV11) {
-        ComPtr<ID3D12Device1> device1;
-        if (FAILED(device->QueryInterface(IID_PPV_ARGS(&device1))))
-            return false;
-        hr = device1->CreateRootSignature(
-            0, blob->GetBufferPointer(), blob->GetBufferSize(),
-            IID_PPV_ARGS(&signature));
-    }
-    else {
-        hr = device->CreateRootSignature(
-            0, blob->GetBufferPointer(), blob->GetBufferSize(),
-            IID_PPV_ARGS(&signature));
-    }
-    if (FAILED(hr)) {
-        OutputDebugStringA("CreateRootSignature failed\n");
-        return false;
-    }
-
-    signatureMap.emplace(name, signature);
-    return true;
+    // 4) CreateRootSignature 호출 (1.1 blob 도 ID3D12Device 로 생성 가능)
+    return CreateFromBlob(name, blob);
 }
 
 ID3D12RootSignature* RootSignatureManager::Get(
@@ -451,6 +698,8 @@ ID3D12RootSignature* RootSignatureManager::Get(
 }
 
 void RootSignatureManager::Cleanup() {
+    WaitForPendingCreates();
     signatureMap.clear();
+    signatureHandles.fill(nullptr);
     device = nullptr;
 }
@@ -2,18 +2,45 @@
 
 #include <d3d12.h>
 #include <wrl.h>
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 using namespace Microsoft::WRL;
 
+class ThreadPool;
+
+// 드로우 경로용 정수 핸들 (초기화 후 배열 조회만 하므로 문자열 해시 없음)
+// RootSignatureNames 와 순서를 맞출 것
+enum class RootSignatureId : uint8_t {
+    TriangleRS = 0,
+    PhongRS,
+    PbrRS,
+    PbrBindlessRS,
+    SkyboxRS,
+    DebugNormalRS,
+    PostProcessRS,
+    ShadowMapPassRS,
+    ShadowMapInstancedRS,
+    ShadowTileCopyRS,
+    Count
+};
+
 class RootSignatureManager {
 public:
 
     // explicit 키워드는 C 기반의 초기화 방지 (형변환을 방지함)
     explicit RootSignatureManager(ID3D12Device* device_);
 
-    bool InitializeDescs();
+    // threadPool 이 있으면 직렬화만 여기서 하고 CreateRootSignature 는 풀에서 비동기로 진행
+    // (셰이더 컴파일과 겹쳐서 실행됨) → PSO 생성 전에 WaitForPendingCreates() 호출 필요
+    bool InitializeDescs(ThreadPool* threadPool = nullptr);
+
+    // 비동기 생성 완료 대기 후 결과를 등록 (하나라도 실패하면 false)
+    bool WaitForPendingCreates();
 
     // v1
     bool Create(const std::wstring& name,
@@ -24,10 +51,35 @@ public:
         const D3D12_VERSIONED_ROOT_SIGNATURE_DESC& desc);
 
 
+    // 이름 조회 (툴/디버그용)
     ID3D12RootSignature* Get(const std::wstring& name) const;
+
+    // 핸들 조회 (핫패스용, O(1))
+    ID3D12RootSignature* Get(RootSignatureId id) const { return signatureHandles[static_cast<size_t>(id)]; }
+
+    static const wchar_t* GetName(RootSignatureId id);
+
     void Cleanup();
 
 private:
+    // 직렬화된 blob 으로 루트 시그니처 생성 (비동기 모드면 풀에 제출)
+    bool CreateFromBlob(const std::wstring& name, ComPtr<ID3DBlob> blob);
+
+    // 생성 완료 후 RootSignatureId → 포인터 테이블 갱신
+    void ResolveHandles();
+
+    struct PendingSignature
+    {
+        std::wstring name;
+        ComPtr<ID3DBlob> blob;
+        ComPtr<ID3D12RootSignature> signature;
+        bool succeeded = false;
+    };
+
     ID3D12Device* device; 
     std::unordered_map<std::wstring, ComPtr<ID3D12RootSignature>> signatureMap;
+    std::array<ID3D12RootSignature*, static_cast<size_t>(RootSignatureId::Count)> signatureHandles{};   // signatureMap 이 소유
+
+    ThreadPool* creationPool = nullptr;
+    std::vector<std::unique_ptr<PendingSignature>> pendingSignatures;
 };
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <unordered_set>
+#include "HashUtil.h"
+
+// ---------------------------------------------------------------------------
+// Shader archive (.pak) 포맷
+// 오프라인 쿠커(Tools/ShaderCooker, DXC)가 쓰고 ShaderManager 가 memory-map 으로 읽는다.
+// 플랫폼 독립 헤더만 사용할 것 (Linux 빌드 머신에서도 컴파일됨)
+//
+//   ArchiveHeader
+//   ArchiveEntry[entryCount]      // nameHash 기준 정렬 (이진 탐색)
+//   name 문자열 영역 (UTF-16LE, null 없음)
+//   bytecode 영역 (각 blob 16바이트 정렬)
+// ---------------------------------------------------------------------------
+namespace ShaderArchive
+{
+    static constexpr uint32_t Magic = 0x4B415053;    // 'SPAK'
+    static constexpr uint32_t Version = 2;
+
+    struct ArchiveHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t shaderModel;       // 쿠킹에 쓴 최소 SM (D3D_SHADER_MODEL 값, 0x60 = 6_0)
+    };
+
+    struct ArchiveEntry
+    {
+        uint64_t nameHash;          // HashName(name)
+        uint64_t sourceHash;        // 소스 + 재귀 include 파일 내용
+        uint64_t optionsHash;       // entry / profile / flags / defines
+        uint64_t nameOffset;        // 파일 시작 기준
+        uint32_t nameLength;        // UTF-16 코드 유닛 개수
+        uint32_t reserved;
+        uint64_t bytecodeOffset;
+        uint64_t bytecodeSize;
+    };
+
+    inline uint64_t HashName(std::wstring_view name)
+    {
+        Hasher hasher;
+        hasher.AddString(name);
+        return hasher.Value();
+    }
+
+    // "6_0" → 0x60 (형식이 맞지 않으면 0)
+    inline uint32_t ParseShaderModel(std::string_view model)
+    {
+        const size_t underscore = model.find('_');
+        if (underscore != 1 || model.size() != 3 ||
+            model[0] < '0' || model[0] > '9' || model[2] < '0' || model[2] > '9')
+            return 0;
+        return uint32_t(model[0] - '0') << 4 | uint32_t(model[2] - '0');
+    }
+
+    // FXC 프로필(vs_5_0 등)을 DXC 가 지원하는 최소 SM 으로 올린다
+    // 쿠커와 런타임(optionsHash 비교)이 같은 규칙을 쓰도록 여기에 둔다
+    inline std::string ToDxcProfile(const std::string& profile, uint32_t minShaderModel)
+    {
+        const size_t underscore = profile.find('_');
+        if (underscore == std::string::npos)
+            return profile;
+
+        const std::string stage = profile.substr(0, underscore);
+        if (ParseShaderModel(std::string_view(profile).substr(underscore + 1)) >= minShaderModel)
+            return profile;
+        return stage + "_" + std::to_string(minShaderModel >> 4) + "_" + std::to_string(minShaderModel & 0xF);
+    }
+
+    // entry / DXC 프로필 / define(NAME=VALUE, 순서 유지) / 최적화 옵션
+    inline uint64_t HashOptions(
+        std::string_view entryPoint,
+        std::string_view dxcProfile,
+        const std::vector<std::string>& defines,
+        std::string_view optimization = "-O3")
+    {
+        Hasher hasher;
+        hasher.AddString(entryPoint);
+        hasher.AddString(dxcProfile);
+        for (const auto& define : defines)
+            hasher.AddString(std::string_view(define));
+        hasher.AddString(optimization);
+        return hasher.Value();
+    }
+
+    // 소스 파일과 #include "..." 로 포함된 파일들을 재귀적으로 해시
+    // (D3D_COMPILE_STANDARD_FILE_INCLUDE / DXC 기본 동작처럼 포함한 파일 기준 상대경로)
+    inline void HashSourceTree(
+        const std::filesystem::path& file,
+        Hasher& hasher,
+        std::unordered_set<std::wstring>& visited,
+        std::vector<std::filesystem::path>* dependencies = nullptr)
+    {
+        std::error_code ec;
+        const std::filesystem::path fullPath = std::filesystem::weakly_canonical(file, ec);
+        if (!visited.insert(fullPath.wstring()).second)
+            return;     // 이미 해시함 (#pragma once 등)
+
+        std::ifstream stream(fullPath, std::ios::binary);
+        if (!stream) {
+            hasher.AddString(std::string_view("<missing>"));
+            return;
+        }
+
+        if (dependencies)
+            dependencies->push_back(fullPath);
+
+        std::string source(
+            (std::istreambuf_iterator<char>(stream)),
+            std::istreambuf_iterator<char>());
+
+        // 체크아웃 환경(CRLF/LF)에 관계없이 같은 해시가 나오도록 '\r' 제거
+        std::erase(source, '\r');
+        hasher.AddString(std::string_view(source));
+
+        size_t lineStart = 0;
+        while (lineStart < source.size()) {
+            size_t lineEnd = source.find('\n', lineStart);
+            if (lineEnd == std::string::npos)
+                lineEnd = source.size();
+
+            std::string_view line(source.data() + lineStart, lineEnd - lineStart);
+            const size_t firstChar = line.find_first_not_of(" \t");
+            if (firstChar != std::string_view::npos && line.substr(firstChar).starts_with("#include")) {
+                const size_t open = line.find_first_of("\"<", firstChar);
+                const size_t close = (open == std::string_view::npos)
+                    ? std::string_view::npos
+                    : line.find_first_of("\">", open + 1);
+                if (close != std::string_view::npos) {
+                    const std::string includeName(line.substr(open + 1, close - open - 1));
+                    HashSourceTree(fullPath.parent_path() / includeName, hasher, visited, dependencies);
+                }
+            }
+
+            lineStart = lineEnd + 1;
+        }
+    }
+
+    inline uint64_t HashSource(const std::filesystem::path& file)
+    {
+        Hasher hasher;
+        std::unordered_set<std::wstring> visited;
+        HashSourceTree(file, hasher, visited);
+        return hasher.Value();
+    }
+}
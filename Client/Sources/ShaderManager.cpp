@@ -1,5 +1,13 @@
 #include "ShaderManager.h"
+#include "ThreadPool.h"
+#include "HashUtil.h"
+#include "ShaderArchive.h"
+#include "DebugManager.h"
 #include <stdexcept>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <format>
 
 ShaderManager::ShaderManager(ID3D12Device* device_)
     : device(device_)
@@ -16,6 +24,8 @@ bool ShaderManager::Init(ID3D12Device* device_) {
 
 void ShaderManager::Cleanup() {
     shaders.clear();
+    baseDescs.clear();
+    archive.reset();
     device = nullptr;
 }
 
@@ -39,23 +49,394 @@ bool ShaderManager::Compile(
     return true;
 }
 
+// 메모리 매핑된 .pak 파일 (ShaderManager 와 모든 MappedShaderBlob 이 해제될 때 Unmap)
+struct ShaderManager::MappedArchiveFile
+{
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+    const uint8_t* data = nullptr;
+    uint64_t size = 0;
+
+    ~MappedArchiveFile()
+    {
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+    }
+};
+
+namespace
+{
+    // 매핑된 메모리를 복사 없이 가리키는 ID3DBlob
+    class MappedShaderBlob : public ID3DBlob
+    {
+    public:
+        MappedShaderBlob(std::shared_ptr<const void> owner_, const void* data_, SIZE_T size_)
+            : owner(std::move(owner_)), data(data_), size(size_) {}
+
+        HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** object) override
+        {
+            if (!object)
+                return E_POINTER;
+            if (riid == __uuidof(IUnknown) || riid == __uuidof(ID3D10Blob)) {
+                *object = static_cast<ID3DBlob*>(this);
+                AddRef();
+                return S_OK;
+            }
+            *object = nullptr;
+            return E_NOINTERFACE;
+        }
+
+        ULONG STDMETHODCALLTYPE AddRef() override { return InterlockedIncrement(&refCount); }
+
+        ULONG STDMETHODCALLTYPE Release() override
+        {
+            const ULONG count = InterlockedDecrement(&refCount);
+            if (count == 0)
+                delete this;
+            return count;
+        }
+
+        LPVOID STDMETHODCALLTYPE GetBufferPointer() override { return const_cast<void*>(data); }
+        SIZE_T STDMETHODCALLTYPE GetBufferSize() override { return size; }
+
+    private:
+        ULONG refCount = 1;
+        std::shared_ptr<const void> owner;      // 매핑 수명 유지
+        const void* data = nullptr;
+        SIZE_T size = 0;
+    };
+
+    // 쿠커(Tools/ShaderCooker)와 같은 규칙의 optionsHash. 쿠커는 항상 -O3 이므로 다른 플래그는 불일치로 취급
+    uint64_t HashArchiveOptions(const ShaderCompileDesc& desc, uint32_t shaderModel)
+    {
+        std::vector<std::string> defines;
+        defines.reserve(desc.defines.size());
+        for (const auto& define : desc.defines)
+            defines.push_back(std::string(define.Name ? define.Name : "") + "=" + (define.Definition ? define.Definition : ""));
+
+        const std::string optimization = desc.compileFlags == D3DCOMPILE_OPTIMIZATION_LEVEL3
+            ? std::string("-O3")
+            : std::format("flags={:#x}", desc.compileFlags);
+
+        return ShaderArchive::HashOptions(desc.entryPoint,
+            ShaderArchive::ToDxcProfile(desc.profile, shaderModel), defines, optimization);
+    }
+}
+
+bool ShaderManager::LoadArchive(
+    const std::wstring& archivePath,
+    const std::vector<ShaderCompileDesc>& shaderDescs)
+{
+    using namespace ShaderArchive;
+
+    // 1) 파일 매핑
+    auto mapped = std::make_shared<MappedArchiveFile>();
+    mapped->file = CreateFileW(archivePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (mapped->file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(mapped->file, &fileSize) || fileSize.QuadPart < LONGLONG(sizeof(ArchiveHeader)))
+        return false;
+    mapped->size = static_cast<uint64_t>(fileSize.QuadPart);
+
+    mapped->mapping = CreateFileMappingW(mapped->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapped->mapping)
+        return false;
+    mapped->data = static_cast<const uint8_t*>(MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!mapped->data)
+        return false;
+
+    // 2) 헤더 / 인덱스 검증
+    const auto* header = reinterpret_cast<const ArchiveHeader*>(mapped->data);
+    if (header->magic != Magic || header->version != Version)
+        return false;
+    if (sizeof(ArchiveHeader) + uint64_t(header->entryCount) * sizeof(ArchiveEntry) > mapped->size)
+        return false;
+
+    // 3) DXIL 은 드라이버가 해당 SM 을 지원할 때만 (FL 11_0 장치는 SM 5.1 까지일 수 있음)
+    D3D12_FEATURE_DATA_SHADER_MODEL shaderModel{ static_cast<D3D_SHADER_MODEL>(header->shaderModel) };
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_SHADER_MODEL, &shaderModel, sizeof(shaderModel))) ||
+        shaderModel.HighestShaderModel < static_cast<D3D_SHADER_MODEL>(header->shaderModel))
+    {
+        DebugManager::GetInstance().LogMessage(std::format(
+            L"[Shader] Device does not support shader model {}.{} of the archive, falling back to runtime compile",
+            header->shaderModel >> 4, header->shaderModel & 0xF));
+        return false;
+    }
+
+    // 4) 모든 셰이더가 있고 소스가 바뀌지 않았을 때만 사용 (하나라도 아니면 런타임 컴파일로 폴백)
+    archive = mapped;
+
+    std::unordered_map<std::wstring, ComPtr<ID3DBlob>> loaded;
+    for (const auto& desc : shaderDescs) {
+        ComPtr<ID3DBlob> blob = FindInArchive(desc);
+        if (!blob) {
+            archive.reset();
+            return false;
+        }
+        loaded[desc.name] = blob;
+    }
+
+    shaders = std::move(loaded);
+    baseDescs.clear();
+    for (const auto& desc : shaderDescs)
+        baseDescs[desc.name] = desc;
+
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[Shader] Loaded {} shaders from archive {}", shaders.size(), archivePath));
+    return true;
+}
+
+ComPtr<ID3DBlob> ShaderManager::FindInArchive(const ShaderCompileDesc& desc) const
+{
+    using namespace ShaderArchive;
+
+    if (!archive)
+        return nullptr;
+
+    const auto* header = reinterpret_cast<const ArchiveHeader*>(archive->data);
+    const auto* entriesBegin = reinterpret_cast<const ArchiveEntry*>(archive->data + sizeof(ArchiveHeader));
+    const auto* entriesEnd = entriesBegin + header->entryCount;
+
+    const uint64_t nameHash = HashName(desc.name);
+    const ArchiveEntry* entry = std::lower_bound(entriesBegin, entriesEnd, nameHash,
+        [](const ArchiveEntry& e, uint64_t hash) { return e.nameHash < hash; });
+    if (entry == entriesEnd || entry->nameHash != nameHash)
+        return nullptr;
+
+    if (entry->nameOffset + uint64_t(entry->nameLength) * sizeof(char16_t) > archive->size ||
+        entry->bytecodeOffset + entry->bytecodeSize > archive->size)
+        return nullptr;
+
+    const auto* name = reinterpret_cast<const wchar_t*>(archive->data + entry->nameOffset);
+    if (std::wstring_view(name, entry->nameLength) != desc.name)
+        return nullptr;
+
+    // entry / profile / flags / defines 가 쿠킹 때와 다르면 (매니페스트와 desc 목록 불일치 등) 사용하지 않음
+    if (HashArchiveOptions(desc, header->shaderModel) != entry->optionsHash) {
+        DebugManager::GetInstance().LogMessage(
+            L"[Shader] Archive options differ for " + desc.name + L", falling back to runtime compile");
+        return nullptr;
+    }
+
+    // 배포 빌드처럼 소스가 없으면 아카이브를 그대로 신뢰
+    if (std::filesystem::exists(desc.path) && HashSource(desc.path) != entry->sourceHash) {
+        DebugManager::GetInstance().LogMessage(
+            L"[Shader] Archive is stale for " + desc.name + L", falling back to runtime compile");
+        return nullptr;
+    }
+
+    ComPtr<ID3DBlob> blob;
+    blob.Attach(new MappedShaderBlob(
+        archive,
+        archive->data + entry->bytecodeOffset,
+        static_cast<SIZE_T>(entry->bytecodeSize)));
+    return blob;
+}
+
 // 여러 쉐이더를 한 번에 컴파일
 bool ShaderManager::CompileAll(
-    const std::vector<ShaderCompileDesc>& shaderDescs)
+    const std::vector<ShaderCompileDesc>& shaderDescs,
+    ThreadPool* threadPool)
 {
     shaders.clear();
-    for (const auto& desc : shaderDescs) {
+    archive.reset();
+
+    baseDescs.clear();
+    for (const auto& desc : shaderDescs)
+        baseDescs[desc.name] = desc;
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    size_t compiledCount = 0;
+    if (!CompileBatch(shaderDescs, threadPool, &compiledCount))
+        return false;
+
+    const auto endTime = std::chrono::high_resolution_clock::now();
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[Shader] CompileAll: {:.2f} ms (cached {}, compiled {})",
+        std::chrono::duration<double, std::milli>(endTime - startTime).count(),
+        shaderDescs.size() - compiledCount,
+        compiledCount));
+
+    return true;
+}
+
+bool ShaderManager::CompileBatch(
+    const std::vector<ShaderCompileDesc>& shaderDescs,
+    ThreadPool* threadPool,
+    size_t* outCompiledCount)
+{
+    std::filesystem::create_directories(cacheDirectory);
+
+    struct CompileJob
+    {
+        const ShaderCompileDesc* desc = nullptr;
+        std::wstring cachePath;
         ComPtr<ID3DBlob> blob;
-        if (!Compile(desc, blob))
+        ComPtr<ID3DBlob> errorBlob;
+        bool succeeded = false;
+    };
+
+    // 1) 캐시 조회: 해시가 같은 .cso 가 있으면 읽기만 한다
+    std::vector<CompileJob> jobs;
+    for (const auto& desc : shaderDescs) {
+        const std::wstring cachePath = GetCachePath(desc, ComputeShaderHash(desc));
+
+        ComPtr<ID3DBlob> cached;
+        if (std::filesystem::exists(cachePath) &&
+            SUCCEEDED(D3DReadFileToBlob(cachePath.c_str(), &cached))) {
+            shaders[desc.name] = cached;
+            continue;
+        }
+
+        CompileJob job;
+        job.desc = &desc;
+        job.cachePath = cachePath;
+        jobs.push_back(std::move(job));
+    }
+
+    // 2) 캐시 미스만 컴파일 (D3DCompile 은 스레드 안전)
+    auto compileJob = [this](CompileJob& job) {
+        job.succeeded = compiler.Compile(*job.desc, job.blob, job.errorBlob);
+        if (job.succeeded)
+            D3DWriteBlobToFile(job.blob.Get(), job.cachePath.c_str(), TRUE);
+    };
+
+    if (threadPool && jobs.size() > 1) {
+        for (auto& job : jobs)
+            threadPool->Submit([&compileJob, &job]() { compileJob(job); });
+        threadPool->Wait();
+    }
+    else {
+        for (auto& job : jobs)
+            compileJob(job);
+    }
+
+    // 3) 결과 수집 및 에러 보고 (메인 스레드)
+    for (auto& job : jobs) {
+        if (!job.succeeded) {
+            if (job.errorBlob)
+                OutputDebugStringA(
+                    static_cast<const char*>(job.errorBlob->GetBufferPointer()));
+
+#if defined(_DEBUG)
+            throw std::runtime_error("Shader compilation failed: " +
+                std::string(job.desc->path.begin(), job.desc->path.end()));
+#endif
             return false;
-        shaders[desc.name] = blob;
+        }
+        shaders[job.desc->name] = job.blob;
     }
+
+    if (outCompiledCount)
+        *outCompiledCount = jobs.size();
     return true;
 }
 
+ComPtr<ID3DBlob> ShaderManager::GetOrCompilePermutation(
+    const std::wstring& baseName,
+    const std::wstring& suffix,
+    const std::vector<D3D_SHADER_MACRO>& extraDefines)
+{
+    const std::wstring name = baseName + L"_" + suffix;
+
+    // 1) 이미 만든 퍼뮤테이션
+    ShaderCompileDesc desc;
+    {
+        std::shared_lock<std::shared_mutex> lock(shaderMutex);
+        if (auto it = shaders.find(name); it != shaders.end())
+            return it->second;
+
+        auto base = baseDescs.find(baseName);
+        if (base == baseDescs.end()) {
+            throw std::runtime_error(
+                "Base shader not found: " +
+                std::string(baseName.begin(), baseName.end()));
+        }
+        desc = base->second;
+    }
+
+    desc.name = name;
+    desc.defines.insert(desc.defines.end(), extraDefines.begin(), extraDefines.end());
+
+    // 2) 아카이브 사용 중이면 아카이브에서만 (DXIL 과 DXBC 를 한 PSO 에 섞을 수 없음)
+    //    아니면 디스크 캐시 / 컴파일 (defines 가 해시에 포함되어 같은 변형은 한 번만 컴파일)
+    ComPtr<ID3DBlob> blob;
+    if (archive) {
+        blob = FindInArchive(desc);
+        if (!blob) {
+            DebugManager::GetInstance().LogMessage(
+                L"[Shader] Permutation missing from archive: " + name);
+            return nullptr;
+        }
+    }
+    else {
+        blob = LoadOrCompile(desc);
+        if (!blob)
+            return nullptr;
+    }
+
+    // 3) 같은 이름을 다른 스레드가 먼저 등록했으면 그쪽을 사용
+    std::unique_lock<std::shared_mutex> lock(shaderMutex);
+    return shaders.try_emplace(name, blob).first->second;
+}
+
+ComPtr<ID3DBlob> ShaderManager::LoadOrCompile(const ShaderCompileDesc& desc)
+{
+    const std::wstring cachePath = GetCachePath(desc, ComputeShaderHash(desc));
+
+    ComPtr<ID3DBlob> blob;
+    if (std::filesystem::exists(cachePath) &&
+        SUCCEEDED(D3DReadFileToBlob(cachePath.c_str(), &blob)))
+        return blob;
+
+    ComPtr<ID3DBlob> errorBlob;
+    if (!compiler.Compile(desc, blob, errorBlob)) {
+        if (errorBlob)
+            OutputDebugStringA(static_cast<const char*>(errorBlob->GetBufferPointer()));
+        DebugManager::GetInstance().LogMessage(L"[Shader] Failed to compile " + desc.name);
+        return nullptr;
+    }
+
+    std::filesystem::create_directories(cacheDirectory);
+    D3DWriteBlobToFile(blob.Get(), cachePath.c_str(), TRUE);
+    return blob;
+}
+
+uint64_t ShaderManager::ComputeShaderHash(const ShaderCompileDesc& desc) const
+{
+    Hasher hasher;
+
+    // 컴파일러가 바뀌면 캐시 무효화
+    hasher.AddValue(static_cast<uint32_t>(D3D_COMPILER_VERSION));
+
+    std::unordered_set<std::wstring> visited;
+    ShaderArchive::HashSourceTree(desc.path, hasher, visited);
+
+    hasher.AddString(std::string_view(desc.entryPoint));
+    hasher.AddString(std::string_view(desc.profile));
+    hasher.AddValue(desc.compileFlags);
+    for (const auto& define : desc.defines) {
+        hasher.AddString(std::string_view(define.Name ? define.Name : ""));
+        hasher.AddString(std::string_view(define.Definition ? define.Definition : ""));
+    }
+
+    return hasher.Value();
+}
+
+std::wstring ShaderManager::GetCachePath(const ShaderCompileDesc& desc, uint64_t hash) const
+{
+    return (std::filesystem::path(cacheDirectory) / (desc.name + L"_" + HashToHex(hash) + L".cso")).wstring();
+}
+
 
 ComPtr<ID3DBlob> ShaderManager::GetShaderBlob(const std::wstring& shaderName) const
 {
+    std::shared_lock<std::shared_mutex> lock(shaderMutex);
     auto it = shaders.find(shaderName);
     if (it == shaders.end()) {
         throw std::runtime_error(
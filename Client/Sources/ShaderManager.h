@@ -3,12 +3,16 @@
 
 #include <d3d12.h>
 #include <wrl/client.h>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include "ShaderCompileDesc.h"
 #include "ShaderCompiler.h"
 
+class ThreadPool;
+
 using Microsoft::WRL::ComPtr;
 
 class ShaderManager {
@@ -20,17 +24,60 @@ public:
     void Cleanup();
 
     // 여러 ShaderCompileDesc를 받아서 한 번에 컴파일
-    bool CompileAll(const std::vector<ShaderCompileDesc>& shaderDescs);
+    // 디스크 캐시(소스+include+entry/profile/flags/defines 해시)에 있으면 읽기만 하고,
+    // 없는 것만 threadPool 에서 병렬 컴파일 (threadPool == nullptr 이면 순차)
+    bool CompileAll(const std::vector<ShaderCompileDesc>& shaderDescs, ThreadPool* threadPool = nullptr);
+
+    // 오프라인 쿠커(Tools/ShaderCooker)가 만든 .pak 을 memory-map 하여 사용
+    // 장치가 아카이브의 SM 을 지원하고, shaderDescs 가 모두 같은 옵션으로 있고, 소스가 최신일 때만 true
+    // (false 면 CompileAll 로 폴백)
+    bool LoadArchive(const std::wstring& archivePath, const std::vector<ShaderCompileDesc>& shaderDescs);
+
+    // 기본 셰이더(baseName)에 define 을 추가한 퍼뮤테이션 (이름: <baseName>_<suffix>)
+    // 이미 있으면 그대로 반환, 없으면 아카이브 → 디스크 캐시 → 컴파일 순으로 찾는다
+    // extraDefines 의 문자열은 정적 수명이어야 한다 (D3D_SHADER_MACRO 가 포인터만 보관)
+    // 초기화 이후 여러 스레드에서 호출 가능 (컴파일은 잠금 밖에서 진행)
+    ComPtr<ID3DBlob> GetOrCompilePermutation(
+        const std::wstring& baseName,
+        const std::wstring& suffix,
+        const std::vector<D3D_SHADER_MACRO>& extraDefines);
+
+    void SetCacheDirectory(const std::wstring& directory) { cacheDirectory = directory; }
 
     ComPtr<ID3DBlob> GetShaderBlob(const std::wstring& shaderName) const;
     D3D12_SHADER_BYTECODE GetShaderBytecode(const std::wstring& shaderName) const;
 
 
 private:
+    struct MappedArchiveFile;
+
+    // 캐시 조회 + 미스 컴파일 (shaders 에 추가만 하고 비우지 않음)
+    bool CompileBatch(const std::vector<ShaderCompileDesc>& shaderDescs, ThreadPool* threadPool, size_t* outCompiledCount);
+
+    // 매핑된 아카이브에서 desc 를 찾는다 (없거나 옵션/소스가 바뀌었으면 nullptr)
+    ComPtr<ID3DBlob> FindInArchive(const ShaderCompileDesc& desc) const;
+
     // 한 개의 ShaderCompileDesc를 ShaderCompiler로 컴파일
     bool Compile(const ShaderCompileDesc& desc, ComPtr<ID3DBlob>& outBlob);
 
+    // 디스크 캐시 조회 + 미스 컴파일 (shaders 를 건드리지 않으므로 잠금 없이 호출 가능)
+    ComPtr<ID3DBlob> LoadOrCompile(const ShaderCompileDesc& desc);
+
+    // 캐시 키: 소스 + 재귀 #include 파일 내용 (ShaderArchive::HashSourceTree) + 컴파일 옵션
+    uint64_t ComputeShaderHash(const ShaderCompileDesc& desc) const;
+
+    std::wstring GetCachePath(const ShaderCompileDesc& desc, uint64_t hash) const;
+
+    std::wstring cacheDirectory = L"Cache/Shaders";
+
+    // 퍼뮤테이션 생성을 위해 기본 desc 와 매핑된 아카이브를 유지
+    std::unordered_map<std::wstring, ShaderCompileDesc> baseDescs;
+    std::shared_ptr<MappedArchiveFile> archive;
+
     ID3D12Device* device = nullptr;
     ShaderCompiler compiler;
     std::unordered_map<std::wstring, ComPtr<ID3DBlob>> shaders;
+
+    // 퍼뮤테이션 생성(워커 스레드)과 GetShaderBlob 이 shaders / baseDescs 를 동시에 접근
+    mutable std::shared_mutex shaderMutex;
 };
@@ -0,0 +1,125 @@
+#include "ShadowAtlas.h"
+#include "Lights/BaseLight.h"
+#include "Camera.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+    // Z-order 인덱스의 짝수 비트만 모음 (x 또는 y 좌표 복원)
+    uint32_t CompactBits(uint32_t value)
+    {
+        value &= 0x55555555u;
+        value = (value | (value >> 1)) & 0x33333333u;
+        value = (value | (value >> 2)) & 0x0F0F0F0Fu;
+        value = (value | (value >> 4)) & 0x00FF00FFu;
+        value = (value | (value >> 8)) & 0x0000FFFFu;
+        return value;
+    }
+
+    uint32_t ClampTileSize(uint32_t size)
+    {
+        if (size == 0)
+            return 0;
+        size = std::bit_ceil(size);
+        return std::clamp(size, SHADOW_ATLAS_MIN_TILE, SHADOW_MAP_WIDTH);
+    }
+}
+
+void ShadowAtlas::Allocate(const std::vector<uint32_t>& requestedSizes)
+{
+    const size_t faceCount = requestedSizes.size();
+    tiles.assign(faceCount, ShadowAtlasTile{});
+
+    std::vector<uint32_t> sizes(faceCount);
+    for (size_t i = 0; i < faceCount; ++i)
+        sizes[i] = ClampTileSize(requestedSizes[i]);
+
+    // 1) 예산 (texel 수). 아틀라스 면적을 넘을 수 없음
+    const uint64_t atlasTexels = uint64_t(SHADOW_ATLAS_SIZE) * SHADOW_ATLAS_SIZE;
+    const uint64_t budgetTexels = std::min(atlasTexels, memoryBudgetBytes / SHADOW_ATLAS_BYTES_PER_TEXEL);
+
+    auto totalTexels = [&sizes]() {
+        uint64_t sum = 0;
+        for (uint32_t size : sizes)
+            sum += uint64_t(size) * size;
+        return sum;
+    };
+
+    // 2) 넘치면 가장 큰 요청부터 절반 (같은 크기면 뒤쪽 면 = 낮은 우선순위부터)
+    //    최소 크기에서도 넘치면 그 면은 그림자 없음
+    while (totalTexels() > budgetTexels)
+    {
+        size_t victim = faceCount;
+        for (size_t i = 0; i < faceCount; ++i)
+        {
+            if (sizes[i] != 0 && (victim == faceCount || sizes[i] >= sizes[victim]))
+                victim = i;
+        }
+        if (victim == faceCount)
+            break;
+
+        sizes[victim] = (sizes[victim] > SHADOW_ATLAS_MIN_TILE) ? sizes[victim] / 2 : 0;
+    }
+
+    // 3) 큰 타일부터 Z-order 로 이어 붙임
+    //    내림차순 2의 거듭제곱이라 offset 이 항상 자기 크기에 정렬되어 쿼드트리 노드와 일치
+    std::vector<size_t> order(faceCount);
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::stable_sort(order.begin(), order.end(),
+        [&sizes](size_t a, size_t b) { return sizes[a] > sizes[b]; });
+
+    uint32_t cellOffset = 0;    // SHADOW_ATLAS_MIN_TILE² 셀 단위
+    usedTexels = 0;
+    for (size_t face : order)
+    {
+        const uint32_t size = sizes[face];
+        if (size == 0)
+            break;
+
+        const uint32_t cellsPerSide = size / SHADOW_ATLAS_MIN_TILE;
+
+        ShadowAtlasTile& tile = tiles[face];
+        tile.x = CompactBits(cellOffset) * SHADOW_ATLAS_MIN_TILE;
+        tile.y = CompactBits(cellOffset >> 1) * SHADOW_ATLAS_MIN_TILE;
+        tile.size = size;
+
+        cellOffset += cellsPerSide * cellsPerSide;
+        usedTexels += uint64_t(size) * size;
+    }
+}
+
+XMFLOAT4 ShadowAtlas::GetScaleOffset(size_t face) const
+{
+    if (face >= tiles.size() || tiles[face].size == 0)
+        return XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f);
+
+    const ShadowAtlasTile& tile = tiles[face];
+    const float invAtlasSize = 1.0f / static_cast<float>(SHADOW_ATLAS_SIZE);
+    return XMFLOAT4(
+        tile.size * invAtlasSize, tile.size * invAtlasSize,
+        tile.x * invAtlasSize, tile.y * invAtlasSize);
+}
+
+uint32_t ShadowAtlas::ComputeRequestedSize(const BaseLight& light, const Camera& camera, float viewportHeight)
+{
+    const float range = light.GetShadowRange();
+    if (range <= 0.0f || !camera.IsPerspective())
+        return SHADOW_MAP_WIDTH;
+
+    // 1) 카메라가 영향 구 안이면 최대 해상도
+    XMFLOAT3 cameraPosition = camera.GetPosition();
+    XMVECTOR toLight = XMVectorSubtract(XMLoadFloat3(&light.GetPosition()), XMLoadFloat3(&cameraPosition));
+    const float distance = XMVectorGetX(XMVector3Length(toLight));
+    if (distance <= range)
+        return SHADOW_MAP_WIDTH;
+
+    // 2) 영향 구가 화면에 투영된 지름 (pixel) 만큼 요청
+    const float tanHalfFovY = std::tan(camera.GetFovY() * 0.5f);
+    const float projectedRadius = range / (std::sqrt(distance * distance - range * range) * tanHalfFovY);
+    const float diameterPixels = projectedRadius * viewportHeight;
+
+    return ClampTileSize(static_cast<uint32_t>(std::max(diameterPixels, 1.0f)));
+}
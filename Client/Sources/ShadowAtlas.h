@@ -0,0 +1,52 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+#include "ShadowMap.h"
+
+using namespace DirectX;
+
+class BaseLight;
+class Camera;
+
+// 아틀라스 안의 정사각 타일 (texel 단위). size == 0 이면 이번 프레임 배정 없음
+struct ShadowAtlasTile
+{
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t size = 0;
+};
+
+// ---------------------------------------------------------------------------
+// 단일 섀도우 아틀라스 타일 배정기
+//   1) 면마다 화면 커버리지로 희망 해상도(2의 거듭제곱) 결정
+//   2) 메모리 예산을 넘으면 가장 큰 요청부터 절반으로 줄임
+//   3) 큰 타일부터 쿼드트리(Z-order) 순서로 배치 → 예산 안이면 항상 빈틈없이 들어감
+// ---------------------------------------------------------------------------
+class ShadowAtlas
+{
+public:
+    // requestedSizes[face]: 면별 희망 해상도 (0 = 그림자 없음)
+    void Allocate(const std::vector<uint32_t>& requestedSizes);
+
+    size_t GetTileCount() const { return tiles.size(); }
+    const ShadowAtlasTile& GetTile(size_t face) const { return tiles[face]; }
+
+    // 셰이더용: atlasUV = faceUV * xy + zw (미배정 타일은 0)
+    XMFLOAT4 GetScaleOffset(size_t face) const;
+
+    // 예산은 아틀라스 크기를 넘지 못함
+    void SetMemoryBudget(uint64_t bytes) { memoryBudgetBytes = bytes; }
+    uint64_t GetMemoryBudget() const { return memoryBudgetBytes; }
+    uint64_t GetUsedBytes() const { return usedTexels * SHADOW_ATLAS_BYTES_PER_TEXEL; }
+
+    // 라이트 면 하나의 희망 해상도 (Directional 은 항상 최대)
+    static uint32_t ComputeRequestedSize(const BaseLight& light, const Camera& camera, float viewportHeight);
+
+private:
+    std::vector<ShadowAtlasTile> tiles;
+
+    uint64_t memoryBudgetBytes = uint64_t(SHADOW_ATLAS_SIZE) * SHADOW_ATLAS_SIZE * SHADOW_ATLAS_BYTES_PER_TEXEL;
+    uint64_t usedTexels = 0;
+};
@@ -0,0 +1,97 @@
+#include "ShadowCascades.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ShadowCascades
+{
+    void ComputeSplitDistances(float nearZ, float farZ, uint32_t cascadeCount, float lambda, float* outSplits)
+    {
+        outSplits[0] = nearZ;
+        for (uint32_t i = 1; i <= cascadeCount; ++i)
+        {
+            const float p = static_cast<float>(i) / static_cast<float>(cascadeCount);
+            const float logSplit = nearZ * std::pow(farZ / nearZ, p);
+            const float uniformSplit = nearZ + (farZ - nearZ) * p;
+            outSplits[i] = lambda * logSplit + (1.0f - lambda) * uniformSplit;
+        }
+        outSplits[cascadeCount] = farZ;     // 부동소수 오차 제거
+    }
+
+    BoundingSphere ComputeSliceBoundingSphere(float fovY, float aspectRatio, float sliceNear, float sliceFar)
+    {
+        // k: 뷰 축에서 모서리까지의 기울기 (대각선 절반 / 깊이)
+        const float tanHalfFovY = std::tan(fovY * 0.5f);
+        const float k2 = (1.0f + aspectRatio * aspectRatio) * tanHalfFovY * tanHalfFovY;
+
+        // 1) 중심이 far 평면 위에 있어도 near 모서리를 포함하면 far 사각형의 외접원이 최소
+        // 2) 아니면 near/far 모서리까지 거리가 같아지는 지점
+        float centerZ;
+        if (k2 >= (sliceFar - sliceNear) / (sliceFar + sliceNear))
+            centerZ = sliceFar;
+        else
+            centerZ = 0.5f * (sliceFar + sliceNear) * (1.0f + k2);
+
+        const float farRadiusSq = (sliceFar - centerZ) * (sliceFar - centerZ) + sliceFar * sliceFar * k2;
+        const float nearRadiusSq = (centerZ - sliceNear) * (centerZ - sliceNear) + sliceNear * sliceNear * k2;
+
+        BoundingSphere sphere;
+        sphere.Center = XMFLOAT3(0.0f, 0.0f, centerZ);
+        sphere.Radius = std::sqrt(std::max(farRadiusSq, nearRadiusSq));
+        return sphere;
+    }
+
+    XMMATRIX ComputeCascadeViewProj(
+        const BoundingSphere& worldSphere,
+        FXMVECTOR lightDirection,
+        uint32_t shadowMapResolution,
+        float casterExtension)
+    {
+        // 1) 원점 기준의 고정 라이트 view (카메라 위치와 무관하게 방향만 사용)
+        XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+        if (std::fabs(XMVectorGetX(XMVector3Dot(up, lightDirection))) > 0.99f)
+            up = XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+
+        const XMMATRIX lightView = XMMatrixLookToLH(XMVectorZero(), lightDirection, up);
+
+        // 2) 반지름 양자화 → 프레임마다 미세하게 변해도 텍셀 크기가 고정됨
+        const float radius = std::ceil(worldSphere.Radius * 16.0f) / 16.0f;
+        const float texelSize = 2.0f * radius / static_cast<float>(shadowMapResolution);
+
+        // 3) 라이트 공간 중심을 텍셀 격자에 스냅
+        XMFLOAT3 center;
+        XMStoreFloat3(&center, XMVector3TransformCoord(XMLoadFloat3(&worldSphere.Center), lightView));
+        center.x = std::floor(center.x / texelSize) * texelSize;
+        center.y = std::floor(center.y / texelSize) * texelSize;
+
+        const XMMATRIX lightProj = XMMatrixOrthographicOffCenterLH(
+            center.x - radius, center.x + radius,
+            center.y - radius, center.y + radius,
+            center.z - radius - casterExtension, center.z + radius);
+
+        return lightView * lightProj;
+    }
+
+    bool Intersects(const XMMATRIX& viewProj, const BoundingSphere& sphere)
+    {
+        // 행 벡터 규약(v * M)에서 열 조합으로 평면 추출 (Gribb-Hartmann)
+        const XMMATRIX columns = XMMatrixTranspose(viewProj);
+        const XMVECTOR planes[6] = {
+            columns.r[3] + columns.r[0],    // left
+            columns.r[3] - columns.r[0],    // right
+            columns.r[3] + columns.r[1],    // bottom
+            columns.r[3] - columns.r[1],    // top
+            columns.r[2],                   // near (z >= 0)
+            columns.r[3] - columns.r[2],    // far
+        };
+
+        const XMVECTOR center = XMVectorSetW(XMLoadFloat3(&sphere.Center), 1.0f);
+        for (const XMVECTOR& plane : planes)
+        {
+            const float length = XMVectorGetX(XMVector3Length(plane));
+            const float distance = XMVectorGetX(XMVector4Dot(plane, center)) / length;
+            if (distance < -sphere.Radius)
+                return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <DirectXCollision.h>
+#include <cstdint>
+
+using namespace DirectX;
+
+// ---------------------------------------------------------------------------
+// Cascaded Shadow Map 계산 (DirectionalLight 전용)
+//   - 분할: log / uniform 블렌드 (practical split scheme)
+//   - 피팅: 서브 프러스텀을 감싸는 최소 구 → 카메라 회전에 크기가 변하지 않음
+//   - 안정화: 고정된 라이트 공간에서 ortho 범위를 텍셀 단위로 스냅 (shimmering 방지)
+// ---------------------------------------------------------------------------
+namespace ShadowCascades
+{
+    // outSplits[0] = nearZ, outSplits[cascadeCount] = farZ (cascadeCount + 1 개)
+    // lambda: 0 = uniform, 1 = logarithmic
+    void ComputeSplitDistances(float nearZ, float farZ, uint32_t cascadeCount, float lambda, float* outSplits);
+
+    // 원근 카메라의 [sliceNear, sliceFar] 구간을 감싸는 최소 구 (뷰 공간 z 축 위에 중심)
+    BoundingSphere ComputeSliceBoundingSphere(float fovY, float aspectRatio, float sliceNear, float sliceFar);
+
+    // 월드 공간 구를 덮는 텍셀 스냅된 라이트 view * ortho 행렬
+    // casterExtension: 구 밖(라이트 쪽)에 있는 캐스터도 담기 위해 near 평면을 당기는 거리
+    XMMATRIX ComputeCascadeViewProj(
+        const BoundingSphere& worldSphere,
+        FXMVECTOR lightDirection,
+        uint32_t shadowMapResolution,
+        float casterExtension);
+
+    // viewProj 절두체(D3D, z ∈ [0,1])와 구의 교차 여부 (ortho/perspective 모두 사용 가능)
+    bool Intersects(const XMMATRIX& viewProj, const BoundingSphere& sphere);
+}
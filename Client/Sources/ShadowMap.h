@@ -8,10 +8,16 @@
 
 using Microsoft::WRL::ComPtr;
 
+// 면(캐스케이드/큐브면) 하나가 받을 수 있는 최대 타일 해상도
 constexpr UINT SHADOW_MAP_WIDTH = 2048;
 constexpr UINT SHADOW_MAP_HEIGHT = 2048;
 
-constexpr INT MAX_SHADOW_DSV_COUNT = NUM_DIR_LIGHTS + NUM_SPOT_LIGHTS + 6 * NUM_POINT_LIGHTS;
+// 모든 면이 타일로 들어가는 단일 섀도우 아틀라스 (Common.hlsli 와 동일하게)
+constexpr UINT SHADOW_ATLAS_SIZE = 4096;
+constexpr UINT SHADOW_ATLAS_MIN_TILE = 128;
+constexpr UINT SHADOW_ATLAS_BYTES_PER_TEXEL = 4;    // D24S8
+
+constexpr INT MAX_SHADOW_DSV_COUNT = NUM_CASCADES * NUM_DIR_LIGHTS + NUM_SPOT_LIGHTS + 6 * NUM_POINT_LIGHTS;
 
 struct ShadowMap
 {
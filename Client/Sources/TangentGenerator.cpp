@@ -0,0 +1,236 @@
+#include "TangentGenerator.h"
+#include "MeshVertex.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace DirectX;
+
+namespace
+{
+    constexpr float kEpsilon = 1e-6f;
+    constexpr size_t kMinItemsPerTask = 4096;
+
+    // 작업 수: 쓰레드 수 이하, 작업당 최소 kMinItemsPerTask 개
+    size_t GetTaskCount(ThreadPool* threadPool, size_t count)
+    {
+        if (!threadPool)
+            return 1;
+        return std::clamp<size_t>(count / kMinItemsPerTask, 1, threadPool->GetThreadCount());
+    }
+
+    // [0, count) 를 taskCount 개 구간으로 나눠 ThreadPool 에 제출하고 완료까지 대기
+    // func(taskIndex, begin, end)
+    template<typename Func>
+    void ParallelFor(ThreadPool* threadPool, size_t count, size_t taskCount, Func&& func)
+    {
+        if (!threadPool || taskCount <= 1) {
+            func(size_t(0), size_t(0), count);
+            return;
+        }
+
+        const size_t chunk = (count + taskCount - 1) / taskCount;
+        for (size_t task = 0; task < taskCount; ++task) {
+            const size_t begin = std::min(task * chunk, count);
+            const size_t end = std::min(begin + chunk, count);
+            threadPool->Submit([&func, task, begin, end]() { func(task, begin, end); });
+        }
+        threadPool->Wait();
+    }
+
+    XMFLOAT3 Subtract(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+    float Dot(const XMFLOAT3& a, const XMFLOAT3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    // v 에서 n 방향 성분 제거 후 정규화 (길이가 0 이면 false)
+    bool ProjectAndNormalize(XMFLOAT3& v, const XMFLOAT3& n)
+    {
+        const float d = Dot(n, v);
+        v = { v.x - n.x * d, v.y - n.y * d, v.z - n.z * d };
+        const float length = std::sqrt(Dot(v, v));
+        if (length <= kEpsilon)
+            return false;
+        v = { v.x / length, v.y / length, v.z / length };
+        return true;
+    }
+
+    XMFLOAT3 NormalizedOrZero(const XMFLOAT3& v)
+    {
+        const float length = std::sqrt(Dot(v, v));
+        return length > 0.0f ? XMFLOAT3{ v.x / length, v.y / length, v.z / length } : XMFLOAT3{ 0.0f, 0.0f, 0.0f };
+    }
+
+    // 삼각형 하나의 코너 탄젠트 3개 계산
+    void ComputeCornerTangents(const MeshVertex* vertices, const uint32_t tri[3],
+        TangentGenerator::Mode mode, XMFLOAT3 outCorners[3])
+    {
+        const XMFLOAT3& p0 = vertices[tri[0]].position;
+        const XMFLOAT3& p1 = vertices[tri[1]].position;
+        const XMFLOAT3& p2 = vertices[tri[2]].position;
+
+        const XMFLOAT2& uv0 = vertices[tri[0]].texCoord;
+        const XMFLOAT2& uv1 = vertices[tri[1]].texCoord;
+        const XMFLOAT2& uv2 = vertices[tri[2]].texCoord;
+
+        const XMFLOAT3 dp1 = Subtract(p1, p0);
+        const XMFLOAT3 dp2 = Subtract(p2, p0);
+
+        const float du1 = uv1.x - uv0.x;
+        const float dv1 = uv1.y - uv0.y;
+        const float du2 = uv2.x - uv0.x;
+        const float dv2 = uv2.y - uv0.y;
+
+        float denom = du1 * dv2 - dv1 * du2;
+
+        if (mode == TangentGenerator::Mode::Legacy) {
+            // 기존 ComputeTangents 와 같은 연산 순서 (결과 비트 단위 동일)
+            if (fabsf(denom) < kEpsilon) denom = kEpsilon;
+            const float inv = 1.0f / denom;
+            const XMFLOAT3 tangent = {
+                (dp1.x * dv2 - dp2.x * dv1) * inv,
+                (dp1.y * dv2 - dp2.y * dv1) * inv,
+                (dp1.z * dv2 - dp2.z * dv1) * inv };
+            outCorners[0] = outCorners[1] = outCorners[2] = tangent;
+            return;
+        }
+
+        // MikkTSpace: UV 가 퇴화된 면은 기여하지 않음, 크기는 UV 스케일과 무관하게 정규화
+        outCorners[0] = outCorners[1] = outCorners[2] = { 0.0f, 0.0f, 0.0f };
+        if (fabsf(denom) < kEpsilon)
+            return;
+
+        const float sign = denom < 0.0f ? -1.0f : 1.0f;
+        const XMFLOAT3 faceTangent = {
+            (dp1.x * dv2 - dp2.x * dv1) * sign,
+            (dp1.y * dv2 - dp2.y * dv1) * sign,
+            (dp1.z * dv2 - dp2.z * dv1) * sign };
+
+        for (int corner = 0; corner < 3; ++corner) {
+            const MeshVertex& v = vertices[tri[corner]];
+            const XMFLOAT3 n = NormalizedOrZero(v.normal);
+
+            // 코너 각도는 정점 노멀 평면에 투영한 두 변 사이 각
+            XMFLOAT3 edge1 = Subtract(vertices[tri[(corner + 1) % 3]].position, v.position);
+            XMFLOAT3 edge2 = Subtract(vertices[tri[(corner + 2) % 3]].position, v.position);
+            XMFLOAT3 tangent = faceTangent;
+            if (!ProjectAndNormalize(edge1, n) || !ProjectAndNormalize(edge2, n) || !ProjectAndNormalize(tangent, n))
+                continue;
+
+            const float angle = std::acos(std::clamp(Dot(edge1, edge2), -1.0f, 1.0f));
+            outCorners[corner] = { tangent.x * angle, tangent.y * angle, tangent.z * angle };
+        }
+    }
+
+    // 노멀과 수직인 임의의 단위 벡터 (MikkTSpace 모드에서 탄젠트가 정의되지 않는 정점용)
+    XMFLOAT3 AnyPerpendicular(const XMFLOAT3& normal)
+    {
+        const XMFLOAT3 n = NormalizedOrZero(normal);
+        const XMFLOAT3 axis = fabsf(n.x) < 0.9f ? XMFLOAT3{ 1.0f, 0.0f, 0.0f } : XMFLOAT3{ 0.0f, 1.0f, 0.0f };
+        XMFLOAT3 t = axis;
+        if (!ProjectAndNormalize(t, n))
+            return { 1.0f, 0.0f, 0.0f };
+        return t;
+    }
+}
+
+namespace TangentGenerator
+{
+    void Generate(MeshVertex* vertices, size_t vertexCount,
+        const uint32_t* indices, size_t indexCount,
+        Mode mode, ThreadPool* threadPool)
+    {
+        const size_t triangleCount = indexCount / 3;
+        if (!vertices || !indices || vertexCount == 0 || triangleCount == 0) return;
+
+        // 작업마다 정점 전체 크기의 SoA 누적 버퍼 (x / y / z 순서로 vertexCount 개씩)
+        const size_t accumTaskCount = GetTaskCount(threadPool, triangleCount);
+        std::vector<float> accum(accumTaskCount * 3 * vertexCount, 0.0f);
+        auto accumSlice = [&](size_t task, size_t axis) { return accum.data() + (task * 3 + axis) * vertexCount; };
+
+        // 1) 삼각형 구간별로 코너 탄젠트를 자기 버퍼에 누적 (쓰기 충돌 없음)
+        ParallelFor(threadPool, triangleCount, accumTaskCount, [&](size_t task, size_t begin, size_t end) {
+            float* accumX = accumSlice(task, 0);
+            float* accumY = accumSlice(task, 1);
+            float* accumZ = accumSlice(task, 2);
+
+            for (size_t t = begin; t < end; ++t) {
+                const uint32_t* tri = &indices[t * 3];
+                if (tri[0] >= vertexCount || tri[1] >= vertexCount || tri[2] >= vertexCount)
+                    continue;
+
+                XMFLOAT3 corners[3];
+                ComputeCornerTangents(vertices, tri, mode, corners);
+                for (int k = 0; k < 3; ++k) {
+                    accumX[tri[k]] += corners[k].x;
+                    accumY[tri[k]] += corners[k].y;
+                    accumZ[tri[k]] += corners[k].z;
+                }
+            }
+        });
+
+        // 2) 정점 구간별로 작업 버퍼를 순서대로 합산 후 4개 단위 SIMD 정규화
+        //    작업이 하나면 기존 ComputeTangents 와 합산 순서가 같아 결과도 비트 단위로 동일
+        float* sumX = accumSlice(0, 0);
+        float* sumY = accumSlice(0, 1);
+        float* sumZ = accumSlice(0, 2);
+
+        ParallelFor(threadPool, vertexCount, GetTaskCount(threadPool, vertexCount), [&](size_t, size_t begin, size_t end) {
+            for (size_t task = 1; task < accumTaskCount; ++task) {
+                const float* x = accumSlice(task, 0);
+                const float* y = accumSlice(task, 1);
+                const float* z = accumSlice(task, 2);
+                for (size_t v = begin; v < end; ++v) {
+                    sumX[v] += x[v];
+                    sumY[v] += y[v];
+                    sumZ[v] += z[v];
+                }
+            }
+
+            // MikkTSpace: 최종 탄젠트도 정점 노멀에 직교
+            if (mode == Mode::MikkTSpace) {
+                for (size_t v = begin; v < end; ++v) {
+                    const XMFLOAT3 n = NormalizedOrZero(vertices[v].normal);
+                    const float d = n.x * sumX[v] + n.y * sumY[v] + n.z * sumZ[v];
+                    sumX[v] -= n.x * d;
+                    sumY[v] -= n.y * d;
+                    sumZ[v] -= n.z * d;
+                }
+            }
+
+            auto store = [&](size_t v, float x, float y, float z) {
+                if (mode == Mode::MikkTSpace && x == 0.0f && y == 0.0f && z == 0.0f)
+                    vertices[v].tangent = AnyPerpendicular(vertices[v].normal);
+                else
+                    vertices[v].tangent = { x, y, z };
+            };
+
+            size_t v = begin;
+            for (; v + 4 <= end; v += 4) {
+                const XMVECTOR x = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&sumX[v]));
+                const XMVECTOR y = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&sumY[v]));
+                const XMVECTOR z = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&sumZ[v]));
+
+                // FMA 로 합쳐지지 않도록 곱/합을 나눠서 계산 (스칼라 경로와 같은 결과)
+                const XMVECTOR lengthSq = XMVectorAdd(XMVectorAdd(XMVectorMultiply(x, x), XMVectorMultiply(y, y)), XMVectorMultiply(z, z));
+                const XMVECTOR length = XMVectorSqrt(lengthSq);
+                const XMVECTOR nonZero = XMVectorGreater(lengthSq, XMVectorZero());
+
+                XMFLOAT4 nx, ny, nz;
+                XMStoreFloat4(&nx, XMVectorSelect(XMVectorZero(), XMVectorDivide(x, length), nonZero));
+                XMStoreFloat4(&ny, XMVectorSelect(XMVectorZero(), XMVectorDivide(y, length), nonZero));
+                XMStoreFloat4(&nz, XMVectorSelect(XMVectorZero(), XMVectorDivide(z, length), nonZero));
+
+                store(v + 0, nx.x, ny.x, nz.x);
+                store(v + 1, nx.y, ny.y, nz.y);
+                store(v + 2, nx.z, ny.z, nz.z);
+                store(v + 3, nx.w, ny.w, nz.w);
+            }
+
+            for (; v < end; ++v) {
+                const XMFLOAT3 t = NormalizedOrZero({ sumX[v], sumY[v], sumZ[v] });
+                store(v, t.x, t.y, t.z);
+            }
+        });
+    }
+}
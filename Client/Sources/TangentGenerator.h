@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+struct MeshVertex;
+class ThreadPool;
+
+// ---------------------------------------------------------------------------
+// 임포트 시 탄젠트 생성 (Assimp 가 탄젠트를 주지 않을 때)
+//   1) 삼각형 구간을 작업으로 나눠 작업별 SoA 버퍼에 코너 탄젠트 누적 (병렬)
+//   2) 정점 구간별로 작업 버퍼를 순서대로 합산 후 4개 단위 SIMD 정규화 (병렬)
+// 작업이 하나(쓰레드풀 없음 / 작은 메시)면 기존 방식과 합산 순서가 같다
+// ---------------------------------------------------------------------------
+namespace TangentGenerator
+{
+    enum class Mode : uint8_t {
+        Legacy = 0,     // 기존 ModelLoader 방식: UV 면적으로 나눈 면 탄젠트 단순 합
+        MikkTSpace,     // 면 탄젠트 정규화 + 코너 각도 가중 + 정점 노멀 기준 직교화
+    };
+
+    // indices 는 vertices 기준 (서브메시는 baseVertex 위치의 포인터와 로컬 인덱스로 호출)
+    // threadPool 이 nullptr 이거나 작은 메시는 호출 쓰레드에서 처리
+    void Generate(MeshVertex* vertices, size_t vertexCount,
+        const uint32_t* indices, size_t indexCount,
+        Mode mode, ThreadPool* threadPool = nullptr);
+}
@@ -1,12 +1,21 @@
 #include "Texture.h"
 #include "Renderer.h"
+#include "TextureCache.h"
+#include "DebugManager.h"
 #include <DirectXTex.h>
+#include <atomic>
 #include <codecvt>
 #include <directx/d3dx12.h>
 
 using namespace DirectX;
 using Microsoft::WRL::ComPtr;
 
+namespace
+{
+    // 텍스쳐 간에도 겹치지 않도록 전역 카운터 (머티리얼 테이블이 텍스쳐 포인터 없이 비교)
+    std::atomic<UINT64> nextViewVersion{ 1 };
+}
+
 // 파일을 로드하여 GPU 텍스처 생성 후 COMMON 상태로 전환
 // (Copy 명령 Close → Execute → Fence Wait를 내부에서 처리)
 
@@ -14,59 +23,125 @@ bool Texture::LoadFromFile(Renderer* renderer, const std::wstring& filePath, boo
 {
     name = filePath;
 
-    // 렌더러에서 Copy 전용 커맨드 리스트/할당자/큐/펜스 정보 가져오기
-    ID3D12Device* device = renderer->GetDevice();
-    auto         copyList = renderer->GetCopyCommandList();
-    auto         copyAllocator = renderer->GetCopyCommandAllocator();
-    auto         copyQueue = renderer->GetCopyQueue();
-    auto         copyFence = renderer->GetCopyFence();
-    UINT64& copyFenceValue = renderer->GetCopyFenceValue();
+    ScratchImage scratchImage;
+    if (!DecodeFile(filePath, scratchImage))
+        return false;
+
+    return Upload(renderer, filePath, scratchImage);
+}
+
+bool Texture::LoadCubeMapFromFile(Renderer* renderer, const std::wstring& filePath, bool generateMips)
+{
+    name = filePath;
 
-    // 1) 이미지 로드 (DDS / WIC)
     ScratchImage scratchImage;
-    TexMetadata  metadata;
-    UINT         arraySize = 1;
-    UINT         mipLevels = 1;
+    if (!DecodeCubeMapFile(filePath, generateMips, scratchImage))
+        return false;
 
-    std::wstring ext = filePath.substr(filePath.find_last_of(L'.'));
-    if (_wcsicmp(ext.c_str(), L".dds") == 0)
+    return Upload(renderer, filePath, scratchImage);
+}
+
+bool Texture::DecodeFile(const std::wstring& filePath, ScratchImage& outImage)
+{
+    TexMetadata metadata;
+
+    // DDS는 이미 MIP 레벨 포함 (쿠킹 캐시면 디코드 / 밉 생성 없이 사용)
+    const std::filesystem::path ddsPath = FindDdsSource(filePath);
+    if (!ddsPath.empty() && SUCCEEDED(LoadFromDDSFile(ddsPath.c_str(), DDS_FLAGS_NONE, &metadata, outImage)))
+        return true;
+    if (_wcsicmp(std::filesystem::path(filePath).extension().c_str(), L".dds") == 0)
+        return false;
+
+    DebugManager::GetInstance().LogMessage(std::format(
+        L"[Texture] {} is not cooked, decoding with WIC (run TextureCooker)", filePath));
+
+    // WIC 로드: 원본 레벨만 (색상은 sRGB, 데이터 텍스쳐는 선형으로 읽어 쿠킹 결과와 같게)
+    const TextureCache::TextureRole role = TextureCache::GetRole(filePath);
+    const WIC_FLAGS colorSpace = role == TextureCache::TextureRole::Color ? WIC_FLAGS_DEFAULT_SRGB : WIC_FLAGS_IGNORE_SRGB;
+    ScratchImage baseImage;
+    if (FAILED(LoadFromWICFile(filePath.c_str(), WIC_FLAGS_FORCE_RGB | colorSpace, &metadata, baseImage)))
+        return false;
+
+    // BC4 로 쿠킹되는 텍스쳐는 셰이더가 r 을 읽으므로 소스 채널을 r 로 옮김 (metallic 은 alpha)
+    if (TextureCache::GetSourceChannel(role) == 3)
     {
-        // DDS는 이미 MIP 레벨 포함
-        if (FAILED(LoadFromDDSFile(filePath.c_str(), DDS_FLAGS_NONE, &metadata, scratchImage)))
+        ScratchImage swizzled;
+        if (FAILED(TransformImage(baseImage.GetImages(), baseImage.GetImageCount(), baseImage.GetMetadata(),
+            [](XMVECTOR* outPixels, const XMVECTOR* inPixels, size_t width, size_t)
+            {
+                for (size_t i = 0; i < width; ++i)
+                    outPixels[i] = XMVectorSplatW(inPixels[i]);
+            }, swizzled)))
             return false;
-
-        arraySize = static_cast<UINT>(metadata.arraySize);
-        mipLevels = static_cast<UINT>(metadata.mipLevels);
+        baseImage = std::move(swizzled);
     }
-    else
+
+    // 밉맵 체인 생성
+    HRESULT hr = GenerateMipMaps(
+        baseImage.GetImages(),
+        baseImage.GetImageCount(),
+        baseImage.GetMetadata(),
+        TEX_FILTER_DEFAULT,
+        0,            // 0이면 최대 레벨까지
+        outImage
+    );
+    return SUCCEEDED(hr);
+}
+
+std::filesystem::path Texture::FindDdsSource(const std::wstring& filePath)
+{
+    if (_wcsicmp(std::filesystem::path(filePath).extension().c_str(), L".dds") == 0)
+        return filePath;
+
+    // 쿠킹된 BC 압축 DDS (Tools/TextureCooker) 는 소스 해시가 맞을 때만 사용
+    const TextureCache::TextureRole role = TextureCache::GetRole(filePath);
+    const std::filesystem::path cachePath = TextureCache::GetCachePath(filePath);
+    const uint64_t sourceHash = std::filesystem::exists(filePath) ? TextureCache::HashSource(filePath, role) : 0;
+    return TextureCache::IsUpToDate(cachePath, sourceHash) ? cachePath : std::filesystem::path();
+}
+
+bool Texture::DecodeCubeMapFile(const std::wstring& filePath, bool generateMips, ScratchImage& outImage)
+{
+    // 1) DDS 큐브맵 로드
+    TexMetadata metadata;
+    if (FAILED(LoadFromDDSFile(filePath.c_str(), DDS_FLAGS_NONE, &metadata, outImage)))
+        return false;
+
+    if (generateMips && metadata.mipLevels == 1)
     {
-        // WIC 로드: 원본 레벨만
-        if (FAILED(LoadFromWICFile(filePath.c_str(), WIC_FLAGS_FORCE_RGB, &metadata, scratchImage)))
+        ScratchImage mipChain;
+        HRESULT hr = GenerateMipMaps(
+            outImage.GetImages(),
+            outImage.GetImageCount(),
+            outImage.GetMetadata(),
+            TEX_FILTER_DEFAULT,
+            0,              // 0 = 자동으로 최대 레벨까지
+            mipChain
+        );
+        if (FAILED(hr))
             return false;
-
-        // 밉맵 체인 생성
-        {
-            ScratchImage mipChain;
-            HRESULT hr = GenerateMipMaps(
-                scratchImage.GetImages(),
-                scratchImage.GetImageCount(),
-                scratchImage.GetMetadata(),
-                TEX_FILTER_DEFAULT,
-                0,            // 0이면 최대 레벨까지
-                mipChain
-            );
-            if (FAILED(hr))
-                return false;
-
-            scratchImage = std::move(mipChain);
-            metadata = scratchImage.GetMetadata();
-        }
-
-        arraySize = 1;
-        mipLevels = static_cast<UINT>(metadata.mipLevels);
+        outImage = std::move(mipChain);
     }
+    return true;
+}
+
+bool Texture::Upload(Renderer* renderer, const std::wstring& filePath, const ScratchImage& image)
+{
+    name = filePath;
+
+    // 렌더러에서 Copy 전용 커맨드 리스트/할당자/큐/펜스 정보 가져오기
+    ID3D12Device* device = renderer->GetDevice();
+    auto         copyList = renderer->GetCopyCommandList();
+    auto         copyAllocator = renderer->GetCopyCommandAllocator();
+    auto         copyQueue = renderer->GetCopyQueue();
+    auto         copyFence = renderer->GetCopyFence();
+    UINT64& copyFenceValue = renderer->GetCopyFenceValue();
+
+    const TexMetadata& metadata = image.GetMetadata();
+    const UINT arraySize = static_cast<UINT>(metadata.arraySize);      // 큐브맵이면 6
+    const UINT mipLevels = static_cast<UINT>(metadata.mipLevels);
 
-    // 2) GPU 리소스 생성 (Default heap, COMMON 상태)
+    // 1) GPU 리소스 생성 (Default heap, COMMON 상태)
     CD3DX12_HEAP_PROPERTIES defaultHeap(D3D12_HEAP_TYPE_DEFAULT);
     CD3DX12_RESOURCE_DESC   desc = CD3DX12_RESOURCE_DESC::Tex2D(
         metadata.format,
@@ -75,17 +150,19 @@ bool Texture::LoadFromFile(Renderer* renderer, const std::wstring& filePath, boo
         arraySize,
         mipLevels);
 
+    ComPtr<ID3D12Resource> newTexture;
     if (FAILED(device->CreateCommittedResource(
         &defaultHeap,
         D3D12_HEAP_FLAG_NONE,
         &desc,
         D3D12_RESOURCE_STATE_COMMON,
         nullptr,
-        IID_PPV_ARGS(&texture))))
+        IID_PPV_ARGS(&newTexture))))
         return false;
 
-    // 3) Upload heap (staging) 버퍼 생성
-    UINT64 uploadSize = GetRequiredIntermediateSize(texture.Get(), 0, arraySize * mipLevels);
+    // 2) Upload heap (staging) 버퍼 생성
+    const UINT subCount = arraySize * mipLevels;
+    UINT64 uploadSize = GetRequiredIntermediateSize(newTexture.Get(), 0, subCount);
     CD3DX12_HEAP_PROPERTIES uploadHeap(D3D12_HEAP_TYPE_UPLOAD);
     auto uploadDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadSize);
 
@@ -99,21 +176,21 @@ bool Texture::LoadFromFile(Renderer* renderer, const std::wstring& filePath, boo
         IID_PPV_ARGS(&uploadResource))))
         return false;
 
-    // 4) Copy 리스트 준비: COMMON -> COPY_DEST
+    // 3) Copy 리스트 준비: COMMON -> COPY_DEST
     copyAllocator->Reset();
     copyList->Reset(copyAllocator, nullptr);
     {
         auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-            texture.Get(),
+            newTexture.Get(),
             D3D12_RESOURCE_STATE_COMMON,
             D3D12_RESOURCE_STATE_COPY_DEST);
         copyList->ResourceBarrier(1, &barrier);
     }
 
-    // 5) 서브리소스 데이터 준비 & 복사
-    UINT                   subCount = arraySize * mipLevels;
+    // 4) 서브리소스 데이터 준비 & 복사
+    // (ScratchImage 는 item → mip 순서라 D3D12 서브리소스 인덱스 mip + item * mipLevels 와 같다)
     std::vector<D3D12_SUBRESOURCE_DATA> subresources(subCount);
-    auto images = scratchImage.GetImages();
+    auto images = image.GetImages();
     for (UINT i = 0; i < subCount; ++i)
     {
         subresources[i] = {
@@ -124,23 +201,23 @@ bool Texture::LoadFromFile(Renderer* renderer, const std::wstring& filePath, boo
     }
     UpdateSubresources(
         copyList,
-        texture.Get(),
+        newTexture.Get(),
         uploadResource.Get(),
         0, 0,
         subCount,
         subresources.data());
 
-    // 6) COPY_DEST -> COMMON
+    // 5) COPY_DEST -> COMMON
     {
         auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-            texture.Get(),
+            newTexture.Get(),
             D3D12_RESOURCE_STATE_COPY_DEST,
             D3D12_RESOURCE_STATE_COMMON);
         copyList->ResourceBarrier(1, &barrier);
     }
     copyList->Close();
 
-    // 7) Copy 큐 제출 및 동기화
+    // 6) Copy 큐 제출 및 동기화
     ID3D12CommandList* lists[] = { copyList };
     copyQueue->ExecuteCommandLists(_countof(lists), lists);
     ++copyFenceValue;
@@ -153,152 +230,7 @@ bool Texture::LoadFromFile(Renderer* renderer, const std::wstring& filePath, boo
         CloseHandle(evt);
     }
 
-    return true;
-}
-
-bool Texture::LoadCubeMapFromFile(Renderer* renderer, const std::wstring& filePath, bool generateMips)
-{
-    name = filePath;
-
-    // 복사용 커맨드 정보
-    ID3D12Device* device = renderer->GetDevice();
-    ID3D12GraphicsCommandList* copyList = renderer->GetCopyCommandList();
-    ID3D12CommandAllocator* copyAllocator = renderer->GetCopyCommandAllocator();
-    ID3D12CommandQueue* copyQueue = renderer->GetCopyQueue();
-    ID3D12Fence* copyFence = renderer->GetCopyFence();
-    UINT64& fenceValue = renderer->GetCopyFenceValue();
-
-    // 1) DDS 큐브맵 로드
-    ScratchImage scratchImage;
-    TexMetadata metadata;
-    if (FAILED(LoadFromDDSFile(filePath.c_str(), DDS_FLAGS_NONE, &metadata, scratchImage)))
-    {
-        return false;
-    }
-
-    if (generateMips && metadata.mipLevels == 1)
-    {
-        ScratchImage mipChain;
-        HRESULT hr = GenerateMipMaps(
-            scratchImage.GetImages(),
-            scratchImage.GetImageCount(),
-            scratchImage.GetMetadata(),
-            TEX_FILTER_DEFAULT,
-            0,              // 0 = 자동으로 최대 레벨까지
-            mipChain
-        );
-        if (FAILED(hr))
-            return false;
-        scratchImage = std::move(mipChain);
-        metadata = scratchImage.GetMetadata();
-    }
-
-    // 2) 리소스 설명 구성 (6 faces)
-    D3D12_RESOURCE_DESC textureDesc{};
-    textureDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
-    textureDesc.Width = static_cast<UINT>(metadata.width);
-    textureDesc.Height = static_cast<UINT>(metadata.height);
-    textureDesc.DepthOrArraySize = static_cast<UINT>(metadata.arraySize);  // 6 faces
-    textureDesc.MipLevels = static_cast<UINT>(metadata.mipLevels);
-    textureDesc.Format = metadata.format;
-    textureDesc.SampleDesc.Count = 1;
-    textureDesc.SampleDesc.Quality = 0;
-    textureDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
-    textureDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-
-    // 3) GPU 리소스 생성 (초기 상태 = COMMON)
-    CD3DX12_HEAP_PROPERTIES defaultHeap(D3D12_HEAP_TYPE_DEFAULT);
-    if (FAILED(device->CreateCommittedResource(
-        &defaultHeap,
-        D3D12_HEAP_FLAG_NONE,
-        &textureDesc,
-        D3D12_RESOURCE_STATE_COMMON,
-        nullptr,
-        IID_PPV_ARGS(&texture))))
-    {
-        return false;
-    }
-
-    // 4) staging 버퍼 및 서브리소스 개수 계산
-    UINT   subresourceCount = textureDesc.MipLevels * textureDesc.DepthOrArraySize;
-    UINT64 requiredSize = GetRequiredIntermediateSize(texture.Get(), 0, subresourceCount);
-
-    CD3DX12_HEAP_PROPERTIES uploadHeap(D3D12_HEAP_TYPE_UPLOAD);
-    auto stagingDesc = CD3DX12_RESOURCE_DESC::Buffer(requiredSize);
-
-    ComPtr<ID3D12Resource> uploadBuffer;
-    if (FAILED(device->CreateCommittedResource(
-        &uploadHeap,
-        D3D12_HEAP_FLAG_NONE,
-        &stagingDesc,
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&uploadBuffer))))
-    {
-        return false;
-    }
-
-    // 5) 서브리소스 데이터 준비
-    auto images = scratchImage.GetImages();
-    size_t imageCount = scratchImage.GetImageCount();
-
-    std::vector<D3D12_SUBRESOURCE_DATA> subresources;
-    subresources.reserve(imageCount);
-    for (size_t i = 0; i < imageCount; ++i)
-    {
-        D3D12_SUBRESOURCE_DATA data{};
-        data.pData = images[i].pixels;
-        data.RowPitch = images[i].rowPitch;
-        data.SlicePitch = images[i].slicePitch;
-        subresources.push_back(data);
-    }
-
-    // 6) copy 커맨드 기록
-    copyAllocator->Reset();
-    copyList->Reset(copyAllocator, nullptr);
-
-    // 6-1) COMMON -> COPY_DEST
-    {
-        auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-            texture.Get(),
-            D3D12_RESOURCE_STATE_COMMON,
-            D3D12_RESOURCE_STATE_COPY_DEST);
-        copyList->ResourceBarrier(1, &barrier);
-    }
-
-    // 6-2) 실제 복사
-    UpdateSubresources(
-        copyList,
-        texture.Get(),
-        uploadBuffer.Get(),
-        0, 0,
-        subresourceCount,
-        subresources.data());
-
-    // 6-3) COPY_DEST -> COMMON
-    {
-        auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-            texture.Get(),
-            D3D12_RESOURCE_STATE_COPY_DEST,
-            D3D12_RESOURCE_STATE_COMMON);
-        copyList->ResourceBarrier(1, &barrier);
-    }
-
-    copyList->Close();
-    ID3D12CommandList* lists[] = { copyList };
-    copyQueue->ExecuteCommandLists(_countof(lists), lists);
-
-    // 7) 동기화
-    ++fenceValue;
-    copyQueue->Signal(copyFence, fenceValue);
-    if (copyFence->GetCompletedValue() < fenceValue)
-    {
-        HANDLE event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-        copyFence->SetEventOnCompletion(fenceValue, event);
-        WaitForSingleObject(event, INFINITE);
-        CloseHandle(event);
-    }
-
+    texture = std::move(newTexture);
     return true;
 }
 
@@ -308,6 +240,12 @@ D3D12_CPU_DESCRIPTOR_HANDLE Texture::GetCpuHandle() const { return cpuHandle; }
 UINT Texture::GetDescriptorIndex() const { return descriptorIndex; }
 const std::wstring& Texture::GetName() const { return name; }
 
+void Texture::SetResource(Microsoft::WRL::ComPtr<ID3D12Resource> resource, const std::wstring& filePath)
+{
+    texture = std::move(resource);
+    name = filePath;
+}
+
 void Texture::SetDescriptorHandles(
     D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle_,
     D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle_,
@@ -316,4 +254,5 @@ void Texture::SetDescriptorHandles(
     cpuHandle = cpuHandle_;
     gpuHandle = gpuHandle_;
     descriptorIndex = index_;
+    viewVersion = nextViewVersion.fetch_add(1, std::memory_order_relaxed);
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <wrl/client.h>
@@ -6,6 +7,8 @@
 
 class Renderer;
 
+namespace DirectX { class ScratchImage; }
+
 
 // GPU-텍스처 + SRV 핸들 보유
 
@@ -20,6 +23,24 @@ public:
     // 큐브맵 텍스처 로드  (HDR, LDR 둘 다 처리 가능)
     bool LoadCubeMapFromFile(Renderer* renderer, const std::wstring& filePath, bool generateMips = false);
 
+    // 로드 1단계 (CPU): 파일 디코드 + 밉 생성. Renderer 를 쓰지 않아 로더 스레드에서 호출 가능
+    // PNG 등은 Cache/Textures 에 쿠킹된 BC 압축 DDS (TextureCache) 가 소스와 맞으면 그것을 읽음
+    // (WIC 를 쓰므로 호출 스레드에 COM 이 초기화되어 있어야 함)
+    static bool DecodeFile(const std::wstring& filePath, DirectX::ScratchImage& outImage);
+    static bool DecodeCubeMapFile(const std::wstring& filePath, bool generateMips, DirectX::ScratchImage& outImage);
+
+    // DecodeFile 이 읽을 DDS: 원본 .dds 또는 소스와 맞는 쿠킹 캐시 (없으면 빈 경로, 로더 스레드에서 호출 가능)
+    static std::filesystem::path FindDdsSource(const std::wstring& filePath);
+
+    // 로드 2단계 (GPU): 리소스 생성 + Copy 큐 업로드 (완료까지 대기, 렌더 스레드 전용)
+    bool Upload(Renderer* renderer, const std::wstring& filePath, const DirectX::ScratchImage& image);
+
+    // 외부에서 만든 리소스 연결 (TextureStreamer 의 reserved 리소스, 업로드는 호출 측)
+    void SetResource(Microsoft::WRL::ComPtr<ID3D12Resource> resource, const std::wstring& filePath);
+
+    // 업로드가 끝나 GPU 리소스가 있는지 (비동기 로드 중이면 false)
+    bool IsLoaded() const { return texture != nullptr; }
+
     ID3D12Resource* GetResource()       const;
     D3D12_GPU_DESCRIPTOR_HANDLE  GetGpuHandle()      const;
     D3D12_CPU_DESCRIPTOR_HANDLE  GetCpuHandle()      const;
@@ -31,6 +52,14 @@ public:
         D3D12_GPU_DESCRIPTOR_HANDLE gpu,
         UINT index);
 
+    // SRV 가 바뀔 때마다 (로드 완료 / 스트리밍 밉 변경) 새로 받는 전역 고유 값, 0 = SRV 없음
+    // 이 값이 같으면 이 텍스쳐로 만든 테이블을 다시 만들 필요가 없다
+    UINT64 GetViewVersion() const { return viewVersion; }
+
+    // 현재 SRV 를 만든 desc (같은 뷰를 다른 슬롯에 다시 만들 때 사용)
+    const D3D12_SHADER_RESOURCE_VIEW_DESC& GetViewDesc() const { return viewDesc; }
+    void SetViewDesc(const D3D12_SHADER_RESOURCE_VIEW_DESC& desc) { viewDesc = desc; }
+
 
 private:
     Microsoft::WRL::ComPtr<ID3D12Resource> texture;      // 실제 GPU 리소스
@@ -40,4 +69,6 @@ private:
     D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle{ 0 };
     D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle{ 0 };
     UINT descriptorIndex{ UINT(-1) };
+    UINT64 viewVersion{ 0 };
+    D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{};
 };
\ No newline at end of file
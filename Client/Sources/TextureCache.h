@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include "HashUtil.h"
+
+// ---------------------------------------------------------------------------
+// 쿠킹된 텍스쳐 캐시 (Cache/Textures/*.dds)
+// 오프라인 쿠커(Tools/TextureCooker)가 PNG 를 역할별 BC 포맷 + 전체 밉 체인 DDS 로 쓰고,
+// Texture::DecodeFile 이 소스 해시가 맞으면 WIC 디코드 대신 그대로 읽는다.
+// 플랫폼 독립 헤더만 사용할 것 (Linux 빌드 머신에서도 컴파일됨)
+//
+//   역할 (파일 이름으로 판단)   포맷                 샘플링하는 채널
+//   Color                       BC7_UNORM_SRGB       rgba
+//   Normal                      BC5_UNORM            rg (z 는 셰이더에서 복원)
+//   Metallic                    BC4_UNORM            r  (소스의 alpha, SampleMetallic 관례)
+//   Mask (roughness / ao 등)    BC4_UNORM            r
+//
+// 소스 해시는 DDS_HEADER::dwReserved1 에 기록 (DDS 로더는 이 영역을 읽지 않음)
+// ---------------------------------------------------------------------------
+namespace TextureCache
+{
+    static constexpr uint32_t StampMagic = 0x4B435854;  // 'TXCK'
+    static constexpr uint32_t Version = 1;              // 인코더나 밉 필터가 바뀌면 올릴 것
+
+    // dxgiformat.h 의 값 (Linux 툴에서도 쓰므로 직접 정의)
+    static constexpr uint32_t FormatBC4Unorm = 80;      // DXGI_FORMAT_BC4_UNORM
+    static constexpr uint32_t FormatBC5Unorm = 83;      // DXGI_FORMAT_BC5_UNORM
+    static constexpr uint32_t FormatBC7UnormSrgb = 99;  // DXGI_FORMAT_BC7_UNORM_SRGB
+
+    enum class TextureRole : uint32_t
+    {
+        Color,
+        Normal,
+        Metallic,
+        Mask,
+    };
+
+    // "DDS " 매직(4) + DDS_HEADER 의 dwSize ~ dwMipMapCount(28) 뒤
+    static constexpr size_t StampOffset = 32;
+
+    struct Stamp
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceHash;
+    };
+
+    inline TextureRole GetRole(const std::filesystem::path& sourcePath)
+    {
+        std::string stem = sourcePath.stem().string();
+        std::transform(stem.begin(), stem.end(), stem.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        auto hasToken = [&](std::string_view token) {
+            for (size_t pos = stem.find(token); pos != std::string::npos; pos = stem.find(token, pos + 1)) {
+                const bool startOk = pos == 0 || !std::isalpha(static_cast<unsigned char>(stem[pos - 1]));
+                const bool endOk = pos + token.size() == stem.size() || !std::isalpha(static_cast<unsigned char>(stem[pos + token.size()]));
+                if (startOk && endOk)
+                    return true;
+            }
+            return false;
+        };
+
+        if (stem.find("normal") != std::string::npos)
+            return TextureRole::Normal;
+        if (stem.find("metallic") != std::string::npos || stem.find("metalness") != std::string::npos)
+            return TextureRole::Metallic;
+        if (stem.find("roughness") != std::string::npos || stem.find("occlusion") != std::string::npos ||
+            stem.find("height") != std::string::npos || hasToken("ao"))
+            return TextureRole::Mask;
+        return TextureRole::Color;
+    }
+
+    inline uint32_t GetFormat(TextureRole role)
+    {
+        switch (role) {
+        case TextureRole::Normal:   return FormatBC5Unorm;
+        case TextureRole::Metallic:
+        case TextureRole::Mask:     return FormatBC4Unorm;
+        default:                    return FormatBC7UnormSrgb;
+        }
+    }
+
+    // BC4 로 옮길 소스 채널 (0 = r, 3 = a)
+    inline uint32_t GetSourceChannel(TextureRole role)
+    {
+        return role == TextureRole::Metallic ? 3 : 0;
+    }
+
+    // 같은 이름의 텍스쳐가 여러 폴더에 있을 수 있으므로 경로 해시를 붙인다 (MeshCache 와 같은 규칙)
+    inline std::filesystem::path GetCachePath(const std::filesystem::path& sourcePath)
+    {
+        Hasher hasher;
+        hasher.AddString(sourcePath.lexically_normal().generic_wstring());
+
+        return std::filesystem::path(L"Cache/Textures") /
+            (sourcePath.stem().wstring() + L"_" + HashToHex(hasher.Value()) + L".dds");
+    }
+
+    inline uint64_t HashSource(const std::filesystem::path& sourcePath, TextureRole role)
+    {
+        std::ifstream stream(sourcePath, std::ios::binary);
+        if (!stream)
+            return 0;
+
+        Hasher hasher;
+        std::vector<char> chunk(1 << 16);
+        while (stream) {
+            stream.read(chunk.data(), chunk.size());
+            hasher.Add(chunk.data(), static_cast<size_t>(stream.gcount()));
+        }
+        hasher.AddValue(static_cast<uint32_t>(role));
+        hasher.AddValue(Version);
+        return hasher.Value();
+    }
+
+    // 쿠킹된 DDS 가 이 소스로 만든 것인지 (expectedHash == 0 이면 소스가 없는 배포 환경이라 그대로 신뢰)
+    inline bool IsUpToDate(const std::filesystem::path& cachePath, uint64_t expectedHash)
+    {
+        std::ifstream stream(cachePath, std::ios::binary);
+        char prefix[StampOffset + sizeof(Stamp)];
+        if (!stream.read(prefix, sizeof(prefix)))
+            return false;
+
+        Stamp stamp{};
+        std::memcpy(&stamp, prefix + StampOffset, sizeof(stamp));
+        return std::memcmp(prefix, "DDS ", 4) == 0
+            && stamp.magic == StampMagic
+            && stamp.version == Version
+            && (expectedHash == 0 || stamp.sourceHash == expectedHash);
+    }
+}
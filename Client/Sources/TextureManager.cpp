@@ -2,6 +2,7 @@
 #include "DescriptorHeapManager.h"
 #include "Renderer.h"
 #include <directx/d3dx12.h>
+#include <DirectXTex.h>
 
 bool TextureManager::Initialize(Renderer* renderer_, DescriptorHeapManager* descriptorHeapManager_)
 {
@@ -10,9 +11,63 @@ bool TextureManager::Initialize(Renderer* renderer_, DescriptorHeapManager* desc
 
     renderer = renderer_;
     descriptorHeapManager = descriptorHeapManager_;
+    return CreatePlaceholders();
+}
+
+bool TextureManager::CreatePlaceholders()
+{
+    // 1) 2D: 1x1 흰색 (알베도에 곱해져도 baseColor 가 그대로 보임)
+    DirectX::ScratchImage white;
+    if (FAILED(white.Initialize2D(DXGI_FORMAT_R8G8B8A8_UNORM, 1, 1, 1, 1)))
+        return false;
+    memset(white.GetPixels(), 0xFF, white.GetPixelsSize());
+
+    placeholderTexture = std::make_shared<Texture>();
+    if (!placeholderTexture->Upload(renderer, L"<placeholder>", white))
+        return false;
+    CreateShaderResourceView(*placeholderTexture, false);
+
+    // 2) 큐브: 리소스 없는 null SRV (0 을 읽음)
+    placeholderCubeHandle = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+    srvDesc.TextureCube.MipLevels = 1;
+    renderer->GetDevice()->CreateShaderResourceView(nullptr, &srvDesc, placeholderCubeHandle.cpuHandle);
     return true;
 }
 
+void TextureManager::CreateShaderResourceView(Texture& texture, bool isCubeMap)
+{
+    // SRV 디스크립터 슬롯 확보 & 생성
+    DescriptorHandle handle = descriptorHeapManager->Allocate(
+        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDesc.Format = texture.GetResource()->GetDesc().Format;
+    if (isCubeMap)
+    {
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+        srvDesc.TextureCube.MostDetailedMip = 0;
+        srvDesc.TextureCube.MipLevels = texture.GetResource()->GetDesc().MipLevels;
+    }
+    else
+    {
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+        srvDesc.Texture2D.MostDetailedMip = 0;
+        srvDesc.Texture2D.MipLevels = UINT(-1);     // 밉 체인 전체
+    }
+
+    renderer->GetDevice()->CreateShaderResourceView(
+        texture.GetResource(), &srvDesc, handle.cpuHandle);
+
+    texture.SetDescriptorHandles(handle.cpuHandle, handle.gpuHandle, handle.index);
+    texture.SetViewDesc(srvDesc);
+}
+
 std::shared_ptr<Texture> TextureManager::LoadTexture(const std::wstring& filePath, bool generateMips)
 {
     // 1) 캐시 조회
@@ -27,19 +82,7 @@ std::shared_ptr<Texture> TextureManager::LoadTexture(const std::wstring& filePat
         throw std::runtime_error("TextureManager::LoadTexture - load failed");
 
     // 4) SRV 디스크립터 슬롯 확보 & 생성
-    DescriptorHandle handle = descriptorHeapManager->Allocate(
-        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
-
-    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
-    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = texture->GetResource()->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = 1;
-
-    renderer->GetDevice()->CreateShaderResourceView(
-        texture->GetResource(), &srvDesc, handle.cpuHandle);
-
-    texture->SetDescriptorHandles(handle.cpuHandle, handle.gpuHandle, handle.index);
+    CreateShaderResourceView(*texture, false);
 
     // 5) 캐시에 저장
     textureCache[filePath] = texture;
@@ -60,27 +103,155 @@ std::shared_ptr<Texture> TextureManager::LoadCubeMap(const std::wstring& filePat
         throw std::runtime_error("TextureManager::LoadCubeMap - load failed");
 
     // 4) SRV 디스크립터 슬롯 확보 & 생성
+    CreateShaderResourceView(*texture, true);
+
+    // 5) 캐시에 저장
+    textureCache[filePath] = texture;
+    return texture;
+}
+
+std::shared_ptr<Texture> TextureManager::AcquirePending(const std::wstring& filePath, bool isCubeMap, bool& outCreated)
+{
+    // 1) 캐시 조회 (로드 중인 것도 같은 객체를 공유)
+    if (auto it = textureCache.find(filePath); it != textureCache.end())
+    {
+        outCreated = false;
+        return it->second;
+    }
+
+    // 2) 자리표시자 SRV 를 가리키는 빈 Texture (인덱스는 UINT(-1) 로 두어 해제 대상에서 빠짐)
+    auto texture = std::make_shared<Texture>();
+    const DescriptorHandle placeholder = isCubeMap ? placeholderCubeHandle
+        : DescriptorHandle{ placeholderTexture->GetCpuHandle(), placeholderTexture->GetGpuHandle(), 0 };
+    texture->SetDescriptorHandles(placeholder.cpuHandle, placeholder.gpuHandle, UINT(-1));
+
+    textureCache[filePath] = texture;
+    outCreated = true;
+    return texture;
+}
+
+bool TextureManager::CompletePending(const std::wstring& filePath, const std::shared_ptr<Texture>& texture,
+    std::shared_ptr<const DirectX::ScratchImage> image, bool isCubeMap)
+{
+    auto it = textureCache.find(filePath);
+    if (it == textureCache.end() || it->second != texture)
+        return false;
+
+    // 자리표시자 슬롯은 공유 중이므로 덮어쓰지 않고 새 슬롯에 SRV 생성
+    // (이전 프레임 커맨드 리스트는 계속 자리표시자를 참조하므로 안전)
+    if (!texture->Upload(renderer, filePath, *image))
+        return false;
+
+    CreateShaderResourceView(*texture, isCubeMap);
+    return true;
+}
+
+bool TextureManager::CompleteStreamed(const std::wstring& filePath, const std::shared_ptr<Texture>& texture,
+    const TextureStreamer::Source& source)
+{
+    auto it = textureCache.find(filePath);
+    if (it == textureCache.end() || it->second != texture)
+        return false;
+
+    // SRV 는 tail 복사가 끝난 프레임에 TextureStreamer 가 UpdateStreamedView 로 교체
+    return renderer->GetTextureStreamer()->Register(texture, filePath, source);
+}
+
+void TextureManager::UpdateStreamedView(Texture& texture, UINT mostDetailedMip)
+{
+    // 이전 슬롯은 지난 프레임 커맨드 리스트가 참조 중일 수 있으므로 새 슬롯에 생성
+    const DescriptorHandle previous{ texture.GetCpuHandle(), texture.GetGpuHandle(), texture.GetDescriptorIndex() };
+
     DescriptorHandle handle = descriptorHeapManager->Allocate(
         D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1);
 
+    // 상주하지 않은 밉은 샘플링되지 않도록 뷰 범위와 LOD 클램프를 같이 올림
     D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
     srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-    srvDesc.Format = texture->GetResource()->GetDesc().Format;
-    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
-    srvDesc.TextureCube.MostDetailedMip = 0;
-    srvDesc.TextureCube.MipLevels = texture->GetResource()->GetDesc().MipLevels;
+    srvDesc.Format = texture.GetResource()->GetDesc().Format;
+    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MostDetailedMip = mostDetailedMip;
+    srvDesc.Texture2D.MipLevels = UINT(-1);
+    srvDesc.Texture2D.ResourceMinLODClamp = float(mostDetailedMip);
 
     renderer->GetDevice()->CreateShaderResourceView(
-        texture->GetResource(), &srvDesc, handle.cpuHandle);
+        texture.GetResource(), &srvDesc, handle.cpuHandle);
 
-    texture->SetDescriptorHandles(handle.cpuHandle, handle.gpuHandle, handle.index);
+    texture.SetDescriptorHandles(handle.cpuHandle, handle.gpuHandle, handle.index);
+    texture.SetViewDesc(srvDesc);
 
-    // 5) 캐시에 저장
-    textureCache[filePath] = texture;
-    return texture;
+    if (previous.index != UINT(-1))
+        descriptorHeapManager->Free(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, previous, 1,
+            renderer->GetDirectFenceValue());
+}
+
+DescriptorHandle TextureManager::CreateTextureTable(const std::shared_ptr<Texture>* textures, UINT count)
+{
+    const DescriptorHandle table = descriptorHeapManager->Allocate(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, count);
+    WriteTextureTable(table, textures, count);
+    return table;
+}
+
+void TextureManager::FreeTextureTable(const DescriptorHandle& table, UINT count)
+{
+    // 지난 프레임 커맨드 리스트가 참조 중일 수 있으므로 이번 프레임 fence 뒤에 회수
+    descriptorHeapManager->Free(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, table, count,
+        renderer->GetDirectFenceValue());
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE TextureManager::CreateTransientTable(const std::shared_ptr<Texture>* textures, UINT count)
+{
+    // 이번 프레임 transient ring 에서 연속 슬롯 확보 (lock 없음, 프레임 구간이 리셋될 때 같이 회수)
+    const DescriptorHandle table = descriptorHeapManager->AllocateTransient(count);
+    WriteTextureTable(table, textures, count);
+    return table.gpuHandle;
+}
+
+void TextureManager::WriteTextureTable(const DescriptorHandle& table, const std::shared_ptr<Texture>* textures, UINT count)
+{
+    // shader-visible 힙은 CopyDescriptors 의 원본이 될 수 없어 뷰를 새로 만든다
+    // 자기 SRV 가 있는 텍스쳐는 같은 desc 로, 나머지는 자리표시자
+    const UINT descriptorSize = descriptorHeapManager->GetDescriptorSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    for (UINT i = 0; i < count; ++i)
+    {
+        const Texture& source = (textures[i] && textures[i]->GetDescriptorIndex() != UINT(-1))
+            ? *textures[i] : *placeholderTexture;
+        renderer->GetDevice()->CreateShaderResourceView(source.GetResource(), &source.GetViewDesc(),
+            CD3DX12_CPU_DESCRIPTOR_HANDLE(table.cpuHandle, INT(i), descriptorSize));
+    }
+}
+
+void TextureManager::FreeShaderResourceView(const Texture& texture)
+{
+    // 자리표시자를 가리키는 Texture 는 슬롯을 소유하지 않음
+    if (texture.GetDescriptorIndex() == UINT(-1))
+        return;
+
+    DescriptorHandle handle;
+    handle.cpuHandle = texture.GetCpuHandle();
+    handle.gpuHandle = texture.GetGpuHandle();
+    handle.index = texture.GetDescriptorIndex();
+    descriptorHeapManager->Free(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, handle, 1,
+        renderer->GetDirectFenceValue());
+}
+
+void TextureManager::UnloadTexture(const std::wstring& filePath)
+{
+    auto it = textureCache.find(filePath);
+    if (it == textureCache.end())
+        return;
+
+    renderer->GetTextureStreamer()->Unregister(it->second.get());
+    FreeShaderResourceView(*it->second);
+    textureCache.erase(it);
 }
 
 void TextureManager::Clear()
 {
+    for (const auto& [path, texture] : textureCache)
+    {
+        renderer->GetTextureStreamer()->Unregister(texture.get());
+        FreeShaderResourceView(*texture);
+    }
     textureCache.clear();
 }
\ No newline at end of file
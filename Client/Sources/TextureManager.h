@@ -4,6 +4,8 @@
 #include <memory>
 #include <string>
 #include "Texture.h"
+#include "TextureStreamer.h"
+#include "DescriptorHandle.h"
 
 class Renderer;
 class DescriptorHeapManager;
@@ -17,10 +19,46 @@ public:
     // 텍스쳐 로드 및 캐시
     std::shared_ptr<Texture> LoadTexture(const std::wstring& filePath, bool generateMips = false);
     std::shared_ptr<Texture> LoadCubeMap(const std::wstring& filePath, bool generateMips = false);
+
+    // 비동기 로드용 (AssetLoader 가 호출)
+    // 캐시에 있으면 그대로 돌려주고 (outCreated = false), 없으면 자리표시자 SRV 를 가리키는 빈 Texture 를 캐시에 넣어 돌려줌
+    // 자리표시자는 GetGpuHandle 만 유효하고 GetDescriptorIndex 는 UINT(-1) (bindless 머티리얼은 파라미터 값으로 대체)
+    std::shared_ptr<Texture> AcquirePending(const std::wstring& filePath, bool isCubeMap, bool& outCreated);
+    // 디코드가 끝난 이미지를 업로드하고 전용 SRV 로 교체 (렌더 스레드의 안전 지점에서 호출)
+    // 그 사이 UnloadTexture 로 캐시에서 빠졌으면 업로드하지 않고 false
+    bool CompletePending(const std::wstring& filePath, const std::shared_ptr<Texture>& texture,
+        std::shared_ptr<const DirectX::ScratchImage> image, bool isCubeMap);
+    // 스트리밍: 로더가 읽은 DDS 헤더 / 밉 tail 로 TextureStreamer 에 등록 (나머지 밉은 필요할 때 DDS 에서 읽음)
+    // 스트리밍할 수 없으면 false (호출 측이 전체 디코드로 다시 로드)
+    bool CompleteStreamed(const std::wstring& filePath, const std::shared_ptr<Texture>& texture,
+        const TextureStreamer::Source& source);
+
+    // 스트리밍 텍스쳐의 상주 범위가 바뀌면 새 슬롯에 [mostDetailedMip, 끝] SRV 를 만들고 이전 슬롯은 지연 해제
+    void UpdateStreamedView(Texture& texture, UINT mostDetailedMip);
+
+    // 연속 슬롯에 텍스쳐들의 현재 SRV 를 다시 만든 테이블 (비 bindless PBR 의 t0~t3 처럼 테이블로 바인딩할 때)
+    // nullptr 이거나 아직 로드 중인 텍스쳐는 흰색 자리표시자
+    // CreateTextureTable: 영구 슬롯, 텍스쳐 SRV 가 바뀌면 (GetViewVersion) 새로 만들고 이전 것은 FreeTextureTable 로 지연 해제
+    DescriptorHandle CreateTextureTable(const std::shared_ptr<Texture>* textures, UINT count);
+    void FreeTextureTable(const DescriptorHandle& table, UINT count);
+    // CreateTransientTable: DescriptorHeapManager 의 transient ring (이번 프레임 커맨드 리스트에서만 유효, 렌더 워커에서 호출 가능)
+    D3D12_GPU_DESCRIPTOR_HANDLE CreateTransientTable(const std::shared_ptr<Texture>* textures, UINT count);
+
+    // 캐시에서 제거하고 SRV 슬롯은 GPU 가 현재 프레임을 끝낸 뒤 재사용되도록 반환
+    void UnloadTexture(const std::wstring& filePath);
     void Clear();
 
 private:
+    bool CreatePlaceholders();
+    void CreateShaderResourceView(Texture& texture, bool isCubeMap);
+    void FreeShaderResourceView(const Texture& texture);
+    void WriteTextureTable(const DescriptorHandle& table, const std::shared_ptr<Texture>* textures, UINT count);
+
     Renderer* renderer = nullptr;
     DescriptorHeapManager* descriptorHeapManager = nullptr;
     std::unordered_map<std::wstring, std::shared_ptr<Texture>> textureCache;
+
+    // 비동기 로드 중 바인딩되는 자리표시자 (2D: 1x1 흰색, 큐브: null SRV)
+    std::shared_ptr<Texture> placeholderTexture;
+    DescriptorHandle placeholderCubeHandle;
 };
\ No newline at end of file
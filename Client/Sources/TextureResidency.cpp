@@ -0,0 +1,117 @@
+#include "TextureResidency.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace TextureResidency
+{
+    uint32_t MipForTexelDensity(float texelsPerPixel, uint32_t mipCount)
+    {
+        if (mipCount == 0 || !(texelsPerPixel > 1.0f))
+            return 0;
+
+        const float mip = std::floor(std::log2(texelsPerPixel));
+        return mip >= float(mipCount - 1) ? mipCount - 1 : uint32_t(mip);
+    }
+
+    float TexelsPerPixel(uint32_t textureSize, float worldDiameter, float pixelsPerUnit)
+    {
+        // 화면 크기가 0 이면 가장 거친 밉으로
+        const float screenPixels = worldDiameter * pixelsPerUnit;
+        if (!(screenPixels > 0.0f))
+            return std::numeric_limits<float>::max();
+
+        return float(textureSize) / screenPixels;
+    }
+
+    uint64_t ResidentBytes(const TextureState& texture, uint32_t residentMip)
+    {
+        uint64_t bytes = 0;
+        for (uint32_t mip = residentMip; mip < texture.mipCount && mip < MaxMips; ++mip)
+            bytes += texture.mipBytes[mip];
+        return bytes;
+    }
+
+    Plan BuildPlan(const std::vector<TextureState>& textures, uint64_t budgetBytes, uint32_t maxLoads)
+    {
+        Plan plan;
+        const size_t count = textures.size();
+
+        auto tailOf = [&](size_t i) { return std::min(textures[i].tailMip, textures[i].mipCount - 1); };
+        auto residentOf = [&](size_t i) { return std::min(textures[i].residentMip, tailOf(i)); };
+
+        // 1) 목표 밉: 필요보다 상세한 밉은 한 단계까지 남겨 둠 (경계에서 올리고 내리기를 반복하지 않도록)
+        std::vector<uint32_t> target(count);
+        uint64_t totalBytes = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint32_t wanted = std::min(textures[i].wantedMip, tailOf(i));
+            const uint32_t resident = residentOf(i);
+            target[i] = resident < wanted ? std::max(resident, wanted - 1) : wanted;
+            totalBytes += ResidentBytes(textures[i], target[i]);
+        }
+
+        // 2) 예산 초과: priority 가 낮은 텍스쳐부터 tail 까지 한 밉씩 내림
+        if (totalBytes > budgetBytes)
+        {
+            std::vector<size_t> order(count);
+            std::iota(order.begin(), order.end(), size_t(0));
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return textures[a].priority < textures[b].priority;
+            });
+
+            for (size_t i : order)
+            {
+                while (totalBytes > budgetBytes && target[i] < tailOf(i))
+                {
+                    totalBytes -= textures[i].mipBytes[target[i]];
+                    ++target[i];
+                }
+                if (totalBytes <= budgetBytes)
+                    break;
+            }
+        }
+        plan.targetBytes = totalBytes;
+
+        // 3) 내리기는 한 번에 목표까지 (올리기보다 먼저 적용해서 예산 확보)
+        uint64_t currentBytes = 0;
+        std::vector<size_t> loadCandidates;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint32_t resident = residentOf(i);
+            if (target[i] > resident)
+            {
+                plan.evictions.push_back({ uint32_t(i), target[i] });
+                currentBytes += ResidentBytes(textures[i], target[i]);
+                continue;
+            }
+
+            currentBytes += ResidentBytes(textures[i], resident);
+            if (target[i] < resident)
+                loadCandidates.push_back(i);
+        }
+
+        // 4) 올리기: priority 높은 순 (같으면 목표와 많이 떨어진 쪽), 텍스쳐당 한 밉
+        std::stable_sort(loadCandidates.begin(), loadCandidates.end(), [&](size_t a, size_t b) {
+            if (textures[a].priority != textures[b].priority)
+                return textures[a].priority > textures[b].priority;
+            return residentOf(a) - target[a] > residentOf(b) - target[b];
+        });
+
+        for (size_t i : loadCandidates)
+        {
+            if (plan.loads.size() >= maxLoads)
+                break;
+
+            const uint32_t mip = residentOf(i) - 1;
+            if (currentBytes + textures[i].mipBytes[mip] > budgetBytes)
+                continue;
+
+            plan.loads.push_back({ uint32_t(i), mip });
+            currentBytes += textures[i].mipBytes[mip];
+        }
+
+        return plan;
+    }
+}
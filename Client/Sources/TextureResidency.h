@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// 텍스쳐 밉 상주 결정 (GPU 없이 동작하는 순수 로직, TextureStreamer 가 매 프레임 호출)
+//   - 밉 [tailMip, mipCount) 는 항상 상주 (packed mip tail 또는 마지막 밉)
+//   - 화면 텍셀 밀도로 필요한 밉 (wantedMip) 을 정하고, 예산을 넘으면 priority 가 낮은 텍스쳐부터 밉을 내림
+//   - 올리기는 한 프레임에 텍스쳐당 한 밉씩, priority 높은 순으로 maxLoads 개까지
+// ---------------------------------------------------------------------------
+namespace TextureResidency
+{
+    static constexpr uint32_t MaxMips = 16;
+
+    struct TextureState
+    {
+        uint32_t mipCount = 1;
+        uint32_t tailMip = 0;               // 항상 상주하는 가장 상세한 밉
+        uint64_t mipBytes[MaxMips] = {};    // 밉별 VRAM (타일 단위), tail 전체는 mipBytes[tailMip] 에 합산
+        uint32_t residentMip = 0;           // 현재 상주하는 가장 상세한 밉
+        uint32_t wantedMip = 0;             // 화면 밀도 기준 필요한 밉 (보이는 곳이 없으면 tailMip)
+        float    priority = 0.0f;           // 클수록 먼저 올리고 나중에 내림 (화면 점유 픽셀 수 등)
+    };
+
+    // 변경 후 residentMip
+    struct MipChange
+    {
+        uint32_t texture;
+        uint32_t mip;
+    };
+
+    struct Plan
+    {
+        std::vector<MipChange> evictions;   // mip 보다 상세한 밉을 내림 (먼저 적용)
+        std::vector<MipChange> loads;       // mip 하나를 올림 (residentMip - 1)
+        uint64_t targetBytes = 0;           // 모든 텍스쳐가 목표 밉에 도달했을 때의 크기
+    };
+
+    // 화면 1 픽셀(한 축)에 들어가는 텍셀 수 → 필요한 밉 (2배마다 한 단계)
+    uint32_t MipForTexelDensity(float texelsPerPixel, uint32_t mipCount);
+
+    // 오브젝트가 화면에서 차지하는 크기 기준 텍셀 밀도
+    // (머티리얼 UV 가 바운딩 구 지름에 걸쳐 한 번 펼쳐져 있다고 가정)
+    float TexelsPerPixel(uint32_t textureSize, float worldDiameter, float pixelsPerUnit);
+
+    // residentMip 까지 상주할 때의 VRAM
+    uint64_t ResidentBytes(const TextureState& texture, uint32_t residentMip);
+
+    Plan BuildPlan(const std::vector<TextureState>& textures, uint64_t budgetBytes, uint32_t maxLoads);
+}
@@ -0,0 +1,579 @@
+#include "TextureStreamer.h"
+#include "Renderer.h"
+#include "Texture.h"
+#include "AssetLoader.h"
+#include "TextureManager.h"
+#include "Material.h"
+#include "DebugManager.h"
+#include <DirectXTex.h>
+#include <directx/d3dx12.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+using Microsoft::WRL::ComPtr;
+
+bool TextureStreamer::Initialize(Renderer* renderer_)
+{
+    renderer = renderer_;
+
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options{};
+    available = SUCCEEDED(renderer->GetDevice()->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options)))
+        && options.TiledResourcesTier != D3D12_TILED_RESOURCES_TIER_NOT_SUPPORTED;
+
+    if (!available)
+        DebugManager::GetInstance().LogMessage(L"[Texture] Tiled resources not supported, textures are uploaded with full mip chains");
+    return available;
+}
+
+bool TextureStreamer::ReadSource(const std::wstring& filePath, Source& outSource)
+{
+    // 1) 밉을 다시 읽을 DDS: 원본 .dds 또는 쿠킹된 캐시 (WIC 디코드 결과는 BC 가 아니므로 스트리밍하지 않음)
+    //    메타데이터는 헤더만 읽어서 확인
+    outSource.path = Texture::FindDdsSource(filePath);
+    TexMetadata metadata;
+    if (outSource.path.empty() || FAILED(GetMetadataFromDDSFile(outSource.path.c_str(), DDS_FLAGS_NONE, metadata)))
+        return false;
+
+    if (metadata.dimension != TEX_DIMENSION_TEXTURE2D || metadata.arraySize != 1 || !IsCompressed(metadata.format)
+        || metadata.mipLevels < 2 || metadata.mipLevels > TextureResidency::MaxMips)
+        return false;
+
+    outSource.format = metadata.format;
+    outSource.width = static_cast<uint32_t>(metadata.width);
+    outSource.height = static_cast<uint32_t>(metadata.height);
+    outSource.mipCount = static_cast<uint32_t>(metadata.mipLevels);
+
+    // 2) BC 포맷은 변환 없이 헤더 뒤에 밉 0 부터 연속으로 저장되어 있음 (LoadFromDDSFile 과 같은 pitch)
+    uint64_t pixelsSize = 0;
+    for (uint32_t mip = 0; mip < outSource.mipCount; ++mip)
+    {
+        size_t rowPitch = 0;
+        size_t slicePitch = 0;
+        if (FAILED(ComputePitch(metadata.format, std::max<size_t>(metadata.width >> mip, 1),
+            std::max<size_t>(metadata.height >> mip, 1), rowPitch, slicePitch)))
+            return false;
+
+        outSource.mips[mip] = { pixelsSize, static_cast<uint32_t>(rowPitch), static_cast<uint32_t>(slicePitch) };
+        pixelsSize += slicePitch;
+    }
+
+    std::error_code error;
+    const uint64_t fileSize = std::filesystem::file_size(outSource.path, error);
+    if (error || fileSize < pixelsSize + 128)
+        return false;
+
+    const uint64_t dataOffset = fileSize - pixelsSize;
+    for (uint32_t mip = 0; mip < outSource.mipCount; ++mip)
+        outSource.mips[mip].offset += dataOffset;
+
+    // 3) tail 로 예상되는 밉만 미리 읽음: 한 변이라도 64KB 타일보다 작은 밉부터 packed
+    //    (타일은 BC1/BC4 가 512x256, 나머지 BC 가 256x256 텍셀, 실제 tail 은 Register 에서 확인)
+    const uint32_t tileWidth = BitsPerPixel(metadata.format) == 4 ? 512 : 256;
+    const uint32_t tileHeight = 256;
+    outSource.prefetchMip = outSource.mipCount - 1;
+    for (uint32_t mip = 0; mip < outSource.mipCount; ++mip)
+    {
+        if (std::max(outSource.width >> mip, 1u) < tileWidth || std::max(outSource.height >> mip, 1u) < tileHeight)
+        {
+            outSource.prefetchMip = mip;
+            break;
+        }
+    }
+
+    const MipSource& first = outSource.mips[outSource.prefetchMip];
+    const MipSource& last = outSource.mips[outSource.mipCount - 1];
+    return AssetLoader::ReadFileRange(outSource.path, first.offset, last.offset + last.slicePitch - first.offset, outSource.bytes);
+}
+
+bool TextureStreamer::Register(const std::shared_ptr<Texture>& texture, const std::wstring& filePath, const Source& source)
+{
+    if (!available || !texture)
+        return false;
+
+    ID3D12Device* device = renderer->GetDevice();
+
+    // 1) reserved 리소스 (메모리는 밉별 heap 을 타일 단위로 매핑)
+    CD3DX12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Tex2D(
+        source.format,
+        static_cast<UINT64>(source.width),
+        static_cast<UINT>(source.height),
+        1,
+        static_cast<UINT16>(source.mipCount));
+    desc.Layout = D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE;
+
+    ComPtr<ID3D12Resource> resource;
+    if (FAILED(device->CreateReservedResource(&desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&resource))))
+        return false;
+
+    auto entry = std::make_unique<Entry>();
+    const UINT mipCount = source.mipCount;
+    entry->tilings.resize(mipCount);
+
+    UINT totalTiles = 0;
+    UINT subresourceTilingCount = mipCount;
+    D3D12_TILE_SHAPE tileShape{};
+    device->GetResourceTiling(resource.Get(), &totalTiles, &entry->packedMips, &tileShape,
+        &subresourceTilingCount, 0, entry->tilings.data());
+
+    // 2) 상주 상태: packed mip 이 없으면 마지막 밉을 tail 로 취급
+    TextureResidency::TextureState& state = entry->state;
+    state.mipCount = mipCount;
+    state.tailMip = entry->packedMips.NumPackedMips > 0 ? entry->packedMips.NumStandardMips : mipCount - 1;
+    if (state.tailMip == 0)
+        return false;   // 전체가 tail 이면 스트리밍할 밉이 없음
+
+    entry->texture = texture;
+    entry->sourcePath = source.path;
+    entry->mipSources = source.mips;
+    entry->resource = resource;
+    entry->size = std::max(source.width, source.height);
+
+    for (uint32_t mip = 0; mip <= state.tailMip; ++mip)
+        state.mipBytes[mip] = uint64_t(GetTileCount(*entry, mip)) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+    state.residentMip = state.tailMip;
+    state.wantedMip = state.tailMip;
+
+    // 3) tail: 로더가 미리 읽은 범위 안이면 바로 업로드 기록, 아니면 tail 도 로더 스레드에서 읽음
+    //    (제출은 Update, SRV 는 복사가 끝난 프레임에 CompleteLoads 가 교체)
+    const bool started = state.tailMip >= source.prefetchMip
+        ? BeginUpload(*entry, state.tailMip,
+            source.bytes.data() + (source.mips[state.tailMip].offset - source.mips[source.prefetchMip].offset))
+        : LoadMip(*entry, state.tailMip);
+    if (!started)
+        return false;
+
+    texture->SetResource(resource, filePath);
+    entryByTexture[texture.get()] = entry.get();
+    entries.push_back(std::move(entry));
+    return true;
+}
+
+void TextureStreamer::Unregister(const Texture* texture)
+{
+    auto it = entryByTexture.find(texture);
+    if (it == entryByTexture.end())
+        return;
+
+    // 아직 제출하지 않은 배치에 업로드가 기록되어 있으면 먼저 제출해 copy fence 값을 받음
+    Entry* entry = it->second;
+    if (std::find(batchEntries.begin(), batchEntries.end(), entry) != batchEntries.end())
+        SubmitBatch();
+
+    // 리소스와 heap 은 GPU 가 현재 프레임과 진행 중인 복사를 끝낸 뒤 해제 (읽는 중인 밉은 OnMipRead 가 버림)
+    PendingRelease release;
+    release.resource = entry->resource;
+    release.fenceValue = renderer->GetDirectFenceValue();
+    for (MipTiles& tiles : entry->mips)
+    {
+        if (tiles.heap)
+            release.heaps.push_back(std::move(tiles.heap));
+    }
+    if (entry->pending.heap)
+    {
+        release.heaps.push_back(std::move(entry->pending.heap));
+        release.uploadBuffer = std::move(entry->pending.uploadBuffer);
+        release.copyFenceValue = entry->pending.copyFenceValue;
+    }
+    pendingReleases.push_back(std::move(release));
+
+    entryByTexture.erase(it);
+    entries.erase(std::find_if(entries.begin(), entries.end(),
+        [entry](const std::unique_ptr<Entry>& e) { return e.get() == entry; }));
+}
+
+void TextureStreamer::Update(const std::vector<std::shared_ptr<GameObject>>& objects)
+{
+    stats = {};
+    if (!available)
+        return;
+
+    // ProcessCompleted 에서 기록한 업로드 (새 텍스쳐의 tail, 읽기가 끝난 밉) 제출
+    SubmitBatch();
+    ProcessEvictions();
+    CompleteLoads();
+    if (entries.empty())
+        return;
+
+    // 1) 화면 텍셀 밀도 → 필요한 밉
+    GatherWantedMips(objects);
+
+    // 2) 예산 안에서 내릴 밉 / 올릴 밉 결정
+    //    읽거나 복사 중인 텍스쳐는 계획에서 빼고, 올리는 중인 밉까지 예산에서 먼저 차감
+    std::vector<TextureResidency::TextureState> states;
+    std::vector<Entry*> planned;
+    states.reserve(entries.size());
+    planned.reserve(entries.size());
+
+    uint64_t loadingBytes = 0;
+    for (const auto& entry : entries)
+    {
+        if (entry->IsLoading())
+        {
+            loadingBytes += TextureResidency::ResidentBytes(entry->state, std::min(entry->pending.mip, entry->state.residentMip));
+            continue;
+        }
+        states.push_back(entry->state);
+        planned.push_back(entry.get());
+        if (entry->readFailed)
+            states.back().wantedMip = std::max(states.back().wantedMip, entry->state.residentMip);
+    }
+
+    const uint64_t planBudget = budgetBytes > loadingBytes ? budgetBytes - loadingBytes : 0;
+    const TextureResidency::Plan plan = TextureResidency::BuildPlan(states, planBudget, MaxLoadsPerFrame);
+
+    for (const TextureResidency::MipChange& eviction : plan.evictions)
+    {
+        EvictTo(*planned[eviction.texture], eviction.mip);
+        ++stats.evictions;
+    }
+
+    for (const TextureResidency::MipChange& load : plan.loads)
+    {
+        if (LoadMip(*planned[load.texture], load.mip))
+            ++stats.loads;
+    }
+
+    stats.textureCount = static_cast<uint32_t>(entries.size());
+    stats.targetBytes = plan.targetBytes + loadingBytes;
+    for (const auto& entry : entries)
+        stats.residentBytes += TextureResidency::ResidentBytes(entry->state, entry->state.residentMip);
+}
+
+void TextureStreamer::GatherWantedMips(const std::vector<std::shared_ptr<GameObject>>& objects)
+{
+    // 쓰는 오브젝트가 안 보이면 tail 까지 내려가도록 초기화
+    for (const auto& entry : entries)
+    {
+        entry->state.wantedMip = entry->state.tailMip;
+        entry->state.priority = 0.0f;
+    }
+
+    const Camera* camera = renderer->GetCamera();
+    const XMFLOAT3 cameraPosition = camera->GetPosition();
+    const XMFLOAT3 cameraForward = camera->GetForwardVector();
+    const float tanHalfFov = std::tan(camera->GetFovY() * 0.5f);
+    const float viewportHeight = float(renderer->GetViewportHeight());
+
+    for (const auto& object : objects)
+    {
+        const std::shared_ptr<Material> material = object->GetMaterial();
+        BoundingSphere worldBounds;
+        if (!material || !object->GetWorldBoundingSphere(worldBounds))
+            continue;
+
+        // 1) 카메라 뒤에 완전히 있으면 제외
+        const XMVECTOR toCenter = XMLoadFloat3(&worldBounds.Center) - XMLoadFloat3(&cameraPosition);
+        if (XMVectorGetX(XMVector3Dot(toCenter, XMLoadFloat3(&cameraForward))) < -worldBounds.Radius)
+            continue;
+
+        // 2) 바운딩 구 지름이 화면에서 차지하는 픽셀 (SelectLod 와 같은 기준)
+        const float distance = std::max(XMVectorGetX(XMVector3Length(toCenter)) - worldBounds.Radius, camera->GetNearZ());
+        const float pixelsPerUnit = viewportHeight / (2.0f * distance * tanHalfFov);
+        const float diameter = 2.0f * worldBounds.Radius;
+        const float screenPixels = diameter * pixelsPerUnit;
+
+        // 3) 머티리얼의 스트리밍 텍스쳐마다 가장 상세한 요구 밉 / 가장 큰 화면 점유를 취함
+        const std::shared_ptr<Texture> textures[] = {
+            material->GetAlbedoTexture(), material->GetNormalTexture(),
+            material->GetMetallicTexture(), material->GetRoughnessTexture(),
+            material->GetAmbientOcclusionTexture(), material->GetEmissiveTexture(),
+        };
+        for (const std::shared_ptr<Texture>& texture : textures)
+        {
+            auto it = texture ? entryByTexture.find(texture.get()) : entryByTexture.end();
+            if (it == entryByTexture.end())
+                continue;
+
+            TextureResidency::TextureState& state = it->second->state;
+            const float texelsPerPixel = TextureResidency::TexelsPerPixel(it->second->size, diameter, pixelsPerUnit);
+            state.wantedMip = std::min(state.wantedMip, TextureResidency::MipForTexelDensity(texelsPerPixel, state.mipCount));
+            state.priority = std::max(state.priority, screenPixels * screenPixels);
+        }
+    }
+}
+
+UINT TextureStreamer::GetTileCount(const Entry& entry, uint32_t mip) const
+{
+    if (mip == entry.state.tailMip && entry.packedMips.NumPackedMips > 0)
+        return entry.packedMips.NumTilesForPackedMips;
+
+    const D3D12_SUBRESOURCE_TILING& tiling = entry.tilings[mip];
+    return tiling.WidthInTiles * tiling.HeightInTiles * tiling.DepthInTiles;
+}
+
+void TextureStreamer::MapTiles(Entry& entry, uint32_t mip, ID3D12Heap* heap)
+{
+    // packed mip 은 첫 packed 서브리소스의 (0,0,0) 부터 NumTilesForPackedMips 개
+    D3D12_TILED_RESOURCE_COORDINATE coordinate{};
+    coordinate.Subresource = mip;
+
+    UINT tileCount = GetTileCount(entry, mip);
+    D3D12_TILE_REGION_SIZE regionSize{};
+    regionSize.NumTiles = tileCount;
+    regionSize.UseBox = FALSE;
+
+    const D3D12_TILE_RANGE_FLAGS rangeFlags = heap ? D3D12_TILE_RANGE_FLAG_NONE : D3D12_TILE_RANGE_FLAG_NULL;
+    const UINT heapRangeStart = 0;
+
+    renderer->GetCopyQueue()->UpdateTileMappings(
+        entry.resource.Get(),
+        1, &coordinate, &regionSize,
+        heap,
+        1, &rangeFlags, &heapRangeStart, &tileCount,
+        D3D12_TILE_MAPPING_FLAG_NONE);
+}
+
+bool TextureStreamer::LoadMip(Entry& entry, uint32_t mip)
+{
+    MipTiles& tiles = entry.mips[mip];
+
+    // 1) 언매핑 대기 중이던 밉: 타일과 데이터가 그대로 있으므로 취소하고 바로 SRV 교체
+    if (tiles.heap)
+    {
+        tiles.evictFenceValue = 0;
+        entry.state.residentMip = mip;
+        renderer->GetTextureManager()->UpdateStreamedView(*entry.texture, mip);
+        return true;
+    }
+
+    if (entry.IsLoading())
+        return false;
+
+    // 2) DDS 에서 올릴 밉만 (tail 이면 남은 밉 전부) 로더 스레드에서 읽음, 렌더 스레드는 기다리지 않음
+    const uint32_t lastMip = mip == entry.state.tailMip ? entry.state.mipCount - 1 : mip;
+    const uint64_t offset = entry.mipSources[mip].offset;
+    const uint64_t size = entry.mipSources[lastMip].offset + entry.mipSources[lastMip].slicePitch - offset;
+
+    entry.pending.mip = mip;
+    entry.pending.readId = ++nextReadId;
+    renderer->GetAssetLoader()->ReadFileAsync(entry.sourcePath, offset, size,
+        [this, texture = entry.texture.get(), readId = entry.pending.readId](std::vector<uint8_t>&& bytes) {
+            OnMipRead(texture, readId, std::move(bytes));
+        });
+    return true;
+}
+
+void TextureStreamer::OnMipRead(const Texture* texture, uint64_t readId, std::vector<uint8_t>&& bytes)
+{
+    // 읽는 동안 Unregister 된 텍스쳐 (같은 주소에 다시 등록된 경우 포함) 는 버림
+    auto it = entryByTexture.find(texture);
+    if (it == entryByTexture.end() || it->second->pending.readId != readId)
+        return;
+
+    Entry& entry = *it->second;
+    entry.pending.readId = 0;
+    if (bytes.empty())
+    {
+        entry.readFailed = true;
+        DebugManager::GetInstance().LogMessage(L"[Texture] Failed to read mip from " + entry.sourcePath.wstring());
+        return;
+    }
+
+    // 실패하면 다음 Update 의 계획에서 다시 요청됨
+    BeginUpload(entry, entry.pending.mip, bytes.data());
+}
+
+bool TextureStreamer::BeginUpload(Entry& entry, uint32_t mip, const uint8_t* bytes)
+{
+    const uint32_t uploadCount = mip == entry.state.tailMip ? entry.state.mipCount - mip : 1;
+
+    // 1) 밉 크기만큼 heap 을 만들어 매핑 (매핑은 큐 연산이라 배치 제출보다 먼저 처리됨)
+    D3D12_HEAP_DESC heapDesc{};
+    heapDesc.SizeInBytes = UINT64(GetTileCount(entry, mip)) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+    heapDesc.Properties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
+    heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    heapDesc.Flags = D3D12_HEAP_FLAG_DENY_BUFFERS | D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES;
+
+    ComPtr<ID3D12Heap> heap;
+    if (FAILED(renderer->GetDevice()->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap))))
+        return false;
+
+    ComPtr<ID3D12Resource> uploadBuffer;
+    MapTiles(entry, mip, heap.Get());
+    if (!RecordUpload(entry, mip, uploadCount, bytes, uploadBuffer))
+    {
+        // 매핑만 된 heap 은 언매핑이 처리된 뒤 해제
+        MapTiles(entry, mip, nullptr);
+        PendingRelease release;
+        release.resource = entry.resource;
+        release.heaps.push_back(std::move(heap));
+        release.copyFenceValue = renderer->SignalCopyFence();
+        pendingReleases.push_back(std::move(release));
+        return false;
+    }
+
+    // 2) 제출은 SubmitBatch, SRV 교체는 copy fence 가 지난 뒤 CompleteLoads
+    entry.pending.mip = mip;
+    entry.pending.copyFenceValue = 0;
+    entry.pending.heap = std::move(heap);
+    entry.pending.uploadBuffer = std::move(uploadBuffer);
+    batchEntries.push_back(&entry);
+    return true;
+}
+
+void TextureStreamer::CompleteLoads()
+{
+    const UINT64 completedValue = renderer->GetCopyFence()->GetCompletedValue();
+    for (const auto& entry : entries)
+    {
+        PendingLoad& pending = entry->pending;
+        if (!entry->IsLoading() || pending.copyFenceValue == 0 || pending.copyFenceValue > completedValue)
+            continue;
+
+        // 복사가 끝났으므로 이번 프레임부터 새 밉을 샘플링 (staging 버퍼는 여기서 해제)
+        entry->mips[pending.mip].heap = std::move(pending.heap);
+        entry->mips[pending.mip].evictFenceValue = 0;
+        pending.uploadBuffer.Reset();
+        pending.copyFenceValue = 0;
+
+        entry->state.residentMip = pending.mip;
+        renderer->GetTextureManager()->UpdateStreamedView(*entry->texture, pending.mip);
+    }
+}
+
+void TextureStreamer::EvictTo(Entry& entry, uint32_t mip)
+{
+    // SRV 는 지금 바꾸고, 타일은 이전 SRV 를 쓰던 프레임이 끝난 뒤 ProcessEvictions 에서 언매핑
+    const UINT64 fenceValue = renderer->GetDirectFenceValue();
+    for (uint32_t level = entry.state.residentMip; level < mip; ++level)
+    {
+        if (entry.mips[level].heap)
+            entry.mips[level].evictFenceValue = fenceValue;
+    }
+
+    entry.state.residentMip = mip;
+    renderer->GetTextureManager()->UpdateStreamedView(*entry.texture, mip);
+}
+
+void TextureStreamer::ProcessEvictions()
+{
+    const UINT64 completedValue = renderer->GetCompletedDirectFenceValue();
+    const UINT64 completedCopyValue = renderer->GetCopyFence()->GetCompletedValue();
+
+    PendingRelease unmapped;
+    for (const auto& entry : entries)
+    {
+        for (uint32_t mip = 0; mip < entry->state.tailMip; ++mip)
+        {
+            MipTiles& tiles = entry->mips[mip];
+            if (!tiles.heap || tiles.evictFenceValue == 0 || tiles.evictFenceValue > completedValue)
+                continue;
+
+            MapTiles(*entry, mip, nullptr);
+            unmapped.heaps.push_back(std::move(tiles.heap));
+            tiles.evictFenceValue = 0;
+        }
+    }
+
+    // 언매핑이 Copy 큐에서 처리된 뒤에 heap 해제 (기다리지 않고 다음 프레임들에서 확인)
+    if (!unmapped.heaps.empty())
+    {
+        unmapped.copyFenceValue = renderer->SignalCopyFence();
+        pendingReleases.push_back(std::move(unmapped));
+    }
+
+    std::erase_if(pendingReleases, [completedValue, completedCopyValue](const PendingRelease& release) {
+        return release.fenceValue <= completedValue && release.copyFenceValue <= completedCopyValue;
+    });
+}
+
+ID3D12GraphicsCommandList* TextureStreamer::GetBatchCommandList()
+{
+    if (openBatch)
+        return openBatch->commandList.Get();
+
+    // 1) 제출한 복사가 끝난 배치 재사용, 없으면 새로 만듦
+    const UINT64 completedValue = renderer->GetCopyFence()->GetCompletedValue();
+    auto it = std::find_if(copyBatches.begin(), copyBatches.end(),
+        [completedValue](const CopyBatch& batch) { return batch.fenceValue <= completedValue; });
+
+    if (it != copyBatches.end())
+    {
+        it->allocator->Reset();
+        it->commandList->Reset(it->allocator.Get(), nullptr);
+        openBatch = &*it;
+        return openBatch->commandList.Get();
+    }
+
+    CopyBatch batch;
+    ID3D12Device* device = renderer->GetDevice();
+    if (FAILED(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&batch.allocator))) ||
+        FAILED(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, batch.allocator.Get(), nullptr, IID_PPV_ARGS(&batch.commandList))))
+        return nullptr;
+
+    copyBatches.push_back(std::move(batch));
+    openBatch = &copyBatches.back();
+    return openBatch->commandList.Get();
+}
+
+void TextureStreamer::SubmitBatch()
+{
+    if (!openBatch)
+        return;
+
+    // 2) 제출 후 fence 값만 기록 (기다리지 않음)
+    openBatch->commandList->Close();
+    ID3D12CommandList* lists[] = { openBatch->commandList.Get() };
+    renderer->GetCopyQueue()->ExecuteCommandLists(_countof(lists), lists);
+    openBatch->fenceValue = renderer->SignalCopyFence();
+
+    for (Entry* entry : batchEntries)
+        entry->pending.copyFenceValue = openBatch->fenceValue;
+    batchEntries.clear();
+    openBatch = nullptr;
+}
+
+bool TextureStreamer::RecordUpload(Entry& entry, uint32_t firstMip, uint32_t mipCount, const uint8_t* bytes,
+    ComPtr<ID3D12Resource>& outUploadBuffer)
+{
+    ID3D12Device* device = renderer->GetDevice();
+    ID3D12GraphicsCommandList* copyList = GetBatchCommandList();
+    if (!copyList)
+        return false;
+
+    // 1) Upload heap (staging) 버퍼, 복사가 끝날 때까지 PendingLoad 가 보관
+    const UINT64 uploadSize = GetRequiredIntermediateSize(entry.resource.Get(), firstMip, mipCount);
+    CD3DX12_HEAP_PROPERTIES uploadHeap(D3D12_HEAP_TYPE_UPLOAD);
+    auto uploadDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadSize);
+
+    if (FAILED(device->CreateCommittedResource(
+        &uploadHeap,
+        D3D12_HEAP_FLAG_NONE,
+        &uploadDesc,
+        D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr,
+        IID_PPV_ARGS(&outUploadBuffer))))
+        return false;
+
+    // 2) 올릴 서브리소스만 COMMON -> COPY_DEST (매핑 안 된 밉은 건드리지 않음)
+    std::vector<D3D12_RESOURCE_BARRIER> barriers;
+    std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+    const uint64_t baseOffset = entry.mipSources[firstMip].offset;
+    for (uint32_t mip = firstMip; mip < firstMip + mipCount; ++mip)
+    {
+        barriers.push_back(CD3DX12_RESOURCE_BARRIER::Transition(
+            entry.resource.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST, mip));
+
+        const MipSource& source = entry.mipSources[mip];
+        subresources.push_back({
+            bytes + (source.offset - baseOffset),
+            static_cast<LONG_PTR>(source.rowPitch),
+            static_cast<LONG_PTR>(source.slicePitch) });
+    }
+
+    copyList->ResourceBarrier(UINT(barriers.size()), barriers.data());
+
+    UpdateSubresources(
+        copyList,
+        entry.resource.Get(),
+        outUploadBuffer.Get(),
+        0, firstMip, mipCount,
+        subresources.data());
+
+    // 3) COPY_DEST -> COMMON
+    for (D3D12_RESOURCE_BARRIER& barrier : barriers)
+        std::swap(barrier.Transition.StateBefore, barrier.Transition.StateAfter);
+    copyList->ResourceBarrier(UINT(barriers.size()), barriers.data());
+    return true;
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "TextureResidency.h"
+
+class Renderer;
+class Texture;
+class GameObject;
+
+// ---------------------------------------------------------------------------
+// TextureStreamer
+// 2D 텍스쳐를 reserved(tiled) 리소스로 만들어 밉 단위로 VRAM 을 매핑
+//   - Register: 로더 스레드가 읽은 DDS 헤더 / mip tail 로 reserved 리소스를 만들고 tail 업로드 기록
+//               (복사가 끝난 뒤 Update 에서 tail SRV 로 교체)
+//   - Update: 머티리얼을 쓰는 오브젝트의 화면 텍셀 밀도로 필요한 밉을 정하고
+//             TextureResidency::BuildPlan 결과대로 밉을 올리고 내림
+//   - 밉 읽기는 AssetLoader 로더 스레드에서 하고, 도착한 프레임 (ProcessCompleted) 에 매핑 / 복사를 기록
+//   - 업로드는 Copy 큐에 제출 후 기다리지 않고, copy fence 가 지난 프레임에 SRV 를 교체
+//   - SRV 는 상주 범위가 바뀔 때마다 새 슬롯에 MostDetailedMip / ResourceMinLODClamp 를 맞춰 다시 만든다
+//     (이전 프레임이 쓰던 슬롯은 TextureManager 가 fence 이후 반환)
+//   - 내린 밉의 타일은 그 SRV 를 쓰던 프레임이 끝난 뒤 언매핑, heap 은 언매핑이 Copy 큐에서 끝난 뒤 해제
+// 밉 데이터는 CPU 메모리에 두지 않고 올릴 때마다 DDS (원본 또는 쿠킹된 캐시) 에서 해당 밉만 읽는다
+// ---------------------------------------------------------------------------
+class TextureStreamer
+{
+public:
+    // 한 프레임에 제출하는 최대 밉 수 (복사 중인 텍스쳐는 끝날 때까지 다음 밉을 올리지 않음)
+    static constexpr uint32_t MaxLoadsPerFrame = 2;
+
+    // DDS 파일 안의 밉 데이터 위치
+    struct MipSource
+    {
+        uint64_t offset = 0;
+        uint32_t rowPitch = 0;
+        uint32_t slicePitch = 0;
+    };
+
+    // 로더 스레드에서 읽은 DDS 헤더 정보와 tail 로 예상되는 밉 데이터 (픽셀 전체는 디코드하지 않음)
+    struct Source
+    {
+        std::filesystem::path path;         // 밉을 다시 읽을 DDS (원본 또는 쿠킹된 캐시)
+        DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t mipCount = 0;
+        std::array<MipSource, TextureResidency::MaxMips> mips;
+
+        uint32_t prefetchMip = 0;           // bytes 는 [prefetchMip, mipCount) 밉
+        std::vector<uint8_t> bytes;
+    };
+
+    struct Stats
+    {
+        uint32_t textureCount = 0;
+        uint64_t residentBytes = 0;
+        uint64_t targetBytes = 0;
+        uint32_t loads = 0;         // 마지막 Update 에서
+        uint32_t evictions = 0;
+    };
+
+    // tiled 리소스를 지원하지 않으면 false (스트리밍 없이 전체 업로드)
+    bool Initialize(Renderer* renderer);
+    bool IsAvailable() const { return available; }
+
+    void SetBudgetBytes(uint64_t bytes) { budgetBytes = bytes; }
+    uint64_t GetBudgetBytes() const { return budgetBytes; }
+
+    // 로더 스레드용: 스트리밍할 BC 압축 DDS (원본 또는 쿠킹 캐시) 의 헤더와 tail 밉만 읽음
+    // 스트리밍할 수 없는 텍스쳐 (밉 1개, 배열, BC 가 아님, 쿠킹 안 됨 등) 면 false
+    static bool ReadSource(const std::wstring& filePath, Source& outSource);
+
+    // 밉 tail 업로드를 기록한다 (SRV 는 복사가 끝난 프레임에 교체, 그 전까지는 자리표시자)
+    // 미리 읽은 밉이 실제 tail 을 다 담지 못하면 tail 도 로더 스레드에서 다시 읽음
+    // 전체가 tail 이거나 리소스를 만들지 못하면 false
+    bool Register(const std::shared_ptr<Texture>& texture, const std::wstring& filePath, const Source& source);
+    void Unregister(const Texture* texture);
+    bool IsStreamed(const Texture* texture) const { return entryByTexture.count(texture) > 0; }
+
+    // Renderer::Update 에서 오브젝트 Update 이후, 머티리얼 테이블 업로드 전에 호출
+    // (AssetLoader::ProcessCompleted 가 기록한 업로드도 여기서 제출)
+    void Update(const std::vector<std::shared_ptr<GameObject>>& objects);
+
+    const Stats& GetStats() const { return stats; }
+
+private:
+    struct MipTiles
+    {
+        Microsoft::WRL::ComPtr<ID3D12Heap> heap;   // nullptr 면 매핑 안 됨
+        UINT64 evictFenceValue = 0;                // 0 이 아니면 이 direct fence 이후 언매핑
+    };
+
+    // 읽기 → 복사 → SRV 교체 중인 업로드
+    struct PendingLoad
+    {
+        uint64_t readId = 0;           // 0 이 아니면 로더 스레드에서 읽는 중 (heap 은 아직 없음)
+        uint32_t mip = 0;
+        UINT64 copyFenceValue = 0;     // 0 이면 진행 중인 업로드 없음 (제출 전이면 Submit 에서 채움)
+        Microsoft::WRL::ComPtr<ID3D12Heap> heap;
+        Microsoft::WRL::ComPtr<ID3D12Resource> uploadBuffer;
+    };
+
+    struct Entry
+    {
+        std::shared_ptr<Texture> texture;
+        std::filesystem::path sourcePath;
+        std::array<MipSource, TextureResidency::MaxMips> mipSources;
+        Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+
+        D3D12_PACKED_MIP_INFO packedMips{};
+        std::vector<D3D12_SUBRESOURCE_TILING> tilings;
+        std::array<MipTiles, TextureResidency::MaxMips> mips;  // [tailMip] 는 tail 전체
+
+        TextureResidency::TextureState state;
+        uint32_t size = 0;      // max(width, height)
+
+        PendingLoad pending;
+        bool readFailed = false;    // DDS 를 읽지 못하면 지금 상주 범위보다 상세한 밉은 요청하지 않음
+        bool IsLoading() const { return pending.readId != 0 || pending.heap != nullptr; }
+    };
+
+    // direct fence (SRV 를 쓰던 프레임) 와 copy fence (언매핑 / 업로드) 가 모두 지나면 해제
+    struct PendingRelease
+    {
+        Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+        Microsoft::WRL::ComPtr<ID3D12Resource> uploadBuffer;
+        std::vector<Microsoft::WRL::ComPtr<ID3D12Heap>> heaps;
+        UINT64 fenceValue = 0;
+        UINT64 copyFenceValue = 0;
+    };
+
+    // 스트리머 전용 Copy 커맨드 리스트 (제출한 배치의 allocator 는 copy fence 이후 재사용)
+    struct CopyBatch
+    {
+        Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
+        Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList;
+        UINT64 fenceValue = 0;
+    };
+
+    // 밉 하나 (또는 tail 전체) 를 heap 에 매핑 / heap == nullptr 이면 언매핑 (Copy 큐에 기록)
+    void MapTiles(Entry& entry, uint32_t mip, ID3D12Heap* heap);
+    UINT GetTileCount(const Entry& entry, uint32_t mip) const;
+
+    // 밉 하나 (tail 이면 남은 밉 전부) 를 로더 스레드에서 읽기 시작 (도착하면 OnMipRead)
+    bool LoadMip(Entry& entry, uint32_t mip);
+    void OnMipRead(const Texture* texture, uint64_t readId, std::vector<uint8_t>&& bytes);
+    void EvictTo(Entry& entry, uint32_t mip);
+
+    // 읽은 밉의 매핑 / 복사를 현재 배치에 기록 (bytes 는 mip 의 데이터부터, SRV 교체는 CompleteLoads)
+    bool BeginUpload(Entry& entry, uint32_t mip, const uint8_t* bytes);
+    bool RecordUpload(Entry& entry, uint32_t firstMip, uint32_t mipCount, const uint8_t* bytes,
+        Microsoft::WRL::ComPtr<ID3D12Resource>& outUploadBuffer);
+
+    ID3D12GraphicsCommandList* GetBatchCommandList();
+    void SubmitBatch();
+
+    // copy fence 가 지난 업로드의 SRV 교체
+    void CompleteLoads();
+
+    // 화면 텍셀 밀도 → wantedMip / priority
+    void GatherWantedMips(const std::vector<std::shared_ptr<GameObject>>& objects);
+
+    // 프레임이 끝난 밉은 언매핑 후 heap 해제
+    void ProcessEvictions();
+
+    Renderer* renderer = nullptr;
+    bool available = false;
+    uint64_t budgetBytes = 256ull << 20;
+
+    std::vector<std::unique_ptr<Entry>> entries;
+    std::unordered_map<const Texture*, Entry*> entryByTexture;
+    std::vector<PendingRelease> pendingReleases;
+
+    std::vector<CopyBatch> copyBatches;
+    CopyBatch* openBatch = nullptr;
+    std::vector<Entry*> batchEntries;     // openBatch 에 업로드를 기록한 엔트리
+
+    uint64_t nextReadId = 0;
+
+    Stats stats;
+};
@@ -1,10 +1,20 @@
 #include "ThreadPool.h"
 
-ThreadPool::ThreadPool(size_t numThreads_) 
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+ThreadPool::ThreadPool(size_t numThreads_, bool lowPriority) 
     : numThreads(numThreads_)
 {
     for (size_t i = 0; i < numThreads; ++i) {
         workers.emplace_back([this]() { WorkerLoop(); });
+#ifdef _WIN32
+        if (lowPriority)
+            SetThreadPriority(workers.back().native_handle(), THREAD_PRIORITY_BELOW_NORMAL);
+#else
+        (void)lowPriority;
+#endif
     }
 }
 
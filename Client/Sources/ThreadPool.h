@@ -10,7 +10,8 @@
 
 class ThreadPool {
 public:
-    ThreadPool(size_t numThreads);
+    // lowPriority: 워커를 보통보다 낮은 우선순위로 (렌더 스레드와 겹치는 백그라운드 컴파일 / 로드용)
+    ThreadPool(size_t numThreads, bool lowPriority = false);
     ~ThreadPool();
 
     // 작업을 스레드풀에 제출
@@ -0,0 +1,75 @@
+#include "TransientDescriptorRing.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    // 링 인스턴스 / 프레임이 바뀌면 epoch 가 달라지므로 지난 커서는 자동으로 버려진다
+    std::atomic<uint64_t> nextEpoch{ 1 };
+
+    struct ThreadCursor
+    {
+        uint64_t epoch = 0;
+        uint32_t next = 0;
+        uint32_t end = 0;
+    };
+
+    thread_local ThreadCursor threadCursor;
+}
+
+void TransientDescriptorRing::Reset(uint32_t newBaseIndex, uint32_t newCountPerFrame, uint32_t newFrameCount)
+{
+    baseIndex = newBaseIndex;
+    countPerFrame = newCountPerFrame;
+    frameCount = std::max(newFrameCount, 1u);
+    BeginFrame(0);
+}
+
+void TransientDescriptorRing::BeginFrame(uint32_t frameIndex)
+{
+    frameBase = baseIndex + (frameIndex % frameCount) * countPerFrame;
+    epoch = nextEpoch.fetch_add(1, std::memory_order_relaxed);
+    frameOffset.store(0, std::memory_order_relaxed);
+}
+
+uint32_t TransientDescriptorRing::Allocate(uint32_t count)
+{
+    // 1) 청크보다 큰 요청은 공유 구간에서 바로
+    if (count > ThreadChunk)
+        return ClaimShared(count);
+
+    // 2) 스레드 커서 안에서 bump (lock / atomic 없음)
+    ThreadCursor& cursor = threadCursor;
+    if (cursor.epoch != epoch || cursor.next + count > cursor.end)
+    {
+        // 커서 리필: 남은 슬롯은 이번 프레임 끝까지 버린다
+        const uint32_t offset = frameOffset.fetch_add(ThreadChunk, std::memory_order_relaxed);
+        const uint32_t end = std::min(offset + ThreadChunk, countPerFrame);
+        if (offset >= countPerFrame || offset + count > end)
+            throw std::runtime_error("TransientDescriptorRing: frame range exhausted");
+
+        cursor.epoch = epoch;
+        cursor.next = frameBase + offset;
+        cursor.end = frameBase + end;
+    }
+
+    const uint32_t index = cursor.next;
+    cursor.next += count;
+    return index;
+}
+
+uint32_t TransientDescriptorRing::ClaimShared(uint32_t count)
+{
+    const uint32_t offset = frameOffset.fetch_add(count, std::memory_order_relaxed);
+    if (offset + count > countPerFrame)
+        throw std::runtime_error("TransientDescriptorRing: frame range exhausted");
+    return frameBase + offset;
+}
+
+TransientDescriptorRing::Stats TransientDescriptorRing::GetStats() const
+{
+    Stats stats;
+    stats.capacityPerFrame = countPerFrame;
+    stats.claimed = std::min(frameOffset.load(std::memory_order_relaxed), countPerFrame);
+    return stats;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// ---------------------------------------------------------------------------
+// 프레임별 transient 디스크립터 링 (D3D 없이 동작하는 순수 로직, DescriptorHeapManager 가 CBV_SRV_UAV 힙 끝부분에 하나 소유)
+//   - [baseIndex, baseIndex + countPerFrame * frameCount) 를 frameCount 개 구간으로 나눠 프레임마다 하나씩 사용
+//   - BeginFrame() 은 해당 프레임 구간을 통째로 리셋 (그 구간을 쓴 프레임의 fence 를 기다린 뒤 호출)
+//   - Allocate() 는 lock 없이 호출 가능: 스레드마다 ThreadChunk 개씩 atomic 으로 떼어 가서 그 안에서 bump
+//   - 슬롯은 이번 프레임 커맨드 리스트에서만 유효하고 따로 해제하지 않는다
+// ---------------------------------------------------------------------------
+class TransientDescriptorRing
+{
+public:
+    // 스레드 커서가 한번에 가져가는 슬롯 수
+    static constexpr uint32_t ThreadChunk = 64;
+
+    struct Stats
+    {
+        uint32_t capacityPerFrame = 0;
+        uint32_t claimed = 0;           // 이번 프레임에 스레드 커서들이 가져간 슬롯 수 (청크 단위)
+    };
+
+    void Reset(uint32_t baseIndex, uint32_t countPerFrame, uint32_t frameCount);
+
+    // Allocate() 와 동시에 호출하면 안 됨 (프레임 시작, 워커 제출 전)
+    void BeginFrame(uint32_t frameIndex);
+
+    // 연속 count 개의 시작 인덱스, 이번 프레임 구간이 모자라면 std::runtime_error
+    uint32_t Allocate(uint32_t count);
+
+    Stats GetStats() const;
+
+private:
+    uint32_t ClaimShared(uint32_t count);
+
+    uint32_t baseIndex = 0;
+    uint32_t countPerFrame = 0;
+    uint32_t frameCount = 0;
+
+    uint32_t frameBase = 0;                 // 이번 프레임 구간 시작
+    uint64_t epoch = 0;                     // BeginFrame 마다 새 값 (스레드 커서 무효화)
+    std::atomic<uint32_t> frameOffset{ 0 }; // 이번 프레임 구간에서 떼어 간 슬롯 수
+};
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// ---------------------------------------------------------------------------
+// Compact 정점 포맷 (20 바이트, MeshVertex 44 바이트)
+//   position : R16G16B16A16_UNORM, 메시 AABB 기준 (xyz = (p - bias) / scale)
+//              w = 탄젠트 부호 (1 = +1, 0 = -1)
+//   normal   : R16G16_SNORM, octahedral
+//   tangent  : R16G16_SNORM, octahedral
+//   texCoord : R16G16_FLOAT
+// 디코드는 Common.hlsli 의 DecodeCompactPosition / OctDecode 와 동일하게 유지할 것
+// ---------------------------------------------------------------------------
+struct CompactMeshVertex
+{
+    uint16_t position[4];
+    int16_t  normal[2];
+    int16_t  tangent[2];
+    uint16_t texCoord[2];   // HALF
+};
+static_assert(sizeof(CompactMeshVertex) == 20, "CompactMeshVertex layout must match the compact input layout");
+
+namespace VertexCompression
+{
+    // p = q * scale + bias (q 는 UNORM 디코드 값 [0, 1])
+    struct PositionQuantization
+    {
+        DirectX::XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
+        DirectX::XMFLOAT3 bias = { 0.0f, 0.0f, 0.0f };
+    };
+
+    inline PositionQuantization ComputePositionQuantization(const DirectX::XMFLOAT3& boundsMin, const DirectX::XMFLOAT3& boundsMax)
+    {
+        // 두께가 0 인 축은 1 로 두어 0 나누기 방지 (어차피 q = 0)
+        auto extent = [](float lo, float hi) { return hi > lo ? hi - lo : 1.0f; };
+
+        PositionQuantization quantization;
+        quantization.scale = { extent(boundsMin.x, boundsMax.x), extent(boundsMin.y, boundsMax.y), extent(boundsMin.z, boundsMax.z) };
+        quantization.bias = boundsMin;
+        return quantization;
+    }
+
+    inline uint16_t EncodeUnorm16(float v)
+    {
+        return static_cast<uint16_t>(std::lround(std::clamp(v, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    inline int16_t EncodeSnorm16(float v)
+    {
+        return static_cast<int16_t>(std::lround(std::clamp(v, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    inline float DecodeUnorm16(uint16_t v)
+    {
+        return float(v) / 65535.0f;
+    }
+
+    // D3D SNORM 규칙: -32768 과 -32767 모두 -1
+    inline float DecodeSnorm16(int16_t v)
+    {
+        return std::max(float(v) / 32767.0f, -1.0f);
+    }
+
+    inline void EncodePosition(const DirectX::XMFLOAT3& p, const PositionQuantization& quantization, float tangentSign, uint16_t out[4])
+    {
+        out[0] = EncodeUnorm16((p.x - quantization.bias.x) / quantization.scale.x);
+        out[1] = EncodeUnorm16((p.y - quantization.bias.y) / quantization.scale.y);
+        out[2] = EncodeUnorm16((p.z - quantization.bias.z) / quantization.scale.z);
+        out[3] = tangentSign < 0.0f ? 0 : 0xFFFF;
+    }
+
+    inline DirectX::XMFLOAT3 DecodePosition(const uint16_t in[4], const PositionQuantization& quantization)
+    {
+        return {
+            DecodeUnorm16(in[0]) * quantization.scale.x + quantization.bias.x,
+            DecodeUnorm16(in[1]) * quantization.scale.y + quantization.bias.y,
+            DecodeUnorm16(in[2]) * quantization.scale.z + quantization.bias.z };
+    }
+
+    // 단위 벡터 → 팔면체 → [-1, 1]^2
+    inline void OctEncode(const DirectX::XMFLOAT3& n, int16_t out[2])
+    {
+        const float l1 = std::fabs(n.x) + std::fabs(n.y) + std::fabs(n.z);
+        if (l1 <= 0.0f) {
+            out[0] = 0;
+            out[1] = 0;
+            return;
+        }
+
+        float x = n.x / l1;
+        float y = n.y / l1;
+        if (n.z < 0.0f) {
+            // 아래 반구는 대각선 기준으로 접어서 펼침
+            const float foldedX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            const float foldedY = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = foldedX;
+            y = foldedY;
+        }
+
+        out[0] = EncodeSnorm16(x);
+        out[1] = EncodeSnorm16(y);
+    }
+
+    inline DirectX::XMFLOAT3 OctDecode(const int16_t in[2])
+    {
+        const float x = DecodeSnorm16(in[0]);
+        const float y = DecodeSnorm16(in[1]);
+
+        DirectX::XMFLOAT3 n = { x, y, 1.0f - std::fabs(x) - std::fabs(y) };
+        const float t = std::max(-n.z, 0.0f);
+        n.x += n.x >= 0.0f ? -t : t;
+        n.y += n.y >= 0.0f ? -t : t;
+
+        const float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+        return { n.x / length, n.y / length, n.z / length };
+    }
+
+    inline void EncodeTexCoord(const DirectX::XMFLOAT2& uv, uint16_t out[2])
+    {
+        out[0] = DirectX::PackedVector::XMConvertFloatToHalf(uv.x);
+        out[1] = DirectX::PackedVector::XMConvertFloatToHalf(uv.y);
+    }
+
+    inline CompactMeshVertex EncodeVertex(
+        const DirectX::XMFLOAT3& position,
+        const DirectX::XMFLOAT3& normal,
+        const DirectX::XMFLOAT2& texCoord,
+        const DirectX::XMFLOAT3& tangent,
+        const PositionQuantization& quantization,
+        float tangentSign = 1.0f)
+    {
+        CompactMeshVertex v{};
+        EncodePosition(position, quantization, tangentSign, v.position);
+        OctEncode(normal, v.normal);
+        OctEncode(tangent, v.tangent);
+        EncodeTexCoord(texCoord, v.texCoord);
+        return v;
+    }
+}
@@ -1,10 +1,17 @@
 // #define USE_PIX
 
 #include "Game.h"
+#include "MeshLoadBenchmark.h"
 #include <pix3.h>
 
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
+    // 벤치마크 모드 (--bench-mesh-cache): 창/디바이스를 만들지 않고 측정 후 종료
+    int benchmarkExitCode = 0;
+    if (MeshLoadBenchmark::RunFromCommandLine(benchmarkExitCode)) {
+        return benchmarkExitCode;
+    }
+
     Game game;
 
 #ifdef USE_PIX
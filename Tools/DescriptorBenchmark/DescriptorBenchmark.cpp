@@ -0,0 +1,139 @@
+// DescriptorBenchmark
+// 렌더 워커가 드로우마다 t0~t3 테이블(연속 4 슬롯)을 잡는 패턴으로 디스크립터 할당 처리량을 잰다.
+//
+//   DescriptorBenchmark [drawsPerThread] [frames]
+//
+// - Persistent: DescriptorHeapManager 의 영구 경로 (mutex + DescriptorAllocator::Allocate, fence 로 보류되는 Free,
+//               프레임 시작에 ProcessDeferredFrees)
+// - Transient : TransientDescriptorRing (프레임 시작에 BeginFrame, 스레드별 커서에서 lock 없이 bump)
+// 스레드 수 1 / 2 / 4 / 8 / hardware_concurrency 별로 초당 할당 수와 할당당 ns (최소 / 중간값 프레임)
+
+#include "DescriptorAllocator.h"
+#include "TransientDescriptorRing.h"
+
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint32_t TableSize = 4;
+    constexpr uint32_t FrameCount = 3;      // Renderer::BackBufferCount
+
+    struct Result
+    {
+        double minNanoseconds = 0.0;        // 할당 1 회당
+        double medianNanoseconds = 0.0;
+    };
+
+    // 워커들이 barrier 로 프레임을 맞추며 allocate(thread) 를 drawsPerThread 번 호출, beginFrame 은 메인 스레드에서
+    template <typename BeginFrame, typename Allocate>
+    Result RunFrames(uint32_t threadCount, uint32_t drawsPerThread, uint32_t frames,
+        BeginFrame&& beginFrame, Allocate&& allocate)
+    {
+        std::barrier start(threadCount + 1);
+        std::barrier finish(threadCount + 1);
+        std::vector<std::thread> workers;
+        for (uint32_t t = 0; t < threadCount; ++t)
+        {
+            workers.emplace_back([&] {
+                for (uint32_t frame = 0; frame < frames; ++frame)
+                {
+                    start.arrive_and_wait();
+                    for (uint32_t draw = 0; draw < drawsPerThread; ++draw)
+                        allocate();
+                    finish.arrive_and_wait();
+                }
+            });
+        }
+
+        std::vector<double> frameNanoseconds;
+        for (uint32_t frame = 0; frame < frames; ++frame)
+        {
+            beginFrame(frame);
+            const Clock::time_point begin = Clock::now();
+            start.arrive_and_wait();
+            finish.arrive_and_wait();
+            frameNanoseconds.push_back(std::chrono::duration<double, std::nano>(Clock::now() - begin).count());
+        }
+        for (std::thread& worker : workers)
+            worker.join();
+
+        // 첫 프레임은 스레드 깨우기 / 캐시 워밍업이라 제외
+        if (frameNanoseconds.size() > 1)
+            frameNanoseconds.erase(frameNanoseconds.begin());
+        std::sort(frameNanoseconds.begin(), frameNanoseconds.end());
+
+        const double allocationsPerFrame = double(threadCount) * drawsPerThread;
+        Result result;
+        result.minNanoseconds = frameNanoseconds.front() / allocationsPerFrame;
+        result.medianNanoseconds = frameNanoseconds[frameNanoseconds.size() / 2] / allocationsPerFrame;
+        return result;
+    }
+
+    Result RunPersistent(uint32_t threadCount, uint32_t drawsPerThread, uint32_t frames)
+    {
+        const uint32_t perFrame = threadCount * drawsPerThread * TableSize;
+        DescriptorAllocator allocator;
+        allocator.Reset(perFrame * (FrameCount + 1));
+        std::mutex mutex;
+
+        // 기존 CreateTransientTable 경로: 잡고 바로 이번 프레임 fence 로 Free, FrameCount 프레임 뒤에 회수
+        uint64_t fenceValue = 0;
+        return RunFrames(threadCount, drawsPerThread, frames,
+            [&](uint32_t frame) {
+                std::lock_guard<std::mutex> lock(mutex);
+                fenceValue = frame + 1;
+                if (fenceValue > FrameCount)
+                    allocator.ProcessDeferredFrees(fenceValue - FrameCount);
+            },
+            [&] {
+                std::lock_guard<std::mutex> lock(mutex);
+                const uint32_t index = allocator.Allocate(TableSize);
+                allocator.Free(index, TableSize, fenceValue);
+            });
+    }
+
+    Result RunTransient(uint32_t threadCount, uint32_t drawsPerThread, uint32_t frames)
+    {
+        const uint32_t perFrame = threadCount * (drawsPerThread * TableSize + TransientDescriptorRing::ThreadChunk);
+        TransientDescriptorRing ring;
+        ring.Reset(0, perFrame, FrameCount);
+
+        return RunFrames(threadCount, drawsPerThread, frames,
+            [&](uint32_t frame) { ring.BeginFrame(frame); },
+            [&] { ring.Allocate(TableSize); });
+    }
+
+    void Print(const char* name, uint32_t threadCount, const Result& result)
+    {
+        std::printf("  %-10s %2u threads  %8.1f ns/alloc (min %6.1f)  %8.2f M allocs/s\n",
+            name, threadCount, result.medianNanoseconds, result.minNanoseconds, 1e3 / result.medianNanoseconds);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t drawsPerThread = argc > 1 ? uint32_t(std::max(std::atoi(argv[1]), 1)) : 20000;
+    const uint32_t frames = argc > 2 ? uint32_t(std::max(std::atoi(argv[2]), 2)) : 30;
+
+    std::vector<uint32_t> threadCounts = { 1, 2, 4, 8 };
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads > 8)
+        threadCounts.push_back(hardwareThreads);
+
+    std::printf("descriptor tables of %u, %u draws per thread, %u frames\n", TableSize, drawsPerThread, frames);
+    for (uint32_t threadCount : threadCounts)
+    {
+        Print("persistent", threadCount, RunPersistent(threadCount, drawsPerThread, frames));
+        Print("transient", threadCount, RunTransient(threadCount, drawsPerThread, frames));
+    }
+    return 0;
+}
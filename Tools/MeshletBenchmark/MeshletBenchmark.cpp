@@ -0,0 +1,176 @@
+// MeshletBenchmark
+// 절차적 구(울퉁불퉁한 표면) 메시로 Meshlets::Build 속도와 Meshlets::Cull 의 컬링 비율 / 시간을 잰다.
+//
+//   MeshletBenchmark [segments] [iterations]
+//   (segments: 경도 분할 수, 위도는 절반 → 삼각형 약 segments^2 개)
+//
+// - Build: 매 반복마다 원본 인덱스를 복사해서 재배치 (최소 / 중간값 ms, 초당 삼각형)
+// - Cull : 바깥 궤도 / 표면 근접 / 두 뷰 합집합 시나리오별 frustum / cone 컬링 비율, 메시릿당 ns, 드로우 구간 수
+
+#include "Meshlets.h"
+#include "MeshVertex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace DirectX;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct BenchMesh
+    {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // 반지름 1 근처의 UV 구 (노멀 콘이 다양해지도록 표면에 물결)
+    BenchMesh BuildSphere(uint32_t segments)
+    {
+        BenchMesh mesh;
+        const uint32_t rings = std::max(segments / 2, 2u);
+
+        for (uint32_t r = 0; r <= rings; ++r) {
+            const float theta = XM_PI * r / rings;
+            for (uint32_t s = 0; s <= segments; ++s) {
+                const float phi = XM_2PI * s / segments;
+                const float radius = 1.0f + 0.02f * std::sin(phi * 13.0f) * std::sin(theta * 9.0f);
+                const XMFLOAT3 n(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+
+                MeshVertex v = {};
+                v.position = XMFLOAT3(n.x * radius, n.y * radius, n.z * radius);
+                v.normal = n;
+                v.texCoord = XMFLOAT2(float(s) / segments, float(r) / rings);
+                mesh.vertices.push_back(v);
+            }
+        }
+
+        // 앞면(CW) 기준 면 노멀이 바깥을 보도록 감는 방향 맞춤
+        auto addTriangle = [&](uint32_t a, uint32_t b, uint32_t c) {
+            const XMVECTOR p0 = XMLoadFloat3(&mesh.vertices[a].position);
+            const XMVECTOR normal = XMVector3Cross(
+                XMVectorSubtract(XMLoadFloat3(&mesh.vertices[b].position), p0),
+                XMVectorSubtract(XMLoadFloat3(&mesh.vertices[c].position), p0));
+            if (XMVectorGetX(XMVector3Dot(normal, p0)) < 0.0f)
+                std::swap(b, c);
+            mesh.indices.insert(mesh.indices.end(), { a, b, c });
+        };
+
+        const uint32_t stride = segments + 1;
+        for (uint32_t r = 0; r < rings; ++r) {
+            for (uint32_t s = 0; s < segments; ++s) {
+                const uint32_t i0 = r * stride + s;
+                const uint32_t i1 = i0 + 1;
+                const uint32_t i2 = i0 + stride;
+                const uint32_t i3 = i2 + 1;
+                if (r != 0)
+                    addTriangle(i0, i1, i2);
+                if (r + 1 != rings)
+                    addTriangle(i1, i3, i2);
+            }
+        }
+        return mesh;
+    }
+
+    double Milliseconds(Clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    void RunBuild(const BenchMesh& mesh, uint32_t iterations, Meshlets::MeshletData& outData, std::vector<uint32_t>& outIndices)
+    {
+        std::vector<double> times;
+        for (uint32_t i = 0; i < iterations; ++i) {
+            std::vector<uint32_t> indices = mesh.indices;
+            Meshlets::MeshletData data;
+
+            const auto startTime = Clock::now();
+            Meshlets::Build(mesh.vertices, indices, 0, indices.size(), data);
+            times.push_back(Milliseconds(Clock::now() - startTime));
+
+            if (i + 1 == iterations) {
+                outData = std::move(data);
+                outIndices = std::move(indices);
+            }
+        }
+
+        std::sort(times.begin(), times.end());
+        const double triangles = double(mesh.indices.size() / 3);
+        const double median = times[times.size() / 2];
+
+        size_t vertexSum = 0;
+        for (const Meshlets::Meshlet& meshlet : outData.meshlets)
+            vertexSum += meshlet.vertexCount;
+
+        std::printf("Build: %.0f tris -> %zu meshlets (avg %.1f verts, %.1f tris)\n",
+            triangles, outData.meshlets.size(),
+            double(vertexSum) / outData.meshlets.size(), triangles / outData.meshlets.size());
+        std::printf("  min %.2f ms, median %.2f ms, %.2f Mtris/s\n", times.front(), median, triangles / median * 1e-3);
+    }
+
+    struct CullScenario
+    {
+        const char* name;
+        XMFLOAT3 eyes[2];
+        uint32_t viewCount;
+    };
+
+    void RunCull(const Meshlets::MeshletData& data, uint32_t iterations)
+    {
+        const XMMATRIX world = XMMatrixIdentity();
+        const XMMATRIX projection = XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.05f, 100.0f);
+        const XMVECTOR target = XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
+        const XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+
+        const CullScenario scenarios[] = {
+            { "orbit (whole sphere in view)", { XMFLOAT3(0.0f, 0.5f, -4.0f) }, 1 },
+            { "close (surface fills view)",   { XMFLOAT3(0.3f, 0.2f, -1.4f) }, 1 },
+            { "two views (front + back)",     { XMFLOAT3(0.0f, 0.0f, -4.0f), XMFLOAT3(0.0f, 0.0f, 4.0f) }, 2 },
+        };
+
+        std::vector<Meshlets::DrawRange> ranges;
+        for (const CullScenario& scenario : scenarios) {
+            Meshlets::CullView views[2];
+            for (uint32_t i = 0; i < scenario.viewCount; ++i) {
+                const XMMATRIX view = XMMatrixLookAtLH(XMLoadFloat3(&scenario.eyes[i]), target, up);
+                views[i] = Meshlets::MakeCullView(world, view * projection);
+            }
+
+            Meshlets::CullStats stats;
+            const auto startTime = Clock::now();
+            for (uint32_t i = 0; i < iterations; ++i) {
+                ranges.clear();
+                stats = {};
+                Meshlets::Cull(data, views, scenario.viewCount, ranges, stats);
+            }
+            const double nanoseconds = Milliseconds(Clock::now() - startTime) * 1e6 / iterations;
+
+            const double tested = std::max(double(stats.tested), 1.0);
+            std::printf("Cull %-30s frustum %5.1f%%, cone %5.1f%%, visible %5.1f%%, %zu ranges, %.1f ns/meshlet\n",
+                scenario.name,
+                100.0 * stats.frustumCulled / tested,
+                100.0 * stats.coneCulled / tested,
+                100.0 * (stats.tested - stats.frustumCulled - stats.coneCulled) / tested,
+                ranges.size(), nanoseconds / tested);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t segments = argc > 1 ? uint32_t(std::max(std::atoi(argv[1]), 8)) : 512;
+    const uint32_t iterations = argc > 2 ? uint32_t(std::max(std::atoi(argv[2]), 1)) : 5;
+
+    const BenchMesh mesh = BuildSphere(segments);
+
+    Meshlets::MeshletData data;
+    std::vector<uint32_t> indices;
+    RunBuild(mesh, iterations, data, indices);
+    RunCull(data, iterations * 20);
+    return 0;
+}
@@ -0,0 +1,386 @@
+// ShaderCooker
+// ShaderManifest.txt 의 셰이더들을 DXC(SM 6.x)로 컴파일하여 ShaderArchive(.pak) 하나로 묶는다.
+//
+//   ShaderCooker <manifest> <output.pak> [--dxc <path>] [--shader-model 6_0] [--root <dir>]
+//
+// - 증분 빌드: 기존 .pak 의 sourceHash(소스 + 재귀 include) / optionsHash 가 같으면 DXC 를 다시 돌리지 않는다
+// - <output.pak>.d 에 의존 파일 목록(depfile)을 기록하여 빌드 시스템에서 재실행 조건으로 쓸 수 있다
+// - 런타임(ShaderManager::LoadArchive)은 .pak 을 memory-map 해서 그대로 사용
+
+#include "ShaderArchive.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    struct ManifestEntry
+    {
+        std::string name;
+        std::string path;
+        std::string entryPoint;
+        std::string profile;
+        std::vector<std::string> defines;       // NAME=VALUE
+    };
+
+    struct CookedShader
+    {
+        std::string name;
+        uint64_t sourceHash = 0;
+        uint64_t optionsHash = 0;
+        std::vector<uint8_t> bytecode;
+    };
+
+    struct Options
+    {
+        fs::path manifestPath;
+        fs::path outputPath;
+        fs::path root = fs::current_path();
+        std::string dxcPath = "dxc";
+        std::string shaderModel = "6_0";
+    };
+
+    std::wstring Widen(const std::string& s)
+    {
+        return std::wstring(s.begin(), s.end());    // 이름은 ASCII 만 사용
+    }
+
+    // NAME={A..B} 형태의 define 을 값마다 하나의 셰이더로 펼친다 (이름의 {} 를 값으로 치환)
+    bool ExpandPermutations(const ManifestEntry& entry, std::vector<ManifestEntry>& outEntries)
+    {
+        for (size_t i = 0; i < entry.defines.size(); ++i) {
+            const std::string& define = entry.defines[i];
+            const size_t open = define.find("={");
+            if (open == std::string::npos || define.back() != '}')
+                continue;
+
+            const std::string range = define.substr(open + 2, define.size() - open - 3);
+            const size_t dots = range.find("..");
+            if (dots == std::string::npos)
+                return false;
+
+            int first = 0, last = 0;
+            try {
+                first = std::stoi(range.substr(0, dots));
+                last = std::stoi(range.substr(dots + 2));
+            }
+            catch (const std::exception&) {
+                return false;
+            }
+
+            for (int value = first; value <= last; ++value) {
+                ManifestEntry expanded = entry;
+                expanded.defines[i] = define.substr(0, open + 1) + std::to_string(value);
+                if (const size_t placeholder = expanded.name.find("{}"); placeholder != std::string::npos)
+                    expanded.name.replace(placeholder, 2, std::to_string(value));
+
+                if (!ExpandPermutations(expanded, outEntries))
+                    return false;
+            }
+            return true;
+        }
+
+        outEntries.push_back(entry);
+        return true;
+    }
+
+    bool ParseManifest(const fs::path& path, std::vector<ManifestEntry>& outEntries)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "Cannot open manifest: " << path << "\n";
+            return false;
+        }
+
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            if (const size_t comment = line.find('#'); comment != std::string::npos)
+                line.erase(comment);
+
+            std::istringstream tokens(line);
+            ManifestEntry entry;
+            if (!(tokens >> entry.name))
+                continue;   // 빈 줄
+
+            if (!(tokens >> entry.path >> entry.entryPoint >> entry.profile)) {
+                std::cerr << path << ":" << lineNumber << ": expected <name> <path> <entry> <profile>\n";
+                return false;
+            }
+
+            std::string define;
+            while (tokens >> define)
+                entry.defines.push_back(define);
+
+            if (!ExpandPermutations(entry, outEntries)) {
+                std::cerr << path << ":" << lineNumber << ": invalid permutation range\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadFileBytes(const fs::path& path, std::vector<uint8_t>& out)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+        out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    // 기존 아카이브 읽기 (증분 빌드용). 없거나 버전이 다르면 빈 결과
+    std::map<std::string, CookedShader> ReadPreviousArchive(const fs::path& path)
+    {
+        using namespace ShaderArchive;
+        std::map<std::string, CookedShader> result;
+
+        std::vector<uint8_t> data;
+        if (!ReadFileBytes(path, data) || data.size() < sizeof(ArchiveHeader))
+            return result;
+
+        ArchiveHeader header{};
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.magic != Magic || header.version != Version)
+            return result;
+        if (sizeof(ArchiveHeader) + uint64_t(header.entryCount) * sizeof(ArchiveEntry) > data.size())
+            return result;
+
+        for (uint32_t i = 0; i < header.entryCount; ++i) {
+            ArchiveEntry entry{};
+            std::memcpy(&entry, data.data() + sizeof(ArchiveHeader) + i * sizeof(ArchiveEntry), sizeof(entry));
+            if (entry.nameOffset + uint64_t(entry.nameLength) * 2 > data.size() ||
+                entry.bytecodeOffset + entry.bytecodeSize > data.size())
+                return {};
+
+            CookedShader shader;
+            for (uint32_t c = 0; c < entry.nameLength; ++c) {
+                uint16_t unit = 0;
+                std::memcpy(&unit, data.data() + entry.nameOffset + c * 2, 2);
+                shader.name.push_back(static_cast<char>(unit));
+            }
+            shader.sourceHash = entry.sourceHash;
+            shader.optionsHash = entry.optionsHash;
+            shader.bytecode.assign(
+                data.begin() + entry.bytecodeOffset,
+                data.begin() + entry.bytecodeOffset + entry.bytecodeSize);
+            result[shader.name] = std::move(shader);
+        }
+        return result;
+    }
+
+    std::string Quote(const std::string& s)
+    {
+        return "\"" + s + "\"";
+    }
+
+    bool CompileWithDxc(const Options& options, const ManifestEntry& entry,
+        const std::string& dxcProfile, std::vector<uint8_t>& outBytecode)
+    {
+        const fs::path tempOutput = fs::temp_directory_path() / ("ShaderCooker_" + entry.name + ".dxil");
+
+        std::string command = Quote(options.dxcPath)
+            + " -nologo -O3"
+            + " -T " + dxcProfile
+            + " -E " + entry.entryPoint;
+        for (const auto& define : entry.defines)
+            command += " -D " + define;
+        command += " -Fo " + Quote(tempOutput.string());
+        command += " " + Quote((options.root / entry.path).string());
+
+        if (std::system(command.c_str()) != 0) {
+            std::cerr << "DXC failed: " << entry.name << "\n  " << command << "\n";
+            return false;
+        }
+
+        const bool read = ReadFileBytes(tempOutput, outBytecode);
+        std::error_code ec;
+        fs::remove(tempOutput, ec);
+        return read && !outBytecode.empty();
+    }
+
+    bool WriteArchive(const fs::path& path, uint32_t shaderModel, std::vector<CookedShader>& shaders)
+    {
+        using namespace ShaderArchive;
+
+        // 런타임 이진 탐색을 위해 nameHash 순으로 정렬
+        std::sort(shaders.begin(), shaders.end(), [](const CookedShader& a, const CookedShader& b) {
+            return HashName(Widen(a.name)) < HashName(Widen(b.name));
+        });
+
+        std::vector<ArchiveEntry> entries(shaders.size());
+        uint64_t offset = sizeof(ArchiveHeader) + entries.size() * sizeof(ArchiveEntry);
+
+        for (size_t i = 0; i < shaders.size(); ++i) {
+            entries[i] = {};
+            entries[i].nameHash = HashName(Widen(shaders[i].name));
+            entries[i].sourceHash = shaders[i].sourceHash;
+            entries[i].optionsHash = shaders[i].optionsHash;
+            entries[i].nameOffset = offset;
+            entries[i].nameLength = static_cast<uint32_t>(shaders[i].name.size());
+            offset += shaders[i].name.size() * 2;
+        }
+        for (size_t i = 0; i < shaders.size(); ++i) {
+            offset = (offset + 15) & ~uint64_t(15);
+            entries[i].bytecodeOffset = offset;
+            entries[i].bytecodeSize = shaders[i].bytecode.size();
+            offset += shaders[i].bytecode.size();
+        }
+
+        std::vector<uint8_t> data(offset, 0);
+        ArchiveHeader header{ Magic, Version, static_cast<uint32_t>(shaders.size()), shaderModel };
+        std::memcpy(data.data(), &header, sizeof(header));
+        std::memcpy(data.data() + sizeof(header), entries.data(), entries.size() * sizeof(ArchiveEntry));
+
+        for (size_t i = 0; i < shaders.size(); ++i) {
+            for (size_t c = 0; c < shaders[i].name.size(); ++c) {
+                const uint16_t unit = static_cast<uint8_t>(shaders[i].name[c]);     // UTF-16LE
+                std::memcpy(data.data() + entries[i].nameOffset + c * 2, &unit, 2);
+            }
+            std::memcpy(data.data() + entries[i].bytecodeOffset,
+                shaders[i].bytecode.data(), shaders[i].bytecode.size());
+        }
+
+        if (path.has_parent_path())
+            fs::create_directories(path.parent_path());
+
+        // 쓰는 도중 실패해도 기존 아카이브가 깨지지 않도록 임시 파일 후 교체
+        const fs::path tempPath = fs::path(path).concat(".tmp");
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+                return false;
+            file.write(reinterpret_cast<const char*>(data.data()), data.size());
+            if (!file)
+                return false;
+        }
+        fs::rename(tempPath, path);
+        return true;
+    }
+
+    void WriteDepFile(const fs::path& outputPath, const std::vector<fs::path>& dependencies)
+    {
+        std::ofstream file(fs::path(outputPath).concat(".d"));
+        file << outputPath.string() << ":";
+        for (const auto& dependency : dependencies)
+            file << " \\\n  " << dependency.string();
+        file << "\n";
+    }
+
+    bool ParseArguments(int argc, char** argv, Options& options)
+    {
+        std::vector<std::string> positional;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--dxc" && i + 1 < argc)
+                options.dxcPath = argv[++i];
+            else if (arg == "--shader-model" && i + 1 < argc)
+                options.shaderModel = argv[++i];
+            else if (arg == "--root" && i + 1 < argc)
+                options.root = argv[++i];
+            else
+                positional.push_back(arg);
+        }
+
+        if (positional.size() != 2)
+            return false;
+
+        options.manifestPath = positional[0];
+        options.outputPath = positional[1];
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseArguments(argc, argv, options)) {
+        std::cerr << "usage: ShaderCooker <manifest> <output.pak> "
+                     "[--dxc <path>] [--shader-model 6_0] [--root <dir>]\n";
+        return 2;
+    }
+
+    const uint32_t shaderModel = ShaderArchive::ParseShaderModel(options.shaderModel);
+    if (shaderModel < 0x60) {
+        std::cerr << "--shader-model must be 6_0 or higher (got " << options.shaderModel << ")\n";
+        return 2;
+    }
+
+    std::vector<ManifestEntry> manifest;
+    if (!ParseManifest(options.manifestPath, manifest))
+        return 1;
+
+    const auto previous = ReadPreviousArchive(options.outputPath);
+
+    std::vector<CookedShader> cooked(manifest.size());
+    std::vector<fs::path> dependencies{ options.manifestPath };
+    std::vector<size_t> toCompile;
+
+    // 1) 해시 비교: 소스/옵션이 그대로면 기존 바이트코드 재사용
+    for (size_t i = 0; i < manifest.size(); ++i) {
+        const auto& entry = manifest[i];
+        const std::string dxcProfile = ShaderArchive::ToDxcProfile(entry.profile, shaderModel);
+
+        Hasher sourceHasher;
+        std::unordered_set<std::wstring> visited;
+        ShaderArchive::HashSourceTree(options.root / entry.path, sourceHasher, visited, &dependencies);
+
+        cooked[i].name = entry.name;
+        cooked[i].sourceHash = sourceHasher.Value();
+        cooked[i].optionsHash = ShaderArchive::HashOptions(entry.entryPoint, dxcProfile, entry.defines);
+
+        auto it = previous.find(entry.name);
+        if (it != previous.end() &&
+            it->second.sourceHash == cooked[i].sourceHash &&
+            it->second.optionsHash == cooked[i].optionsHash)
+        {
+            cooked[i].bytecode = it->second.bytecode;
+            continue;
+        }
+        toCompile.push_back(i);
+    }
+
+    // 2) 바뀐 것만 DXC 병렬 실행
+    std::vector<std::future<bool>> jobs;
+    for (size_t index : toCompile) {
+        jobs.push_back(std::async(std::launch::async, [&, index]() {
+            const auto& entry = manifest[index];
+            return CompileWithDxc(options, entry,
+                ShaderArchive::ToDxcProfile(entry.profile, shaderModel), cooked[index].bytecode);
+        }));
+    }
+
+    bool succeeded = true;
+    for (auto& job : jobs)
+        succeeded &= job.get();
+    if (!succeeded)
+        return 1;
+
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+    if (!WriteArchive(options.outputPath, shaderModel, cooked)) {
+        std::cerr << "Failed to write " << options.outputPath << "\n";
+        return 1;
+    }
+    WriteDepFile(options.outputPath, dependencies);
+
+    std::cout << "ShaderCooker: " << cooked.size() << " shaders ("
+              << toCompile.size() << " compiled, "
+              << cooked.size() - toCompile.size() << " up to date) -> "
+              << options.outputPath.string() << "\n";
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include "Lights/CubeShadowFace.h"
+#include "TestCommon.h"
+
+#include <cmath>
+#include <random>
+
+using namespace DirectX;
+
+namespace
+{
+    void TestFaceCenters()
+    {
+        // 면 방향 자체는 자기 면, up 은 방향과 직교
+        for (int face = 0; face < CubeShadowFace::FaceCount; ++face)
+        {
+            CHECK(CubeShadowFace::Select(CubeShadowFace::Directions[face]) == face);
+
+            const XMFLOAT3& direction = CubeShadowFace::Directions[face];
+            const XMFLOAT3& up = CubeShadowFace::Ups[face];
+            CHECK(direction.x * up.x + direction.y * up.y + direction.z * up.z == 0.0f);
+        }
+    }
+
+    void TestTieBreak()
+    {
+        // 경계(두 축 크기가 같음)는 x > y > z 순으로 고름 (셰이더와 동일)
+        CHECK(CubeShadowFace::Select(XMFLOAT3(1.0f, 1.0f, 0.0f)) == 0);
+        CHECK(CubeShadowFace::Select(XMFLOAT3(-2.0f, 2.0f, 2.0f)) == 1);
+        CHECK(CubeShadowFace::Select(XMFLOAT3(0.0f, -1.0f, -1.0f)) == 3);
+        CHECK(CubeShadowFace::Select(XMFLOAT3(0.5f, 0.25f, -0.5f)) == 0);
+        CHECK(CubeShadowFace::Select(XMFLOAT3(0.0f, 0.0f, -0.1f)) == 5);
+    }
+
+    void TestSelectedFaceContainsPoint()
+    {
+        const XMFLOAT3 lightPosition(3.0f, -2.0f, 10.0f);
+        const XMVECTOR lightPos = XMLoadFloat3(&lightPosition);
+        const float nearZ = 0.1f;
+        const float farZ = 50.0f;
+
+        XMMATRIX viewProjs[CubeShadowFace::FaceCount];
+        for (int face = 0; face < CubeShadowFace::FaceCount; ++face)
+            viewProjs[face] = CubeShadowFace::ComputeViewProj(face, lightPos, nearZ, farZ);
+
+        // 고른 면의 절두체 안에 점이 들어와야 PbrLighting 의 샘플이 타일 안을 읽음
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> distance(1.0f, 45.0f);
+
+        int faceHits[CubeShadowFace::FaceCount] = {};
+        for (int i = 0; i < 4000; ++i)
+        {
+            XMFLOAT3 direction(axis(random), axis(random), axis(random));
+            const float length = std::sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
+            if (length < 1e-3f)
+                continue;
+
+            const float scale = distance(random) / length;
+            const XMFLOAT3 lightToPixel(direction.x * scale, direction.y * scale, direction.z * scale);
+            const XMFLOAT3 pixel(
+                lightPosition.x + lightToPixel.x,
+                lightPosition.y + lightToPixel.y,
+                lightPosition.z + lightToPixel.z);
+
+            const int face = CubeShadowFace::Select(lightToPixel);
+            ++faceHits[face];
+
+            XMFLOAT3 ndc;
+            XMStoreFloat3(&ndc, XMVector3TransformCoord(XMLoadFloat3(&pixel), viewProjs[face]));
+            CHECK(std::fabs(ndc.x) <= 1.0f + 1e-4f);
+            CHECK(std::fabs(ndc.y) <= 1.0f + 1e-4f);
+            CHECK(ndc.z >= 0.0f && ndc.z <= 1.0f);
+        }
+
+        for (int face = 0; face < CubeShadowFace::FaceCount; ++face)
+            CHECK(faceHits[face] > 0);
+    }
+}
+
+int main()
+{
+    TestFaceCenters();
+    TestTieBreak();
+    TestSelectedFaceContainsPoint();
+    return TestCommon::Report("CubeShadowFace");
+}
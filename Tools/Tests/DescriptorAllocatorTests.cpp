@@ -0,0 +1,259 @@
+#include "DescriptorAllocator.h"
+#include "TransientDescriptorRing.h"
+#include "TestCommon.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    void TestBumpAndExhaustion()
+    {
+        DescriptorAllocator allocator;
+        allocator.Reset(8);
+
+        CHECK(allocator.Allocate(3) == 0);
+        CHECK(allocator.Allocate(4) == 3);
+        CHECK(allocator.GetStats().bumpIndex == 7);
+
+        bool threw = false;
+        try {
+            allocator.Allocate(2);
+        }
+        catch (const std::runtime_error&) {
+            threw = true;
+        }
+        CHECK(threw);
+        CHECK(allocator.Allocate(1) == 7);
+    }
+
+    void TestReleaseRollsBackBump()
+    {
+        DescriptorAllocator allocator;
+        allocator.Reset(16);
+
+        const uint32_t a = allocator.Allocate(4);
+        const uint32_t b = allocator.Allocate(4);
+
+        // 마지막 구간 해제는 free list 대신 bump 포인터를 되돌린다
+        allocator.Release(b, 4);
+        CHECK(allocator.GetStats().bumpIndex == 4);
+        CHECK(allocator.GetStats().freeRanges == 0);
+
+        allocator.Release(a, 4);
+        CHECK(allocator.GetStats().bumpIndex == 0);
+    }
+
+    void TestCoalesce()
+    {
+        DescriptorAllocator allocator;
+        allocator.Reset(32);
+
+        const uint32_t r0 = allocator.Allocate(2);     // [0, 2)
+        const uint32_t r1 = allocator.Allocate(3);     // [2, 5)
+        const uint32_t r2 = allocator.Allocate(4);     // [5, 9)
+        allocator.Allocate(1);                          // [9, 10) 는 bump 되돌리기를 막는 용도
+
+        // 1) 떨어진 구간은 따로 들어간다
+        allocator.Release(r0, 2);
+        allocator.Release(r2, 4);
+        CHECK(allocator.GetStats().freeRanges == 2);
+        CHECK(allocator.GetStats().freeDescriptors == 6);
+
+        // 2) 가운데를 해제하면 앞/뒤 구간과 하나로 병합
+        allocator.Release(r1, 3);
+        const DescriptorAllocator::Stats stats = allocator.GetStats();
+        CHECK(stats.freeRanges == 1);
+        CHECK(stats.freeDescriptors == 9);
+        CHECK(stats.bumpIndex == 10);
+
+        // 3) 병합된 구간에서 연속 9 개를 한번에 받을 수 있다
+        CHECK(allocator.Allocate(9) == 0);
+        CHECK(allocator.GetStats().freeRanges == 0);
+    }
+
+    void TestFirstFitSplit()
+    {
+        DescriptorAllocator allocator;
+        allocator.Reset(32);
+
+        const uint32_t small = allocator.Allocate(2);  // [0, 2)
+        allocator.Allocate(1);                          // [2, 3)
+        const uint32_t large = allocator.Allocate(8);  // [3, 11)
+        allocator.Allocate(1);                          // [11, 12)
+
+        allocator.Release(small, 2);
+        allocator.Release(large, 8);
+
+        // 크기가 맞지 않는 앞 구간은 건너뛰고, 맞는 구간은 앞에서부터 잘라 쓴다
+        CHECK(allocator.Allocate(5) == 3);
+        CHECK(allocator.Allocate(2) == 0);
+        CHECK(allocator.Allocate(3) == 8);
+        CHECK(allocator.GetStats().freeRanges == 0);
+        CHECK(allocator.GetStats().bumpIndex == 12);
+    }
+
+    void TestDeferredFree()
+    {
+        DescriptorAllocator allocator;
+        allocator.Reset(16);
+
+        const uint32_t a = allocator.Allocate(4);
+        allocator.Allocate(1);
+
+        allocator.Free(a, 4, 10);
+        allocator.Free(a, 0, 10);       // count 0 은 무시
+        CHECK(allocator.GetStats().pendingFrees == 1);
+
+        // 1) fence 가 지나기 전에는 재사용되지 않는다
+        allocator.ProcessDeferredFrees(9);
+        CHECK(allocator.GetStats().pendingFrees == 1);
+        CHECK(allocator.Allocate(4) == 5);
+
+        // 2) fence 완료 후 free list 로 돌아와 재사용
+        allocator.ProcessDeferredFrees(10);
+        CHECK(allocator.GetStats().pendingFrees == 0);
+        CHECK(allocator.GetStats().freeDescriptors == 4);
+        CHECK(allocator.Allocate(4) == a);
+    }
+
+    void TestDeferredFreeOrder()
+    {
+        DescriptorAllocator allocator;
+        allocator.Reset(16);
+
+        const uint32_t a = allocator.Allocate(2);
+        const uint32_t b = allocator.Allocate(2);
+        const uint32_t c = allocator.Allocate(2);
+
+        // fence 값이 섞여 들어와도 완료된 것만 골라 반환
+        allocator.Free(b, 2, 7);
+        allocator.Free(a, 2, 5);
+        allocator.Free(c, 2, 6);
+
+        allocator.ProcessDeferredFrees(6);
+        CHECK(allocator.GetStats().pendingFrees == 1);
+        CHECK(allocator.GetStats().freeRanges == 1);    // a 는 free list, c 는 bump 를 되돌림
+        CHECK(allocator.GetStats().bumpIndex == 4);
+
+        allocator.ProcessDeferredFrees(7);
+        CHECK(allocator.GetStats().pendingFrees == 0);
+        CHECK(allocator.GetStats().freeRanges == 0);
+        CHECK(allocator.GetStats().bumpIndex == 0);
+    }
+
+    template <typename Function>
+    bool Throws(Function&& function)
+    {
+        try {
+            function();
+        }
+        catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    void TestTransientFrameRanges()
+    {
+        TransientDescriptorRing ring;
+        ring.Reset(100, 256, 3);
+
+        // 1) 프레임 인덱스마다 자기 구간, 같은 스레드의 연속 요청은 이어 붙는다
+        ring.BeginFrame(0);
+        const uint32_t a = ring.Allocate(4);
+        CHECK(a == 100);
+        CHECK(ring.Allocate(4) == a + 4);
+
+        ring.BeginFrame(1);
+        CHECK(ring.Allocate(1) == 356);
+
+        // 2) 한 바퀴 돌면 같은 구간을 처음부터 (이전 커서는 버려짐)
+        ring.BeginFrame(3);
+        CHECK(ring.Allocate(2) == 100);
+        CHECK(ring.GetStats().claimed == TransientDescriptorRing::ThreadChunk);
+
+        // 3) 청크보다 큰 요청은 공유 구간에서 바로, 스레드 커서와 겹치지 않는다
+        const uint32_t large = ring.Allocate(TransientDescriptorRing::ThreadChunk + 1);
+        CHECK(large == 100 + TransientDescriptorRing::ThreadChunk);
+        CHECK(ring.Allocate(2) == 102);
+    }
+
+    void TestTransientExhaustion()
+    {
+        TransientDescriptorRing ring;
+        ring.Reset(0, 100, 2);
+        ring.BeginFrame(0);
+
+        // 첫 청크 64 + 두 번째 청크는 구간 끝(100)에서 잘린다
+        for (int i = 0; i < 16; ++i)
+            ring.Allocate(4);
+        CHECK(ring.Allocate(4) == 64);
+        for (int i = 0; i < 8; ++i)
+            ring.Allocate(4);
+        CHECK(Throws([&] { ring.Allocate(1); }));
+        CHECK(Throws([&] { ring.Allocate(TransientDescriptorRing::ThreadChunk + 1); }));
+
+        // 다음 프레임 구간은 영향 없음
+        ring.BeginFrame(1);
+        CHECK(ring.Allocate(1) == 100);
+    }
+
+    void TestTransientThreads()
+    {
+        constexpr uint32_t threadCount = 8;
+        constexpr uint32_t allocationsPerThread = 2000;
+        constexpr uint32_t perFrame = threadCount * allocationsPerThread * 4 + threadCount * TransientDescriptorRing::ThreadChunk;
+
+        TransientDescriptorRing ring;
+        ring.Reset(1000, perFrame, 2);
+        ring.BeginFrame(1);
+
+        // 스레드마다 받은 [begin, end) 구간을 모아 겹침 / 범위 검사
+        std::vector<std::vector<std::pair<uint32_t, uint32_t>>> ranges(threadCount);
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t] {
+                for (uint32_t i = 0; i < allocationsPerThread; ++i)
+                {
+                    const uint32_t count = 1 + (i + t) % 4;
+                    const uint32_t index = ring.Allocate(count);
+                    ranges[t].emplace_back(index, index + count);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+
+        std::vector<std::pair<uint32_t, uint32_t>> all;
+        for (const auto& threadRanges : ranges)
+            all.insert(all.end(), threadRanges.begin(), threadRanges.end());
+        std::sort(all.begin(), all.end());
+
+        CHECK(all.size() == threadCount * allocationsPerThread);
+        CHECK(all.front().first >= 1000 + perFrame);
+        CHECK(all.back().second <= 1000 + perFrame * 2);
+        uint32_t overlaps = 0;
+        for (size_t i = 1; i < all.size(); ++i)
+            overlaps += all[i].first < all[i - 1].second;
+        CHECK(overlaps == 0);
+    }
+}
+
+int main()
+{
+    TestBumpAndExhaustion();
+    TestReleaseRollsBackBump();
+    TestCoalesce();
+    TestFirstFitSplit();
+    TestDeferredFree();
+    TestDeferredFreeOrder();
+    TestTransientFrameRanges();
+    TestTransientExhaustion();
+    TestTransientThreads();
+    return TestCommon::Report("DescriptorAllocator");
+}
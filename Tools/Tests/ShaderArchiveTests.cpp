@@ -0,0 +1,49 @@
+#include "ShaderArchive.h"
+#include "TestCommon.h"
+
+namespace
+{
+    void TestParseShaderModel()
+    {
+        CHECK(ShaderArchive::ParseShaderModel("6_0") == 0x60);
+        CHECK(ShaderArchive::ParseShaderModel("5_1") == 0x51);
+        CHECK(ShaderArchive::ParseShaderModel("6_6") == 0x66);
+        CHECK(ShaderArchive::ParseShaderModel("6") == 0);
+        CHECK(ShaderArchive::ParseShaderModel("6.0") == 0);
+        CHECK(ShaderArchive::ParseShaderModel("x_0") == 0);
+    }
+
+    void TestToDxcProfile()
+    {
+        // FXC 프로필은 최소 SM 으로 올리고, 이미 높은 프로필은 그대로
+        CHECK(ShaderArchive::ToDxcProfile("vs_5_0", 0x60) == "vs_6_0");
+        CHECK(ShaderArchive::ToDxcProfile("ps_5_1", 0x62) == "ps_6_2");
+        CHECK(ShaderArchive::ToDxcProfile("ps_6_5", 0x60) == "ps_6_5");
+        CHECK(ShaderArchive::ToDxcProfile("lib_6_3", 0x60) == "lib_6_3");
+    }
+
+    void TestHashOptions()
+    {
+        using ShaderArchive::HashOptions;
+        const std::vector<std::string> defines = { "BINDLESS_MATERIALS=1", "MATERIAL_FEATURES=3" };
+        const uint64_t reference = HashOptions("PSMain", "ps_6_0", defines);
+
+        CHECK(HashOptions("PSMain", "ps_6_0", defines) == reference);
+
+        // entry / profile / define 값 / define 순서 / 최적화 옵션이 바뀌면 다른 해시
+        CHECK(HashOptions("VSMain", "ps_6_0", defines) != reference);
+        CHECK(HashOptions("PSMain", "ps_6_1", defines) != reference);
+        CHECK(HashOptions("PSMain", "ps_6_0", { "BINDLESS_MATERIALS=1", "MATERIAL_FEATURES=4" }) != reference);
+        CHECK(HashOptions("PSMain", "ps_6_0", { "MATERIAL_FEATURES=3", "BINDLESS_MATERIALS=1" }) != reference);
+        CHECK(HashOptions("PSMain", "ps_6_0", { "BINDLESS_MATERIALS=1" }) != reference);
+        CHECK(HashOptions("PSMain", "ps_6_0", defines, "flags=0x0") != reference);
+    }
+}
+
+int main()
+{
+    TestParseShaderModel();
+    TestToDxcProfile();
+    TestHashOptions();
+    return TestCommon::Report("ShaderArchive");
+}
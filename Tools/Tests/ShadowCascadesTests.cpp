@@ -0,0 +1,192 @@
+#include "ShadowCascades.h"
+#include "TestCommon.h"
+
+#include <cmath>
+
+namespace
+{
+    constexpr uint32_t kCascadeCount = 4;
+
+    XMFLOAT3 ProjectToNdc(const XMMATRIX& viewProj, const XMFLOAT3& point)
+    {
+        XMFLOAT3 ndc;
+        XMStoreFloat3(&ndc, XMVector3TransformCoord(XMLoadFloat3(&point), viewProj));
+        return ndc;
+    }
+
+    // 텍셀 좌표의 소수부 차이 (0 또는 1 근처면 같은 격자 위치)
+    float FractionDelta(float a, float b)
+    {
+        const float delta = (a - std::floor(a)) - (b - std::floor(b));
+        return std::fabs(delta - std::round(delta));
+    }
+
+    void TestSplitDistances()
+    {
+        const float nearZ = 0.1f;
+        const float farZ = 200.0f;
+        float uniform[kCascadeCount + 1];
+        float logarithmic[kCascadeCount + 1];
+        float blended[kCascadeCount + 1];
+
+        ShadowCascades::ComputeSplitDistances(nearZ, farZ, kCascadeCount, 0.0f, uniform);
+        ShadowCascades::ComputeSplitDistances(nearZ, farZ, kCascadeCount, 1.0f, logarithmic);
+        ShadowCascades::ComputeSplitDistances(nearZ, farZ, kCascadeCount, 0.75f, blended);
+
+        // 1) 양 끝은 정확히 near / far
+        CHECK(uniform[0] == nearZ && uniform[kCascadeCount] == farZ);
+        CHECK(logarithmic[0] == nearZ && logarithmic[kCascadeCount] == farZ);
+        CHECK(blended[0] == nearZ && blended[kCascadeCount] == farZ);
+
+        for (uint32_t i = 1; i < kCascadeCount; ++i)
+        {
+            const float p = static_cast<float>(i) / kCascadeCount;
+
+            // 2) lambda 0 / 1 은 각각 uniform / log 분할
+            CHECK_NEAR(uniform[i], nearZ + (farZ - nearZ) * p, 1e-3);
+            CHECK_NEAR(logarithmic[i], nearZ * std::pow(farZ / nearZ, p), 1e-3);
+
+            // 3) 블렌드는 선형 보간이고 두 분할 사이에 있다
+            CHECK_NEAR(blended[i], 0.75f * logarithmic[i] + 0.25f * uniform[i], 1e-3);
+            CHECK(blended[i] >= logarithmic[i] && blended[i] <= uniform[i]);
+        }
+
+        // 4) 단조 증가
+        for (uint32_t i = 0; i < kCascadeCount; ++i)
+        {
+            CHECK(uniform[i] < uniform[i + 1]);
+            CHECK(logarithmic[i] < logarithmic[i + 1]);
+            CHECK(blended[i] < blended[i + 1]);
+        }
+    }
+
+    void TestSliceSphereContainsCorners()
+    {
+        struct Slice { float fovY; float aspect; float sliceNear; float sliceFar; };
+        const Slice slices[] = {
+            { XM_PIDIV4, 16.0f / 9.0f, 0.1f, 5.0f },       // 얇은 near 슬라이스 (중심이 far 평면 위)
+            { XM_PIDIV4, 16.0f / 9.0f, 50.0f, 200.0f },    // 깊은 far 슬라이스 (중심이 중간)
+            { XM_PIDIV2, 1.0f, 1.0f, 2.0f },
+            { 0.3f, 2.35f, 10.0f, 400.0f },
+        };
+
+        for (const Slice& slice : slices)
+        {
+            const BoundingSphere sphere = ShadowCascades::ComputeSliceBoundingSphere(
+                slice.fovY, slice.aspect, slice.sliceNear, slice.sliceFar);
+
+            // 중심은 뷰 축 위, 슬라이스 구간 안
+            CHECK(sphere.Center.x == 0.0f && sphere.Center.y == 0.0f);
+            CHECK(sphere.Center.z >= slice.sliceNear && sphere.Center.z <= slice.sliceFar);
+
+            const float tanY = std::tan(slice.fovY * 0.5f);
+            const float tanX = tanY * slice.aspect;
+            const float epsilon = sphere.Radius * 1e-4f;
+
+            float farthest = 0.0f;
+            for (float z : { slice.sliceNear, slice.sliceFar })
+            {
+                for (float sx : { -1.0f, 1.0f })
+                {
+                    for (float sy : { -1.0f, 1.0f })
+                    {
+                        const float dx = sx * tanX * z;
+                        const float dy = sy * tanY * z;
+                        const float dz = z - sphere.Center.z;
+                        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+                        CHECK(distance <= sphere.Radius + epsilon);
+                        farthest = std::max(farthest, distance);
+                    }
+                }
+            }
+
+            // 최소 구이므로 가장 먼 모서리가 구 표면에 닿는다
+            CHECK_NEAR(farthest, sphere.Radius, epsilon);
+        }
+    }
+
+    void TestCascadeCoversSphere()
+    {
+        const BoundingSphere sphere(XMFLOAT3(12.0f, 3.0f, -40.0f), 25.0f);
+        const XMVECTOR lightDirection = XMVector3Normalize(XMVectorSet(0.3f, -1.0f, 0.45f, 0.0f));
+        const XMMATRIX viewProj = ShadowCascades::ComputeCascadeViewProj(sphere, lightDirection, 2048, 0.0f);
+
+        // 구 표면의 축 방향 점들이 모두 ortho 범위(x, y ∈ [-1, 1], z ∈ [0, 1]) 안에 들어온다
+        const float offsets[6][3] = {
+            { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+        };
+        for (const auto& offset : offsets)
+        {
+            const XMFLOAT3 point(
+                sphere.Center.x + offset[0] * sphere.Radius,
+                sphere.Center.y + offset[1] * sphere.Radius,
+                sphere.Center.z + offset[2] * sphere.Radius);
+            const XMFLOAT3 ndc = ProjectToNdc(viewProj, point);
+            CHECK(ndc.x >= -1.0f && ndc.x <= 1.0f);
+            CHECK(ndc.y >= -1.0f && ndc.y <= 1.0f);
+            CHECK(ndc.z >= -1e-4f && ndc.z <= 1.0f + 1e-4f);
+        }
+    }
+
+    void TestTexelSnapStable()
+    {
+        constexpr uint32_t resolution = 2048;
+        const XMVECTOR lightDirection = XMVector3Normalize(XMVectorSet(-0.4f, -1.0f, 0.2f, 0.0f));
+        const XMFLOAT3 probe(3.0f, 1.0f, 7.0f);
+
+        // 반지름은 1/16 양자화 구간(30.0625) 안에서만 흔든다
+        const BoundingSphere base(XMFLOAT3(10.0f, 2.0f, 20.0f), 30.01f);
+        const XMMATRIX baseViewProj = ShadowCascades::ComputeCascadeViewProj(base, lightDirection, resolution, 10.0f);
+        const XMFLOAT3 baseNdc = ProjectToNdc(baseViewProj, probe);
+        const float baseTexelX = (baseNdc.x * 0.5f + 0.5f) * resolution;
+        const float baseTexelY = (baseNdc.y * 0.5f + 0.5f) * resolution;
+
+        // 카메라가 조금씩 움직여 구 중심/반지름이 흔들려도
+        //   1) 반지름 양자화 덕분에 텍셀 크기가 그대로이고
+        //   2) 중심 스냅 덕분에 고정된 월드 점은 항상 같은 텍셀 소수부에 떨어진다
+        const float jitters[] = { 0.003f, 0.011f, 0.05f, 0.37f, 1.9f };
+        for (float jitter : jitters)
+        {
+            const BoundingSphere moved(
+                XMFLOAT3(base.Center.x + jitter, base.Center.y - jitter * 0.5f, base.Center.z + jitter * 0.25f),
+                base.Radius + 0.01f);
+            const XMMATRIX viewProj = ShadowCascades::ComputeCascadeViewProj(moved, lightDirection, resolution, 10.0f);
+            const XMFLOAT3 ndc = ProjectToNdc(viewProj, probe);
+            const float texelX = (ndc.x * 0.5f + 0.5f) * resolution;
+            const float texelY = (ndc.y * 0.5f + 0.5f) * resolution;
+
+            CHECK_NEAR(FractionDelta(texelX, baseTexelX), 0.0, 1e-2);
+            CHECK_NEAR(FractionDelta(texelY, baseTexelY), 0.0, 1e-2);
+        }
+    }
+
+    void TestIntersects()
+    {
+        const BoundingSphere cascade(XMFLOAT3(0.0f, 0.0f, 0.0f), 10.0f);
+        const XMVECTOR lightDirection = XMVectorSet(0.0f, -1.0f, 0.0f, 0.0f);
+        const XMMATRIX viewProj = ShadowCascades::ComputeCascadeViewProj(cascade, lightDirection, 1024, 50.0f);
+
+        // 1) 안쪽 / 경계 걸침 / 완전히 바깥
+        CHECK(ShadowCascades::Intersects(viewProj, BoundingSphere(XMFLOAT3(2.0f, 0.0f, -3.0f), 1.0f)));
+        CHECK(ShadowCascades::Intersects(viewProj, BoundingSphere(XMFLOAT3(10.5f, 0.0f, 0.0f), 1.0f)));
+        CHECK(!ShadowCascades::Intersects(viewProj, BoundingSphere(XMFLOAT3(30.0f, 0.0f, 0.0f), 1.0f)));
+        CHECK(!ShadowCascades::Intersects(viewProj, BoundingSphere(XMFLOAT3(0.0f, 0.0f, -25.0f), 2.0f)));
+
+        // 2) 라이트 쪽(위)으로 casterExtension 안에 있는 캐스터는 포함, 그 밖은 제외
+        CHECK(ShadowCascades::Intersects(viewProj, BoundingSphere(XMFLOAT3(0.0f, 40.0f, 0.0f), 1.0f)));
+        CHECK(!ShadowCascades::Intersects(viewProj, BoundingSphere(XMFLOAT3(0.0f, 80.0f, 0.0f), 1.0f)));
+
+        // 3) 라이트 반대편(아래)은 구 반지름까지만
+        CHECK(!ShadowCascades::Intersects(viewProj, BoundingSphere(XMFLOAT3(0.0f, -15.0f, 0.0f), 1.0f)));
+    }
+}
+
+int main()
+{
+    TestSplitDistances();
+    TestSliceSphereContainsCorners();
+    TestCascadeCoversSphere();
+    TestTexelSnapStable();
+    TestIntersects();
+    return TestCommon::Report("ShadowCascades");
+}
@@ -0,0 +1,189 @@
+#include "TangentGenerator.h"
+#include "MeshVertex.h"
+#include "ThreadPool.h"
+#include "TestCommon.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace DirectX;
+
+namespace
+{
+    // 기존 ModelLoader::ComputeTangents 그대로 (정점 타입만 MeshVertex 로 바꿈)
+    void ReferenceComputeTangents(std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices)
+    {
+        const float kEpsilon = 1e-6f;
+        std::vector<XMFLOAT3> accum(vertices.size(), XMFLOAT3(0.0f, 0.0f, 0.0f));
+
+        for (size_t f = 0; f + 2 < indices.size(); f += 3) {
+            const uint32_t i0 = indices[f + 0];
+            const uint32_t i1 = indices[f + 1];
+            const uint32_t i2 = indices[f + 2];
+
+            const XMFLOAT3& p0 = vertices[i0].position;
+            const XMFLOAT3& p1 = vertices[i1].position;
+            const XMFLOAT3& p2 = vertices[i2].position;
+
+            const XMFLOAT2& uv0 = vertices[i0].texCoord;
+            const XMFLOAT2& uv1 = vertices[i1].texCoord;
+            const XMFLOAT2& uv2 = vertices[i2].texCoord;
+
+            const XMVECTOR dp1 = XMLoadFloat3(&p1) - XMLoadFloat3(&p0);
+            const XMVECTOR dp2 = XMLoadFloat3(&p2) - XMLoadFloat3(&p0);
+
+            const float du1 = uv1.x - uv0.x;
+            const float dv1 = uv1.y - uv0.y;
+            const float du2 = uv2.x - uv0.x;
+            const float dv2 = uv2.y - uv0.y;
+
+            float denom = du1 * dv2 - dv1 * du2;
+            if (fabsf(denom) < kEpsilon) denom = kEpsilon;
+            const float inv = 1.0f / denom;
+
+            const XMVECTOR tangentVec = (dp1 * dv2 - dp2 * dv1) * inv;
+            XMFLOAT3 tangent;
+            XMStoreFloat3(&tangent, tangentVec);
+
+            for (uint32_t i : { i0, i1, i2 }) {
+                accum[i].x += tangent.x;
+                accum[i].y += tangent.y;
+                accum[i].z += tangent.z;
+            }
+        }
+
+        for (size_t i = 0; i < vertices.size(); ++i)
+            XMStoreFloat3(&vertices[i].tangent, XMVector3Normalize(XMLoadFloat3(&accum[i])));
+    }
+
+    struct TestMesh
+    {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // 물결 높이 + 비균일 UV 의 격자 (정점 공유, 병렬 경로가 돌도록 삼각형 4096 * 쓰레드 수 이상)
+    // 일부 셀은 UV 를 겹쳐 퇴화 면(denom < epsilon)도 포함
+    TestMesh BuildGrid(uint32_t cells)
+    {
+        TestMesh mesh;
+        const uint32_t side = cells + 1;
+        mesh.vertices.resize(side * side);
+
+        for (uint32_t z = 0; z < side; ++z) {
+            for (uint32_t x = 0; x < side; ++x) {
+                const float fx = float(x) / cells;
+                const float fz = float(z) / cells;
+                const float height = 0.3f * std::sin(fx * 17.0f) * std::cos(fz * 11.0f);
+
+                // 해석적 노멀: (-dh/dx, 1, -dh/dz) 정규화
+                const float dhdx = 0.3f * 17.0f * std::cos(fx * 17.0f) * std::cos(fz * 11.0f) / cells;
+                const float dhdz = -0.3f * 11.0f * std::sin(fx * 17.0f) * std::sin(fz * 11.0f) / cells;
+                const float length = std::sqrt(dhdx * dhdx + 1.0f + dhdz * dhdz);
+
+                MeshVertex& v = mesh.vertices[z * side + x];
+                v.position = XMFLOAT3(float(x), height, float(z));
+                v.normal = XMFLOAT3(-dhdx / length, 1.0f / length, -dhdz / length);
+                v.texCoord = XMFLOAT2(fx * fx * 3.0f + 0.1f * std::sin(fz * 23.0f), fz * 2.0f);
+                if (x % 37 == 5 && z % 29 == 7)
+                    v.texCoord = mesh.vertices[z * side + x - 1].texCoord;
+                v.tangent = XMFLOAT3(0.0f, 0.0f, 0.0f);
+            }
+        }
+
+        for (uint32_t z = 0; z < cells; ++z) {
+            for (uint32_t x = 0; x < cells; ++x) {
+                const uint32_t i0 = z * side + x;
+                const uint32_t i1 = i0 + 1;
+                const uint32_t i2 = i0 + side;
+                const uint32_t i3 = i2 + 1;
+                mesh.indices.insert(mesh.indices.end(), { i0, i2, i1, i1, i2, i3 });
+            }
+        }
+        return mesh;
+    }
+
+    void TestSerialLegacyBitIdentical()
+    {
+        TestMesh reference = BuildGrid(160);
+        TestMesh generated = reference;
+
+        ReferenceComputeTangents(reference.vertices, reference.indices);
+        TangentGenerator::Generate(generated.vertices.data(), generated.vertices.size(),
+            generated.indices.data(), generated.indices.size(), TangentGenerator::Mode::Legacy);
+
+        // 작업 하나면 합산 순서가 같으므로 비트 단위로 같아야 함
+        size_t mismatches = 0;
+        for (size_t i = 0; i < reference.vertices.size(); ++i) {
+            if (std::memcmp(&reference.vertices[i].tangent, &generated.vertices[i].tangent, sizeof(XMFLOAT3)) != 0)
+                ++mismatches;
+        }
+        std::printf("  serial legacy mismatches: %zu / %zu\n", mismatches, reference.vertices.size());
+        CHECK(mismatches == 0);
+    }
+
+    void TestParallelLegacyWithinEpsilon()
+    {
+        TestMesh reference = BuildGrid(160);
+        TestMesh generated = reference;
+
+        ThreadPool threadPool(4);
+        ReferenceComputeTangents(reference.vertices, reference.indices);
+        TangentGenerator::Generate(generated.vertices.data(), generated.vertices.size(),
+            generated.indices.data(), generated.indices.size(), TangentGenerator::Mode::Legacy, &threadPool);
+
+        // 작업별 부분합을 더하는 순서만 달라지므로 정규화 후 float 반올림 수준 차이
+        float maxError = 0.0f;
+        for (size_t i = 0; i < reference.vertices.size(); ++i) {
+            const XMFLOAT3& a = reference.vertices[i].tangent;
+            const XMFLOAT3& b = generated.vertices[i].tangent;
+            maxError = std::max({ maxError, std::fabs(a.x - b.x), std::fabs(a.y - b.y), std::fabs(a.z - b.z) });
+        }
+        std::printf("  parallel legacy max error: %g\n", maxError);
+        CHECK(maxError <= 1e-5f);
+    }
+
+    void TestMikkTSpaceOrthonormal()
+    {
+        TestMesh mesh = BuildGrid(160);
+
+        ThreadPool threadPool(4);
+        TangentGenerator::Generate(mesh.vertices.data(), mesh.vertices.size(),
+            mesh.indices.data(), mesh.indices.size(), TangentGenerator::Mode::MikkTSpace, &threadPool);
+
+        // 모든 정점 탄젠트는 단위 길이이고 정점 노멀과 직교
+        double maxLengthError = 0.0;
+        double maxDot = 0.0;
+        for (const MeshVertex& v : mesh.vertices) {
+            const XMFLOAT3& t = v.tangent;
+            const XMFLOAT3& n = v.normal;
+            const double length = std::sqrt(double(t.x) * t.x + double(t.y) * t.y + double(t.z) * t.z);
+            const double dot = double(t.x) * n.x + double(t.y) * n.y + double(t.z) * n.z;
+            maxLengthError = std::max(maxLengthError, std::fabs(length - 1.0));
+            maxDot = std::max(maxDot, std::fabs(dot));
+        }
+        std::printf("  mikktspace max |len - 1|: %g, max |t . n|: %g\n", maxLengthError, maxDot);
+        CHECK(maxLengthError <= 1e-5);
+        CHECK(maxDot <= 1e-4);
+
+        // 노멀 하나만 있는 고립 정점 (참조하는 삼각형 없음) 도 직교 탄젠트를 받는다
+        MeshVertex lone[4] = {};
+        lone[0].position = XMFLOAT3(0, 0, 0); lone[1].position = XMFLOAT3(1, 0, 0); lone[2].position = XMFLOAT3(0, 0, 1);
+        lone[1].texCoord = XMFLOAT2(1, 0); lone[2].texCoord = XMFLOAT2(0, 1);
+        for (MeshVertex& v : lone) v.normal = XMFLOAT3(1.0f, 0.0f, 0.0f);
+        const uint32_t triangle[3] = { 0, 2, 1 };
+        TangentGenerator::Generate(lone, 4, triangle, 3, TangentGenerator::Mode::MikkTSpace);
+        const XMFLOAT3& t = lone[3].tangent;
+        CHECK_NEAR(t.x * t.x + t.y * t.y + t.z * t.z, 1.0, 1e-5);
+        CHECK_NEAR(t.x, 0.0, 1e-6);
+    }
+}
+
+int main()
+{
+    TestSerialLegacyBitIdentical();
+    TestParallelLegacyWithinEpsilon();
+    TestMikkTSpaceOrthonormal();
+    return TestCommon::Report("TangentGenerator");
+}
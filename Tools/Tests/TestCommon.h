@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+
+// ---------------------------------------------------------------------------
+// 최소 테스트 매크로 (외부 프레임워크 없이 ctest 가 종료 코드로 판정)
+//   CHECK 가 실패해도 계속 진행하고, main 은 Report() 의 결과를 돌려준다
+// ---------------------------------------------------------------------------
+namespace TestCommon
+{
+    inline int failures = 0;
+    inline int checks = 0;
+
+    inline int Report(const char* suite)
+    {
+        std::printf("[%s] %d checks, %d failed\n", suite, checks, failures);
+        return failures == 0 ? 0 : 1;
+    }
+}
+
+#define CHECK(condition)                                                                    \
+    do {                                                                                    \
+        ++TestCommon::checks;                                                               \
+        if (!(condition)) {                                                                 \
+            ++TestCommon::failures;                                                         \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+        }                                                                                   \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, epsilon)                                               \
+    do {                                                                                    \
+        ++TestCommon::checks;                                                               \
+        const double checkActual = static_cast<double>(actual);                             \
+        const double checkExpected = static_cast<double>(expected);                         \
+        if (!(std::fabs(checkActual - checkExpected) <= static_cast<double>(epsilon))) {    \
+            ++TestCommon::failures;                                                         \
+            std::fprintf(stderr, "%s:%d: CHECK_NEAR(%s, %s) failed: %g vs %g (eps %g)\n",   \
+                __FILE__, __LINE__, #actual, #expected, checkActual, checkExpected,         \
+                static_cast<double>(epsilon));                                              \
+        }                                                                                   \
+    } while (0)
@@ -0,0 +1,137 @@
+#include "TextureResidency.h"
+#include "TestCommon.h"
+
+#include <cmath>
+#include <limits>
+
+using TextureResidency::TextureState;
+
+namespace
+{
+    // 밉 5개, tail = 밉 3 (3, 4 를 합쳐 2 바이트)
+    //   ResidentBytes: 밉 0 = 86, 밉 1 = 22, 밉 2 = 6, 밉 3 = 2
+    TextureState MakeState(uint32_t residentMip, uint32_t wantedMip, float priority)
+    {
+        TextureState state;
+        state.mipCount = 5;
+        state.tailMip = 3;
+        state.mipBytes[0] = 64;
+        state.mipBytes[1] = 16;
+        state.mipBytes[2] = 4;
+        state.mipBytes[3] = 2;
+        state.residentMip = residentMip;
+        state.wantedMip = wantedMip;
+        state.priority = priority;
+        return state;
+    }
+
+    constexpr uint64_t kUnlimited = std::numeric_limits<uint64_t>::max();
+
+    void TestTexelDensity()
+    {
+        CHECK(TextureResidency::MipForTexelDensity(0.5f, 10) == 0);
+        CHECK(TextureResidency::MipForTexelDensity(1.0f, 10) == 0);
+        CHECK(TextureResidency::MipForTexelDensity(2.0f, 10) == 1);
+        CHECK(TextureResidency::MipForTexelDensity(3.9f, 10) == 1);
+        CHECK(TextureResidency::MipForTexelDensity(4.0f, 10) == 2);
+        CHECK(TextureResidency::MipForTexelDensity(1e9f, 10) == 9);
+        CHECK(TextureResidency::MipForTexelDensity(std::nanf(""), 10) == 0);
+
+        // 1024 텍셀이 화면 512 픽셀에 걸치면 2 텍셀 / 픽셀, 화면 크기 0 이면 가장 거친 밉
+        CHECK_NEAR(TextureResidency::TexelsPerPixel(1024, 2.0f, 256.0f), 2.0, 1e-6);
+        CHECK(TextureResidency::TexelsPerPixel(1024, 0.0f, 256.0f) == std::numeric_limits<float>::max());
+
+        CHECK(TextureResidency::ResidentBytes(MakeState(0, 0, 0.0f), 0) == 86);
+        CHECK(TextureResidency::ResidentBytes(MakeState(0, 0, 0.0f), 3) == 2);
+    }
+
+    void TestLoadsOneMipByPriority()
+    {
+        const std::vector<TextureState> textures = {
+            MakeState(3, 0, 10.0f),
+            MakeState(3, 0, 20.0f),
+        };
+
+        // 1) maxLoads 개까지, priority 높은 텍스쳐부터 한 밉씩
+        const TextureResidency::Plan single = TextureResidency::BuildPlan(textures, kUnlimited, 1);
+        CHECK(single.evictions.empty());
+        CHECK(single.loads.size() == 1);
+        CHECK(single.loads[0].texture == 1 && single.loads[0].mip == 2);
+        CHECK(single.targetBytes == 172);
+
+        const TextureResidency::Plan both = TextureResidency::BuildPlan(textures, kUnlimited, 2);
+        CHECK(both.loads.size() == 2);
+        CHECK(both.loads[0].texture == 1 && both.loads[1].texture == 0);
+        CHECK(both.loads[1].mip == 2);
+
+        // 2) 이미 목표에 있거나 tail 보다 거친 밉을 원하면 아무것도 안 함
+        const TextureResidency::Plan idle = TextureResidency::BuildPlan({ MakeState(3, 4, 1.0f), MakeState(1, 1, 1.0f) }, kUnlimited, 4);
+        CHECK(idle.loads.empty() && idle.evictions.empty());
+    }
+
+    void TestEvictionHysteresis()
+    {
+        // 필요보다 한 단계 상세한 밉은 남겨 두고, 그보다 더 상세한 밉만 내림
+        const TextureResidency::Plan plan = TextureResidency::BuildPlan({
+            MakeState(1, 2, 1.0f),      // 한 단계 차이: 유지
+            MakeState(0, 2, 1.0f),      // 두 단계: 밉 1 까지
+            MakeState(0, 3, 1.0f),      // 세 단계: 밉 2 까지
+        }, kUnlimited, 4);
+
+        CHECK(plan.loads.empty());
+        CHECK(plan.evictions.size() == 2);
+        CHECK(plan.evictions[0].texture == 1 && plan.evictions[0].mip == 1);
+        CHECK(plan.evictions[1].texture == 2 && plan.evictions[1].mip == 2);
+    }
+
+    void TestBudgetEvictsLowPriorityFirst()
+    {
+        const std::vector<TextureState> textures = {
+            MakeState(0, 0, 1.0f),
+            MakeState(0, 0, 100.0f),
+        };
+
+        // 1) 86 + 22 = 108: priority 낮은 0 번만 밉 1 까지 내림
+        const TextureResidency::Plan plan = TextureResidency::BuildPlan(textures, 108, 4);
+        CHECK(plan.evictions.size() == 1);
+        CHECK(plan.evictions[0].texture == 0 && plan.evictions[0].mip == 1);
+        CHECK(plan.targetBytes == 108);
+
+        // 2) 예산이 tail 합보다 작아도 tail 아래로는 내리지 않음
+        const TextureResidency::Plan starved = TextureResidency::BuildPlan(textures, 1, 4);
+        CHECK(starved.evictions.size() == 2);
+        CHECK(starved.evictions[0].mip == 3 && starved.evictions[1].mip == 3);
+        CHECK(starved.targetBytes == 4);
+        CHECK(starved.loads.empty());
+    }
+
+    void TestLoadsRespectBudget()
+    {
+        // 예산 6: 목표가 밉 2 로 깎이고 밉 2 (4 바이트) 는 올릴 수 있음
+        const TextureResidency::Plan fits = TextureResidency::BuildPlan({ MakeState(3, 0, 1.0f) }, 6, 4);
+        CHECK(fits.loads.size() == 1 && fits.loads[0].mip == 2);
+        CHECK(fits.targetBytes == 6);
+
+        // 예산 5: 목표가 tail 이라 올리지 않음
+        const TextureResidency::Plan tight = TextureResidency::BuildPlan({ MakeState(3, 0, 1.0f) }, 5, 4);
+        CHECK(tight.loads.empty() && tight.evictions.empty());
+
+        // 내리기로 확보한 예산은 같은 프레임의 올리기에 쓸 수 있음
+        const TextureResidency::Plan swap = TextureResidency::BuildPlan({
+            MakeState(0, 3, 1.0f),      // 보이지 않음: 밉 2 까지 내려 86 → 6
+            MakeState(3, 2, 50.0f),     // 밉 2 필요
+        }, 12, 4);
+        CHECK(swap.evictions.size() == 1 && swap.evictions[0].texture == 0 && swap.evictions[0].mip == 2);
+        CHECK(swap.loads.size() == 1 && swap.loads[0].texture == 1 && swap.loads[0].mip == 2);
+    }
+}
+
+int main()
+{
+    TestTexelDensity();
+    TestLoadsOneMipByPriority();
+    TestEvictionHysteresis();
+    TestBudgetEvictsLowPriorityFirst();
+    TestLoadsRespectBudget();
+    return TestCommon::Report("TextureResidency");
+}
@@ -0,0 +1,160 @@
+#include "VertexCompression.h"
+#include "TestCommon.h"
+
+#include <cmath>
+#include <random>
+
+using namespace DirectX;
+
+namespace
+{
+    // 16 비트 octahedral 의 최대 각도 오차 (실측 약 0.004 도, 여유를 두고 0.01 도)
+    constexpr double MaxOctAngleErrorDegrees = 0.01;
+
+    // acos 는 1 근처에서 float 정규화 오차를 크게 키우므로 atan2(|a x b|, a . b)
+    double AngleDegrees(const XMFLOAT3& a, const XMFLOAT3& b)
+    {
+        const double cx = double(a.y) * b.z - double(a.z) * b.y;
+        const double cy = double(a.z) * b.x - double(a.x) * b.z;
+        const double cz = double(a.x) * b.y - double(a.y) * b.x;
+        const double dot = double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z;
+        return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), dot) * 180.0 / 3.14159265358979323846;
+    }
+
+    XMFLOAT3 Normalize(const XMFLOAT3& v)
+    {
+        const float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+        return { v.x / length, v.y / length, v.z / length };
+    }
+
+    XMFLOAT3 OctRoundTrip(const XMFLOAT3& n)
+    {
+        int16_t encoded[2];
+        VertexCompression::OctEncode(n, encoded);
+        return VertexCompression::OctDecode(encoded);
+    }
+
+    void TestOctahedralSpecialDirections()
+    {
+        // 축, 대각선, 접히는 아래 반구의 경계
+        const XMFLOAT3 directions[] = {
+            { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+            { 1, 1, 1 }, { -1, 1, -1 }, { 1, -1, -1 }, { -1, -1, -1 },
+            { 1, 0, -1 }, { 0, -1, -1 }, { 1, 1, 0 }, { -1, 0, 1e-6f },
+        };
+
+        for (const XMFLOAT3& direction : directions)
+        {
+            const XMFLOAT3 n = Normalize(direction);
+            const XMFLOAT3 decoded = OctRoundTrip(n);
+            CHECK(AngleDegrees(n, decoded) <= MaxOctAngleErrorDegrees);
+            CHECK_NEAR(decoded.x * decoded.x + decoded.y * decoded.y + decoded.z * decoded.z, 1.0, 1e-5);
+        }
+
+        // 길이 0 벡터는 인코딩이 (0, 0) → +Z 로 디코드
+        int16_t encoded[2];
+        VertexCompression::OctEncode(XMFLOAT3(0.0f, 0.0f, 0.0f), encoded);
+        CHECK(encoded[0] == 0 && encoded[1] == 0);
+    }
+
+    void TestOctahedralAngleBound()
+    {
+        std::mt19937 random(42);
+        std::normal_distribution<float> gaussian(0.0f, 1.0f);
+
+        double maxError = 0.0;
+        for (int i = 0; i < 200000; ++i)
+        {
+            const XMFLOAT3 direction(gaussian(random), gaussian(random), gaussian(random));
+            if (direction.x * direction.x + direction.y * direction.y + direction.z * direction.z < 1e-8f)
+                continue;
+
+            const XMFLOAT3 n = Normalize(direction);
+            maxError = std::max(maxError, AngleDegrees(n, OctRoundTrip(n)));
+        }
+
+        std::printf("  octahedral max angle error: %.5f deg\n", maxError);
+        CHECK(maxError <= MaxOctAngleErrorDegrees);
+    }
+
+    void TestPositionErrorBound()
+    {
+        // 한 축은 두께 0 (평면 메시)
+        const XMFLOAT3 boundsMin(-12.5f, 3.0f, -0.25f);
+        const XMFLOAT3 boundsMax(40.0f, 3.0f, 0.75f);
+        const VertexCompression::PositionQuantization quantization =
+            VertexCompression::ComputePositionQuantization(boundsMin, boundsMax);
+
+        CHECK(quantization.scale.y == 1.0f);
+
+        // 축마다 반 스텝 (scale / 65535 / 2) + float 반올림 여유
+        const float tolerance[3] = {
+            quantization.scale.x / 65535.0f * 0.5f + 1e-5f,
+            1e-5f,
+            quantization.scale.z / 65535.0f * 0.5f + 1e-6f,
+        };
+
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        float maxError[3] = {};
+        for (int i = 0; i < 100000; ++i)
+        {
+            XMFLOAT3 p(
+                boundsMin.x + (boundsMax.x - boundsMin.x) * unit(random),
+                boundsMin.y,
+                boundsMin.z + (boundsMax.z - boundsMin.z) * unit(random));
+            if (i == 0) p = boundsMin;
+            if (i == 1) p = boundsMax;
+
+            uint16_t encoded[4];
+            VertexCompression::EncodePosition(p, quantization, (i & 1) ? -1.0f : 1.0f, encoded);
+            const XMFLOAT3 decoded = VertexCompression::DecodePosition(encoded, quantization);
+
+            maxError[0] = std::max(maxError[0], std::fabs(decoded.x - p.x));
+            maxError[1] = std::max(maxError[1], std::fabs(decoded.y - p.y));
+            maxError[2] = std::max(maxError[2], std::fabs(decoded.z - p.z));
+
+            // w 에 탄젠트 부호
+            CHECK(encoded[3] == ((i & 1) ? 0 : 0xFFFF));
+        }
+
+        std::printf("  position max error: %g %g %g\n", maxError[0], maxError[1], maxError[2]);
+        for (int axis = 0; axis < 3; ++axis)
+            CHECK(maxError[axis] <= tolerance[axis]);
+    }
+
+    void TestSnormDecode()
+    {
+        // D3D SNORM: -32768 과 -32767 모두 -1
+        CHECK(VertexCompression::DecodeSnorm16(-32768) == -1.0f);
+        CHECK(VertexCompression::DecodeSnorm16(-32767) == -1.0f);
+        CHECK(VertexCompression::DecodeSnorm16(32767) == 1.0f);
+        CHECK(VertexCompression::DecodeSnorm16(0) == 0.0f);
+        CHECK(VertexCompression::EncodeSnorm16(2.0f) == 32767);
+        CHECK(VertexCompression::EncodeUnorm16(-1.0f) == 0);
+    }
+
+    void TestTexCoordHalf()
+    {
+        // [0, 4) UV 는 half 의 상대 오차 2^-11 안
+        const float uvs[] = { 0.0f, 0.125f, 0.3333f, 0.9999f, 1.0f, 2.71828f, 3.9f };
+        for (float u : uvs)
+        {
+            uint16_t encoded[2];
+            VertexCompression::EncodeTexCoord(XMFLOAT2(u, 1.0f - u), encoded);
+            const float decoded = PackedVector::XMConvertHalfToFloat(encoded[0]);
+            CHECK(std::fabs(decoded - u) <= std::max(std::fabs(u), 1.0f) / 2048.0f);
+        }
+    }
+}
+
+int main()
+{
+    TestOctahedralSpecialDirections();
+    TestOctahedralAngleBound();
+    TestPositionErrorBound();
+    TestSnormDecode();
+    TestTexCoordHalf();
+    return TestCommon::Report("VertexCompression");
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+// ---------------------------------------------------------------------------
+// Windows SDK 의 SAL 주석을 비 Windows 빌드에서 비워 두는 최소 대체 헤더
+// (DirectXMath 가 sal.h 를 include 하므로 Linux 테스트 빌드에서만 사용)
+// ---------------------------------------------------------------------------
+#define _In_
+#define _In_opt_
+#define _In_z_
+#define _In_reads_(x)
+#define _In_reads_opt_(x)
+#define _In_reads_bytes_(x)
+#define _In_reads_bytes_opt_(x)
+#define _Out_
+#define _Out_opt_
+#define _Out_writes_(x)
+#define _Out_writes_opt_(x)
+#define _Out_writes_bytes_(x)
+#define _Out_writes_all_(x)
+#define _Inout_
+#define _Inout_opt_
+#define _Inout_updates_(x)
+#define _Inout_updates_bytes_(x)
+#define _Outptr_
+#define _Outptr_opt_
+#define _Check_return_
+#define _Use_decl_annotations_
+#define _Success_(x)
+#define _Analysis_assume_(x)
+#define _Ret_maybenull_
+#define _When_(x, y)
+#define _Pre_
+#define _Post_
+#define _Printf_format_string_
@@ -0,0 +1,336 @@
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    // ---------------------------------------------------------------------------
+    // BC4
+    // ---------------------------------------------------------------------------
+
+    // 팔레트에서 가장 가까운 값을 골라 48bit 인덱스로 묶고 제곱 오차를 돌려줌
+    uint32_t FitBC4Palette(const uint8_t values[16], const int palette[8], uint64_t& outIndices)
+    {
+        uint32_t error = 0;
+        outIndices = 0;
+        for (int i = 0; i < 16; ++i) {
+            int best = 0;
+            int bestError = std::numeric_limits<int>::max();
+            for (int p = 0; p < 8; ++p) {
+                const int d = int(values[i]) - palette[p];
+                if (d * d < bestError) {
+                    bestError = d * d;
+                    best = p;
+                }
+            }
+            error += uint32_t(bestError);
+            outIndices |= uint64_t(best) << (3 * i);
+        }
+        return error;
+    }
+
+    void WriteBC4(int endpoint0, int endpoint1, uint64_t indices, uint8_t outBlock[8])
+    {
+        outBlock[0] = uint8_t(endpoint0);
+        outBlock[1] = uint8_t(endpoint1);
+        for (int i = 0; i < 6; ++i)
+            outBlock[2 + i] = uint8_t(indices >> (8 * i));
+    }
+
+    // ---------------------------------------------------------------------------
+    // BC7 mode 6
+    // ---------------------------------------------------------------------------
+    constexpr int Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    struct Mode6Endpoints
+    {
+        int color[2][4];    // 7bit
+        int pbit[2];
+    };
+
+    int Expand(const Mode6Endpoints& e, int endpoint, int channel)
+    {
+        return (e.color[endpoint][channel] << 1) | e.pbit[endpoint];
+    }
+
+    // 실수 끝점을 주어진 p-bit 로 양자화
+    Mode6Endpoints Quantize(const float endpoints[2][4], int pbit0, int pbit1)
+    {
+        Mode6Endpoints e{};
+        e.pbit[0] = pbit0;
+        e.pbit[1] = pbit1;
+        for (int end = 0; end < 2; ++end) {
+            for (int c = 0; c < 4; ++c) {
+                const float v = (endpoints[end][c] - float(e.pbit[end])) * 0.5f;
+                e.color[end][c] = std::clamp(int(std::lround(v)), 0, 127);
+            }
+        }
+        return e;
+    }
+
+    // 모든 텍셀에 가장 가까운 팔레트 인덱스 (제곱 오차 합을 돌려줌)
+    uint32_t FitMode6(const uint8_t rgba[16][4], const Mode6Endpoints& e, uint8_t outIndices[16])
+    {
+        int palette[16][4];
+        for (int c = 0; c < 4; ++c) {
+            const int a = Expand(e, 0, c);
+            const int b = Expand(e, 1, c);
+            for (int i = 0; i < 16; ++i)
+                palette[i][c] = ((64 - Weights4[i]) * a + Weights4[i] * b + 32) >> 6;
+        }
+
+        uint32_t error = 0;
+        for (int t = 0; t < 16; ++t) {
+            int best = 0;
+            int bestError = std::numeric_limits<int>::max();
+            for (int i = 0; i < 16; ++i) {
+                int d = 0;
+                for (int c = 0; c < 4; ++c) {
+                    const int diff = int(rgba[t][c]) - palette[i][c];
+                    d += diff * diff;
+                }
+                if (d < bestError) {
+                    bestError = d;
+                    best = i;
+                }
+            }
+            outIndices[t] = uint8_t(best);
+            error += uint32_t(bestError);
+        }
+        return error;
+    }
+
+    // p-bit 4 조합 중 오차가 가장 작은 양자화
+    uint32_t FitBestPbits(const uint8_t rgba[16][4], const float endpoints[2][4],
+        Mode6Endpoints& outEndpoints, uint8_t outIndices[16])
+    {
+        uint32_t bestError = std::numeric_limits<uint32_t>::max();
+        for (int p = 0; p < 4; ++p) {
+            const Mode6Endpoints e = Quantize(endpoints, p & 1, p >> 1);
+            uint8_t indices[16];
+            const uint32_t error = FitMode6(rgba, e, indices);
+            if (error < bestError) {
+                bestError = error;
+                outEndpoints = e;
+                std::memcpy(outIndices, indices, 16);
+            }
+        }
+        return bestError;
+    }
+
+    // 인덱스를 고정하고 끝점을 최소제곱으로 다시 계산 (특이하면 false)
+    bool SolveEndpoints(const uint8_t rgba[16][4], const uint8_t indices[16], float outEndpoints[2][4])
+    {
+        float a11 = 0, a12 = 0, a22 = 0;
+        float b1[4] = {}, b2[4] = {};
+        for (int t = 0; t < 16; ++t) {
+            const float w = float(Weights4[indices[t]]) / 64.0f;
+            const float iw = 1.0f - w;
+            a11 += iw * iw;
+            a12 += iw * w;
+            a22 += w * w;
+            for (int c = 0; c < 4; ++c) {
+                b1[c] += iw * float(rgba[t][c]);
+                b2[c] += w * float(rgba[t][c]);
+            }
+        }
+
+        const float det = a11 * a22 - a12 * a12;
+        if (std::fabs(det) < 1e-6f)
+            return false;
+
+        for (int c = 0; c < 4; ++c) {
+            outEndpoints[0][c] = std::clamp((b1[c] * a22 - b2[c] * a12) / det, 0.0f, 255.0f);
+            outEndpoints[1][c] = std::clamp((b2[c] * a11 - b1[c] * a12) / det, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    // 주축 (공분산 행렬의 최대 고유벡터, power iteration) 위의 최소 / 최대 투영을 끝점으로
+    void PrincipalEndpoints(const uint8_t rgba[16][4], float outEndpoints[2][4])
+    {
+        float mean[4] = {};
+        for (int t = 0; t < 16; ++t)
+            for (int c = 0; c < 4; ++c)
+                mean[c] += float(rgba[t][c]) / 16.0f;
+
+        float cov[4][4] = {};
+        float minValue[4] = { 255, 255, 255, 255 };
+        float maxValue[4] = {};
+        for (int t = 0; t < 16; ++t) {
+            float d[4];
+            for (int c = 0; c < 4; ++c) {
+                d[c] = float(rgba[t][c]) - mean[c];
+                minValue[c] = std::min(minValue[c], float(rgba[t][c]));
+                maxValue[c] = std::max(maxValue[c], float(rgba[t][c]));
+            }
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    cov[r][c] += d[r] * d[c];
+        }
+
+        float axis[4];
+        for (int c = 0; c < 4; ++c)
+            axis[c] = maxValue[c] - minValue[c];
+
+        for (int iteration = 0; iteration < 8; ++iteration) {
+            float next[4] = {};
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    next[r] += cov[r][c] * axis[c];
+
+            const float length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2] + next[3] * next[3]);
+            if (length < 1e-6f)
+                break;
+            for (int c = 0; c < 4; ++c)
+                axis[c] = next[c] / length;
+        }
+
+        const float axisLength = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2] + axis[3] * axis[3]);
+        float minT = 0.0f, maxT = 0.0f;
+        if (axisLength > 1e-6f) {
+            for (int c = 0; c < 4; ++c)
+                axis[c] /= axisLength;
+
+            minT = std::numeric_limits<float>::max();
+            maxT = -std::numeric_limits<float>::max();
+            for (int t = 0; t < 16; ++t) {
+                float projection = 0.0f;
+                for (int c = 0; c < 4; ++c)
+                    projection += (float(rgba[t][c]) - mean[c]) * axis[c];
+                minT = std::min(minT, projection);
+                maxT = std::max(maxT, projection);
+            }
+        }
+
+        for (int c = 0; c < 4; ++c) {
+            outEndpoints[0][c] = std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+            outEndpoints[1][c] = std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+        }
+    }
+
+    // LSB 부터 채우는 128bit 블록 쓰기
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(uint8_t* block) : bytes(block) { std::memset(bytes, 0, 16); }
+
+        void Write(uint32_t value, int bitCount)
+        {
+            for (int i = 0; i < bitCount; ++i, ++position) {
+                if (value & (1u << i))
+                    bytes[position >> 3] |= uint8_t(1u << (position & 7));
+            }
+        }
+
+    private:
+        uint8_t* bytes;
+        int position = 0;
+    };
+}
+
+namespace BlockCompression
+{
+    void EncodeBC4(const uint8_t values[16], uint8_t outBlock[8])
+    {
+        int minValue = 255, maxValue = 0;
+        int minInner = 255, maxInner = 0;     // 0, 255 를 뺀 범위 (6단계 팔레트용)
+        for (int i = 0; i < 16; ++i) {
+            minValue = std::min(minValue, int(values[i]));
+            maxValue = std::max(maxValue, int(values[i]));
+            if (values[i] != 0 && values[i] != 255) {
+                minInner = std::min(minInner, int(values[i]));
+                maxInner = std::max(maxInner, int(values[i]));
+            }
+        }
+
+        // 1) 8단계: endpoint0 > endpoint1 (같으면 모든 인덱스가 0)
+        if (minValue == maxValue) {
+            WriteBC4(maxValue, minValue, 0, outBlock);
+            return;
+        }
+
+        int palette8[8] = { maxValue, minValue };
+        for (int i = 1; i < 7; ++i)
+            palette8[i + 1] = ((7 - i) * maxValue + i * minValue + 3) / 7;
+
+        uint64_t indices8 = 0;
+        const uint32_t error8 = FitBC4Palette(values, palette8, indices8);
+
+        // 2) 6단계 + 0 / 255: endpoint0 <= endpoint1, 극값이 섞인 블록에서 유리
+        if (minInner <= maxInner) {
+            int palette6[8] = { minInner, maxInner };
+            for (int i = 1; i < 5; ++i)
+                palette6[i + 1] = ((5 - i) * minInner + i * maxInner + 2) / 5;
+            palette6[6] = 0;
+            palette6[7] = 255;
+
+            uint64_t indices6 = 0;
+            const uint32_t error6 = FitBC4Palette(values, palette6, indices6);
+            if (error6 < error8) {
+                WriteBC4(minInner, maxInner, indices6, outBlock);
+                return;
+            }
+        }
+
+        WriteBC4(maxValue, minValue, indices8, outBlock);
+    }
+
+    void EncodeBC5(const uint8_t red[16], const uint8_t green[16], uint8_t outBlock[16])
+    {
+        EncodeBC4(red, outBlock);
+        EncodeBC4(green, outBlock + 8);
+    }
+
+    void EncodeBC7(const uint8_t rgba[16][4], uint8_t outBlock[16])
+    {
+        // 1) 주축 끝점 → 최적 p-bit
+        float endpoints[2][4];
+        PrincipalEndpoints(rgba, endpoints);
+
+        Mode6Endpoints best{};
+        uint8_t bestIndices[16];
+        uint32_t bestError = FitBestPbits(rgba, endpoints, best, bestIndices);
+
+        // 2) 최소제곱으로 끝점 다듬기 (오차가 줄어들 때만 채택)
+        for (int iteration = 0; iteration < 2 && bestError > 0; ++iteration) {
+            float refined[2][4];
+            if (!SolveEndpoints(rgba, bestIndices, refined))
+                break;
+
+            Mode6Endpoints candidate{};
+            uint8_t indices[16];
+            const uint32_t error = FitBestPbits(rgba, refined, candidate, indices);
+            if (error >= bestError)
+                break;
+
+            best = candidate;
+            bestError = error;
+            std::memcpy(bestIndices, indices, 16);
+        }
+
+        // 3) 앵커 (텍셀 0) 인덱스의 최상위 비트는 0 이어야 하므로 필요하면 끝점을 뒤집음
+        if (bestIndices[0] & 8) {
+            std::swap(best.color[0], best.color[1]);
+            std::swap(best.pbit[0], best.pbit[1]);
+            for (uint8_t& index : bestIndices)
+                index = uint8_t(15 - index);
+        }
+
+        // 4) mode 6 비트 배치: mode(7) RGBA 끝점(7x8) p-bit(2) 인덱스(3 + 4x15)
+        BitWriter writer(outBlock);
+        writer.Write(1u << 6, 7);
+        for (int c = 0; c < 4; ++c) {
+            writer.Write(uint32_t(best.color[0][c]), 7);
+            writer.Write(uint32_t(best.color[1][c]), 7);
+        }
+        writer.Write(uint32_t(best.pbit[0]), 1);
+        writer.Write(uint32_t(best.pbit[1]), 1);
+        writer.Write(bestIndices[0], 3);
+        for (int t = 1; t < 16; ++t)
+            writer.Write(bestIndices[t], 4);
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+// ---------------------------------------------------------------------------
+// BC4 / BC5 / BC7 블록 인코더 (4x4 텍셀 → 8 / 16 / 16 바이트)
+// 오프라인 쿠킹용이라 속도보다 단순함 우선, 외부 라이브러리 없이 Linux 에서 빌드
+//   - BC4: min/max 끝점, 8단계 팔레트와 (0, 255 포함) 6단계 팔레트 중 오차가 작은 쪽
+//   - BC7: mode 6 (1 subset, RGBA 7bit + p-bit 끝점, 4bit 인덱스)
+//          PCA 축으로 끝점을 잡고 최소제곱으로 두 번 다듬는다. p-bit 4 조합은 전부 시도
+// ---------------------------------------------------------------------------
+namespace BlockCompression
+{
+    void EncodeBC4(const uint8_t values[16], uint8_t outBlock[8]);
+    void EncodeBC5(const uint8_t red[16], const uint8_t green[16], uint8_t outBlock[16]);
+    void EncodeBC7(const uint8_t rgba[16][4], uint8_t outBlock[16]);
+}
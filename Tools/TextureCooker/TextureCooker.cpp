@@ -0,0 +1,390 @@
+// TextureCooker
+// PNG 텍스쳐를 역할별 BC 포맷(BC7 sRGB / BC5 / BC4) + 전체 밉 체인 DDS 로 미리 변환한다.
+// 결과는 TextureCache::GetCachePath 위치(Cache/Textures)에 쓰고, Texture::DecodeFile 이 WIC 대신 읽는다.
+//
+//   TextureCooker <dir | file.png>... [--force]
+//   (런타임과 같은 상대 경로가 나오도록 Client 폴더에서 실행, 폴더는 재귀 탐색)
+//
+// - 증분 빌드: 기존 DDS 에 기록된 소스 해시(파일 내용 + 역할 + 버전)가 같으면 건너뛴다
+// - 밉은 선형 공간 box 필터 (색상은 sRGB 디코드 후 평균, 노멀은 평균 후 재정규화)
+
+#include "TextureCache.h"
+#include "BlockCompression.h"
+
+#include <png.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+using TextureCache::TextureRole;
+
+namespace
+{
+    struct Options
+    {
+        std::vector<fs::path> inputs;
+        bool force = false;
+    };
+
+    // 한 밉 레벨의 작업 이미지 (선형 공간 float RGBA)
+    struct MipImage
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<float> pixels;
+
+        float* At(uint32_t x, uint32_t y) { return &pixels[(size_t(y) * width + x) * 4]; }
+        const float* At(uint32_t x, uint32_t y) const { return &pixels[(size_t(y) * width + x) * 4]; }
+    };
+
+    float SrgbToLinear(float v)
+    {
+        return v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+    }
+
+    float LinearToSrgb(float v)
+    {
+        return v <= 0.0031308f ? v * 12.92f : 1.055f * std::pow(v, 1.0f / 2.4f) - 0.055f;
+    }
+
+    uint8_t ToUnorm8(float v)
+    {
+        return uint8_t(std::lround(std::clamp(v, 0.0f, 1.0f) * 255.0f));
+    }
+
+    const char* FormatName(TextureRole role)
+    {
+        switch (role) {
+        case TextureRole::Normal:   return "BC5";
+        case TextureRole::Metallic:
+        case TextureRole::Mask:     return "BC4";
+        default:                    return "BC7 sRGB";
+        }
+    }
+
+    bool LoadPng(const fs::path& path, uint32_t& outWidth, uint32_t& outHeight, std::vector<uint8_t>& outRgba)
+    {
+        png_image image{};
+        image.version = PNG_IMAGE_VERSION;
+        if (!png_image_begin_read_from_file(&image, path.string().c_str())) {
+            std::cerr << "Cannot read " << path.string() << ": " << image.message << "\n";
+            return false;
+        }
+
+        image.format = PNG_FORMAT_RGBA;
+        outRgba.resize(PNG_IMAGE_SIZE(image));
+        if (!png_image_finish_read(&image, nullptr, outRgba.data(), 0, nullptr)) {
+            std::cerr << "Cannot decode " << path.string() << ": " << image.message << "\n";
+            png_image_free(&image);
+            return false;
+        }
+
+        outWidth = image.width;
+        outHeight = image.height;
+        return true;
+    }
+
+    // 8bit 소스 → 역할별 작업 공간
+    //   Color: 선형 rgb + a / Normal: [-1, 1] xyz / Metallic, Mask: r 하나 (소스 채널에서)
+    MipImage Decode(const std::vector<uint8_t>& rgba, uint32_t width, uint32_t height, TextureRole role)
+    {
+        MipImage image{ width, height, std::vector<float>(size_t(width) * height * 4, 0.0f) };
+        const uint32_t sourceChannel = TextureCache::GetSourceChannel(role);
+
+        for (size_t i = 0; i < size_t(width) * height; ++i) {
+            const uint8_t* in = &rgba[i * 4];
+            float* out = &image.pixels[i * 4];
+            switch (role) {
+            case TextureRole::Color:
+                for (int c = 0; c < 3; ++c)
+                    out[c] = SrgbToLinear(in[c] / 255.0f);
+                out[3] = in[3] / 255.0f;
+                break;
+            case TextureRole::Normal:
+                for (int c = 0; c < 3; ++c)
+                    out[c] = in[c] / 255.0f * 2.0f - 1.0f;
+                break;
+            default:
+                out[0] = in[sourceChannel] / 255.0f;
+                break;
+            }
+        }
+        return image;
+    }
+
+    // 2x2 box 필터 (홀수 크기면 마지막 행/열을 한 번 더 씀)
+    MipImage Downsample(const MipImage& source, TextureRole role)
+    {
+        MipImage mip;
+        mip.width = std::max(1u, source.width / 2);
+        mip.height = std::max(1u, source.height / 2);
+        mip.pixels.resize(size_t(mip.width) * mip.height * 4);
+
+        for (uint32_t y = 0; y < mip.height; ++y) {
+            for (uint32_t x = 0; x < mip.width; ++x) {
+                const uint32_t x0 = std::min(x * 2, source.width - 1);
+                const uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+                const uint32_t y0 = std::min(y * 2, source.height - 1);
+                const uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+
+                float* out = mip.At(x, y);
+                for (int c = 0; c < 4; ++c)
+                    out[c] = 0.25f * (source.At(x0, y0)[c] + source.At(x1, y0)[c] + source.At(x0, y1)[c] + source.At(x1, y1)[c]);
+
+                if (role == TextureRole::Normal) {
+                    const float length = std::sqrt(out[0] * out[0] + out[1] * out[1] + out[2] * out[2]);
+                    if (length > 1e-6f)
+                        for (int c = 0; c < 3; ++c)
+                            out[c] /= length;
+                }
+            }
+        }
+        return mip;
+    }
+
+    // 작업 공간 → 블록 인코더 입력 (8bit)
+    void EncodeTexel(const float* in, TextureRole role, uint8_t out[4])
+    {
+        switch (role) {
+        case TextureRole::Color:
+            for (int c = 0; c < 3; ++c)
+                out[c] = ToUnorm8(LinearToSrgb(in[c]));
+            out[3] = ToUnorm8(in[3]);
+            break;
+        case TextureRole::Normal:
+            for (int c = 0; c < 3; ++c)
+                out[c] = ToUnorm8(in[c] * 0.5f + 0.5f);
+            out[3] = 255;
+            break;
+        default:
+            out[0] = out[1] = out[2] = ToUnorm8(in[0]);
+            out[3] = 255;
+            break;
+        }
+    }
+
+    // 한 밉을 블록 단위로 압축 (블록 행을 스레드 수만큼 나눠 병렬)
+    std::vector<uint8_t> CompressMip(const MipImage& mip, TextureRole role)
+    {
+        const uint32_t blocksX = (mip.width + 3) / 4;
+        const uint32_t blocksY = (mip.height + 3) / 4;
+        const size_t blockBytes = TextureCache::GetFormat(role) == TextureCache::FormatBC4Unorm ? 8 : 16;
+        std::vector<uint8_t> data(size_t(blocksX) * blocksY * blockBytes);
+
+        auto compressRows = [&](uint32_t firstRow, uint32_t lastRow) {
+            for (uint32_t by = firstRow; by < lastRow; ++by) {
+                for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                    // 가장자리 블록은 마지막 텍셀을 복제
+                    uint8_t texels[16][4];
+                    for (uint32_t t = 0; t < 16; ++t) {
+                        const uint32_t x = std::min(bx * 4 + t % 4, mip.width - 1);
+                        const uint32_t y = std::min(by * 4 + t / 4, mip.height - 1);
+                        EncodeTexel(mip.At(x, y), role, texels[t]);
+                    }
+
+                    uint8_t* out = &data[(size_t(by) * blocksX + bx) * blockBytes];
+                    if (role == TextureRole::Color) {
+                        BlockCompression::EncodeBC7(texels, out);
+                    }
+                    else if (role == TextureRole::Normal) {
+                        uint8_t red[16], green[16];
+                        for (int t = 0; t < 16; ++t) {
+                            red[t] = texels[t][0];
+                            green[t] = texels[t][1];
+                        }
+                        BlockCompression::EncodeBC5(red, green, out);
+                    }
+                    else {
+                        uint8_t red[16];
+                        for (int t = 0; t < 16; ++t)
+                            red[t] = texels[t][0];
+                        BlockCompression::EncodeBC4(red, out);
+                    }
+                }
+            }
+        };
+
+        const uint32_t threadCount = std::max(1u, std::min(std::thread::hardware_concurrency(), blocksY));
+        const uint32_t rowsPerThread = (blocksY + threadCount - 1) / threadCount;
+        std::vector<std::future<void>> jobs;
+        for (uint32_t first = 0; first < blocksY; first += rowsPerThread)
+            jobs.push_back(std::async(std::launch::async, compressRows, first, std::min(first + rowsPerThread, blocksY)));
+        for (auto& job : jobs)
+            job.get();
+
+        return data;
+    }
+
+    void Put32(std::vector<uint8_t>& data, size_t offset, uint32_t value)
+    {
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+    }
+
+    // DDS_HEADER + DDS_HEADER_DXT10 (BC7 은 DX10 확장 헤더가 필요해 모두 같은 형태로 씀)
+    std::vector<uint8_t> BuildDdsHeader(uint32_t width, uint32_t height, uint32_t mipCount,
+        uint32_t dxgiFormat, uint32_t topMipBytes, uint64_t sourceHash)
+    {
+        std::vector<uint8_t> header(4 + 124 + 20, 0);
+        std::memcpy(header.data(), "DDS ", 4);
+
+        Put32(header, 4, 124);                                  // dwSize
+        Put32(header, 8, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000);   // CAPS | HEIGHT | WIDTH | PIXELFORMAT | MIPMAPCOUNT | LINEARSIZE
+        Put32(header, 12, height);
+        Put32(header, 16, width);
+        Put32(header, 20, topMipBytes);                         // dwPitchOrLinearSize
+        Put32(header, 28, mipCount);
+
+        // dwReserved1: 소스 해시 스탬프
+        const TextureCache::Stamp stamp{ TextureCache::StampMagic, TextureCache::Version, sourceHash };
+        std::memcpy(header.data() + TextureCache::StampOffset, &stamp, sizeof(stamp));
+
+        Put32(header, 76, 32);                                  // ddspf.dwSize
+        Put32(header, 80, 0x4);                                 // DDPF_FOURCC
+        std::memcpy(header.data() + 84, "DX10", 4);
+        Put32(header, 108, 0x1000 | 0x8 | 0x400000);            // TEXTURE | COMPLEX | MIPMAP
+
+        Put32(header, 128, dxgiFormat);
+        Put32(header, 132, 3);                                  // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+        Put32(header, 140, 1);                                  // arraySize
+        return header;
+    }
+
+    enum class CookResult { Cooked, UpToDate, Skipped, Failed };
+
+    CookResult CookTexture(const fs::path& sourcePath, bool force)
+    {
+        const TextureRole role = TextureCache::GetRole(sourcePath);
+        const fs::path cachePath = TextureCache::GetCachePath(sourcePath);
+        const uint64_t sourceHash = TextureCache::HashSource(sourcePath, role);
+        if (sourceHash == 0)
+            return CookResult::Failed;
+
+        if (!force && TextureCache::IsUpToDate(cachePath, sourceHash))
+            return CookResult::UpToDate;
+
+        uint32_t width = 0, height = 0;
+        std::vector<uint8_t> rgba;
+        if (!LoadPng(sourcePath, width, height, rgba))
+            return CookResult::Failed;
+
+        // D3D12 는 BC 텍스쳐의 최상위 밉 크기가 4의 배수여야 함 → 런타임 WIC 경로에 맡김
+        if (width % 4 != 0 || height % 4 != 0) {
+            std::cout << "  " << sourcePath.generic_string() << ": " << width << "x" << height
+                      << " is not a multiple of 4, skipped\n";
+            return CookResult::Skipped;
+        }
+
+        // 1) 밉 체인 (1x1 까지) 압축
+        const uint32_t mipCount = uint32_t(std::floor(std::log2(double(std::max(width, height))))) + 1;
+        std::vector<std::vector<uint8_t>> mips;
+        MipImage mip = Decode(rgba, width, height, role);
+        for (uint32_t level = 0; level < mipCount; ++level) {
+            if (level > 0)
+                mip = Downsample(mip, role);
+            mips.push_back(CompressMip(mip, role));
+        }
+
+        // 2) 임시 파일에 쓰고 교체 (실패해도 기존 캐시가 깨지지 않도록)
+        const std::vector<uint8_t> header = BuildDdsHeader(width, height, mipCount,
+            TextureCache::GetFormat(role), uint32_t(mips[0].size()), sourceHash);
+
+        std::error_code ec;
+        fs::create_directories(cachePath.parent_path(), ec);
+        const fs::path tempPath = fs::path(cachePath).concat(".tmp");
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+                return CookResult::Failed;
+            file.write(reinterpret_cast<const char*>(header.data()), header.size());
+            for (const auto& data : mips)
+                file.write(reinterpret_cast<const char*>(data.data()), data.size());
+            if (!file)
+                return CookResult::Failed;
+        }
+        fs::rename(tempPath, cachePath, ec);
+        if (ec)
+            return CookResult::Failed;
+
+        std::cout << "  " << sourcePath.generic_string() << " -> " << cachePath.generic_string()
+                  << " (" << FormatName(role) << ", " << width << "x" << height << ", " << mipCount << " mips)\n";
+        return CookResult::Cooked;
+    }
+
+    bool IsPng(const fs::path& path)
+    {
+        std::string ext = path.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+        return ext == ".png";
+    }
+
+    bool CollectSources(const std::vector<fs::path>& inputs, std::vector<fs::path>& outSources)
+    {
+        for (const auto& input : inputs) {
+            std::error_code ec;
+            if (fs::is_directory(input, ec)) {
+                for (const auto& entry : fs::recursive_directory_iterator(input, ec)) {
+                    if (entry.is_regular_file() && IsPng(entry.path()))
+                        outSources.push_back(entry.path().lexically_normal());
+                }
+            }
+            else if (fs::is_regular_file(input, ec)) {
+                outSources.push_back(input.lexically_normal());
+            }
+            else {
+                std::cerr << "Not found: " << input.string() << "\n";
+                return false;
+            }
+        }
+
+        std::sort(outSources.begin(), outSources.end());
+        outSources.erase(std::unique(outSources.begin(), outSources.end()), outSources.end());
+        return true;
+    }
+
+    bool ParseArguments(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--force")
+                options.force = true;
+            else
+                options.inputs.push_back(arg);
+        }
+        return !options.inputs.empty();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseArguments(argc, argv, options)) {
+        std::cerr << "usage: TextureCooker <dir | file.png>... [--force]\n";
+        return 2;
+    }
+
+    std::vector<fs::path> sources;
+    if (!CollectSources(options.inputs, sources))
+        return 1;
+
+    // 텍스쳐는 하나씩 (4K 작업 이미지가 크므로), 블록 압축은 CompressMip 안에서 병렬
+    size_t counts[4] = {};
+    for (const auto& source : sources) {
+        const CookResult result = CookTexture(source, options.force);
+        ++counts[size_t(result)];
+        if (result == CookResult::Failed)
+            std::cerr << "Failed to cook " << source.string() << "\n";
+    }
+
+    std::cout << "TextureCooker: " << sources.size() << " textures ("
+              << counts[size_t(CookResult::Cooked)] << " cooked, "
+              << counts[size_t(CookResult::UpToDate)] << " up to date, "
+              << counts[size_t(CookResult::Skipped)] << " skipped) -> Cache/Textures\n";
+    return counts[size_t(CookResult::Failed)] > 0 ? 1 : 0;
+}